@@ -26,6 +26,7 @@ $(TEST_OUTPUT)_SRC := \
 	tests/test_common/keycode_util.cpp \
 	tests/test_common/keycode_table.cpp \
 	tests/test_common/test_fixture.cpp \
+	tests/test_common/simulator.cpp \
 	tests/test_common/test_keymap_key.cpp \
 	tests/test_common/test_logger.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
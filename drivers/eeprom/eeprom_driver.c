@@ -19,6 +19,171 @@
 
 #include "eeprom_driver.h"
 
+#ifdef EEPROM_WRITE_BACK_CACHE
+#    include "timer.h"
+
+/*
+    Write-back cache. Writes are held in a small number of RAM lines, each
+    covering an aligned 32-byte window with a per-byte dirty mask, and reach the
+    driver once EEPROM_WRITE_BACK_CACHE_TIMEOUT milliseconds pass without any
+    further writes, when the lines run out, or when eeprom_driver_flush() is
+    called before suspend or reset. Repeated writes to the same bytes are
+    coalesced, and each contiguous run of dirty bytes in a line is written with
+    a single driver call.
+*/
+
+#    ifndef EEPROM_WRITE_BACK_CACHE_LINES
+#        define EEPROM_WRITE_BACK_CACHE_LINES 8
+#    endif
+
+#    ifndef EEPROM_WRITE_BACK_CACHE_TIMEOUT
+#        define EEPROM_WRITE_BACK_CACHE_TIMEOUT 1000
+#    endif
+
+// One bit of the dirty mask per byte
+#    define EEPROM_WRITE_BACK_CACHE_LINE_SIZE 32
+
+typedef struct {
+    uintptr_t base;  // address of data[0], only meaningful while dirty is non-zero
+    uint32_t  dirty; // bit n is set when data[n] has not been written to the driver yet
+    uint8_t   data[EEPROM_WRITE_BACK_CACHE_LINE_SIZE];
+} eeprom_cache_line_t;
+
+static eeprom_cache_line_t         cache_lines[EEPROM_WRITE_BACK_CACHE_LINES];
+static uint16_t                    cache_last_write;
+static bool                        cache_dirty;
+static eeprom_driver_cache_stats_t cache_stats;
+
+static eeprom_cache_line_t *cache_line_for(uintptr_t base) {
+    eeprom_cache_line_t *free_line = NULL;
+    for (uint8_t i = 0; i < EEPROM_WRITE_BACK_CACHE_LINES; i++) {
+        if (!cache_lines[i].dirty) {
+            if (!free_line) {
+                free_line = &cache_lines[i];
+            }
+        } else if (cache_lines[i].base == base) {
+            return &cache_lines[i];
+        }
+    }
+
+    if (!free_line) {
+        cache_stats.forced_flushes++;
+        eeprom_driver_flush();
+        free_line = &cache_lines[0];
+    }
+    free_line->base = base;
+    return free_line;
+}
+
+void eeprom_driver_flush(void) {
+    if (!cache_dirty) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < EEPROM_WRITE_BACK_CACHE_LINES; i++) {
+        eeprom_cache_line_t *line  = &cache_lines[i];
+        uint32_t             dirty = line->dirty;
+        uint8_t              start = 0;
+
+        while (dirty) {
+            // Skip clean bytes, then measure the run of dirty ones
+            while (!(dirty & 1)) {
+                dirty >>= 1;
+                start++;
+            }
+            uint8_t len = 0;
+            while (dirty & 1) {
+                dirty >>= 1;
+                len++;
+            }
+
+            eeprom_driver_write_block(&line->data[start], (void *)(line->base + start), len);
+            cache_stats.driver_writes++;
+            cache_stats.bytes_flushed += len;
+            start += len;
+        }
+        line->dirty = 0;
+    }
+
+    cache_stats.flushes++;
+    cache_dirty = false;
+}
+
+void eeprom_driver_discard(void) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_BACK_CACHE_LINES; i++) {
+        cache_lines[i].dirty = 0;
+    }
+    cache_dirty = false;
+}
+
+bool eeprom_driver_is_dirty(void) {
+    return cache_dirty;
+}
+
+void eeprom_driver_task(void) {
+    if (cache_dirty && timer_elapsed(cache_last_write) >= EEPROM_WRITE_BACK_CACHE_TIMEOUT) {
+        eeprom_driver_flush();
+    }
+}
+
+const eeprom_driver_cache_stats_t *eeprom_driver_cache_stats(void) {
+    return &cache_stats;
+}
+
+void eeprom_driver_cache_stats_reset(void) {
+    memset(&cache_stats, 0, sizeof(cache_stats));
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_driver_read_block(buf, addr, len);
+    if (!cache_dirty) {
+        return;
+    }
+
+    // Overlay anything still waiting in the cache
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end   = start + len;
+    for (uint8_t i = 0; i < EEPROM_WRITE_BACK_CACHE_LINES; i++) {
+        const eeprom_cache_line_t *line = &cache_lines[i];
+        if (!line->dirty || line->base >= end || line->base + EEPROM_WRITE_BACK_CACHE_LINE_SIZE <= start) {
+            continue;
+        }
+        for (uint8_t n = 0; n < EEPROM_WRITE_BACK_CACHE_LINE_SIZE; n++) {
+            uintptr_t address = line->base + n;
+            if ((line->dirty & ((uint32_t)1 << n)) && address >= start && address < end) {
+                ((uint8_t *)buf)[address - start] = line->data[n];
+            }
+        }
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src     = buf;
+    uintptr_t      address = (uintptr_t)addr;
+
+    while (len > 0) {
+        uintptr_t base   = address & ~(uintptr_t)(EEPROM_WRITE_BACK_CACHE_LINE_SIZE - 1);
+        uint8_t   offset = address - base;
+        uint8_t   count  = EEPROM_WRITE_BACK_CACHE_LINE_SIZE - offset;
+        if (count > len) {
+            count = len;
+        }
+
+        eeprom_cache_line_t *line = cache_line_for(base);
+        memcpy(&line->data[offset], src, count);
+        line->dirty |= (count == EEPROM_WRITE_BACK_CACHE_LINE_SIZE ? UINT32_MAX : (((uint32_t)1 << count) - 1)) << offset;
+
+        src += count;
+        address += count;
+        len -= count;
+        cache_dirty = true;
+    }
+
+    cache_stats.writes++;
+    cache_last_write = timer_read();
+}
+#endif // EEPROM_WRITE_BACK_CACHE
+
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
     eeprom_read_block(&ret, addr, 1);
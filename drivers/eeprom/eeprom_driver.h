@@ -16,7 +16,38 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stdint.h>
 #include "eeprom.h"
 
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+
+#ifdef EEPROM_WRITE_BACK_CACHE
+/*
+    Block accessors implemented by the driver. With the write-back cache enabled,
+    eeprom_read_block() and eeprom_write_block() are provided by eeprom_driver.c
+    and only reach the driver through these.
+*/
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len);
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len);
+
+typedef struct {
+    uint32_t writes;          // eeprom_write_block() calls absorbed by the cache
+    uint32_t flushes;         // flushes which wrote anything to the driver
+    uint32_t forced_flushes;  // flushes caused by the cache running out of lines
+    uint32_t driver_writes;   // eeprom_driver_write_block() calls made by flushes
+    uint32_t bytes_flushed;   // bytes written to the driver by flushes
+} eeprom_driver_cache_stats_t;
+
+void eeprom_driver_task(void);
+void eeprom_driver_flush(void);
+void eeprom_driver_discard(void);
+bool eeprom_driver_is_dirty(void);
+
+const eeprom_driver_cache_stats_t *eeprom_driver_cache_stats(void);
+void                               eeprom_driver_cache_stats_reset(void);
+#else
+#    define eeprom_driver_read_block eeprom_read_block
+#    define eeprom_driver_write_block eeprom_write_block
+#endif
@@ -0,0 +1,219 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <cstring>
+#include "gtest/gtest.h"
+
+#ifdef EEPROM_WEAR_LEVELING
+#    include "backing_mocks.hpp"
+#endif
+
+extern "C" {
+#include "eeprom_driver.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#ifndef EEPROM_WRITE_BACK_CACHE_TIMEOUT
+#    define EEPROM_WRITE_BACK_CACHE_TIMEOUT 1000
+#endif
+
+class EepromWriteBack : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifdef EEPROM_WEAR_LEVELING
+        MockBackingStore::Instance().reset_instance();
+#endif
+        set_time(0);
+        eeprom_driver_init();
+        eeprom_driver_discard();
+        eeprom_driver_erase();
+        eeprom_driver_cache_stats_reset();
+    }
+
+    static void driver_read(uintptr_t address, void *buf, size_t len) {
+        eeprom_driver_read_block(buf, (const void *)address, len);
+    }
+
+    static uint8_t driver_read_byte(uintptr_t address) {
+        uint8_t value;
+        driver_read(address, &value, 1);
+        return value;
+    }
+
+    // What eeprom_update_block() did before the cache was added
+    static void uncached_update(uintptr_t address, const void *buf, size_t len) {
+        uint8_t current[len];
+        driver_read(address, current, len);
+        if (memcmp(current, buf, len) != 0) {
+            eeprom_driver_write_block(buf, (void *)address, len);
+            uncached_writes++;
+        }
+    }
+
+    static uint64_t backend_cost() {
+#ifdef EEPROM_WEAR_LEVELING
+        return MockBackingStore::Instance().total_write_count();
+#else
+        return uncached_writes + eeprom_driver_cache_stats()->driver_writes;
+#endif
+    }
+
+    static inline uint64_t uncached_writes = 0;
+};
+
+TEST_F(EepromWriteBack, ReadsSeePendingWrites) {
+    uint8_t data[] = {1, 2, 3, 4};
+    eeprom_write_block(data, (void *)10, sizeof(data));
+
+    EXPECT_TRUE(eeprom_driver_is_dirty());
+    EXPECT_EQ(driver_read_byte(10), 0) << "write reached the driver before a flush";
+
+    uint8_t read[6];
+    eeprom_read_block(read, (const void *)9, sizeof(read));
+    EXPECT_EQ(read[0], 0);
+    EXPECT_EQ(0, memcmp(&read[1], data, sizeof(data)));
+    EXPECT_EQ(read[5], 0);
+    EXPECT_EQ(eeprom_read_word((const uint16_t *)11), 0x0302);
+}
+
+TEST_F(EepromWriteBack, FlushWritesThrough) {
+    eeprom_update_dword((uint32_t *)16, 0xDEADBEEF);
+    eeprom_driver_flush();
+
+    EXPECT_FALSE(eeprom_driver_is_dirty());
+    uint32_t value;
+    driver_read(16, &value, sizeof(value));
+    EXPECT_EQ(value, 0xDEADBEEF);
+    EXPECT_EQ(eeprom_driver_cache_stats()->flushes, 1);
+    EXPECT_EQ(eeprom_driver_cache_stats()->driver_writes, 1);
+    EXPECT_EQ(eeprom_driver_cache_stats()->bytes_flushed, 4);
+
+    // Nothing left to do
+    eeprom_driver_flush();
+    EXPECT_EQ(eeprom_driver_cache_stats()->flushes, 1);
+}
+
+TEST_F(EepromWriteBack, CoalescesRepeatedWrites) {
+    for (int i = 1; i <= 100; i++) {
+        eeprom_update_byte((uint8_t *)5, i);
+    }
+    EXPECT_EQ(eeprom_driver_cache_stats()->writes, 100);
+
+    eeprom_driver_flush();
+    EXPECT_EQ(driver_read_byte(5), 100);
+    EXPECT_EQ(eeprom_driver_cache_stats()->driver_writes, 1);
+    EXPECT_EQ(eeprom_driver_cache_stats()->bytes_flushed, 1);
+}
+
+TEST_F(EepromWriteBack, UpdateSkipsUnchangedValues) {
+    eeprom_update_byte((uint8_t *)5, 0);
+    EXPECT_FALSE(eeprom_driver_is_dirty());
+    EXPECT_EQ(eeprom_driver_cache_stats()->writes, 0);
+}
+
+TEST_F(EepromWriteBack, FlushesAfterIdleTimeout) {
+    eeprom_update_byte((uint8_t *)3, 0x55);
+
+    advance_time(EEPROM_WRITE_BACK_CACHE_TIMEOUT - 1);
+    eeprom_driver_task();
+    EXPECT_TRUE(eeprom_driver_is_dirty());
+
+    // Another write restarts the timeout
+    eeprom_update_byte((uint8_t *)4, 0x66);
+    advance_time(EEPROM_WRITE_BACK_CACHE_TIMEOUT - 1);
+    eeprom_driver_task();
+    EXPECT_TRUE(eeprom_driver_is_dirty());
+
+    advance_time(1);
+    eeprom_driver_task();
+    EXPECT_FALSE(eeprom_driver_is_dirty());
+    EXPECT_EQ(driver_read_byte(3), 0x55);
+    EXPECT_EQ(driver_read_byte(4), 0x66);
+    EXPECT_EQ(eeprom_driver_cache_stats()->driver_writes, 1) << "adjacent bytes were not written together";
+}
+
+TEST_F(EepromWriteBack, WritesEachDirtyRunOnce) {
+    eeprom_update_byte((uint8_t *)0, 1);
+    eeprom_update_byte((uint8_t *)2, 2);
+    eeprom_update_word((uint16_t *)6, 0x0403);
+    eeprom_update_byte((uint8_t *)8, 5);
+    eeprom_driver_flush();
+
+    EXPECT_EQ(eeprom_driver_cache_stats()->driver_writes, 3);
+    EXPECT_EQ(eeprom_driver_cache_stats()->bytes_flushed, 5);
+
+    uint8_t read[9];
+    driver_read(0, read, sizeof(read));
+    const uint8_t expected[] = {1, 0, 2, 0, 0, 0, 3, 4, 5};
+    EXPECT_EQ(0, memcmp(read, expected, sizeof(expected)));
+}
+
+TEST_F(EepromWriteBack, BlocksSpanningLines) {
+    std::array<uint8_t, 40> data;
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = 0x80 + i;
+    }
+    eeprom_update_block(data.data(), (void *)20, data.size());
+
+    std::array<uint8_t, 40> read;
+    eeprom_read_block(read.data(), (const void *)20, read.size());
+    EXPECT_EQ(read, data);
+
+    eeprom_driver_flush();
+    driver_read(20, read.data(), read.size());
+    EXPECT_EQ(read, data);
+    EXPECT_EQ(eeprom_driver_cache_stats()->driver_writes, 2);
+}
+
+TEST_F(EepromWriteBack, FlushesWhenOutOfLines) {
+    for (int line = 0; line <= EEPROM_WRITE_BACK_CACHE_LINES; line++) {
+        eeprom_update_byte((uint8_t *)(uintptr_t)(line * 32), line + 1);
+    }
+    EXPECT_EQ(eeprom_driver_cache_stats()->forced_flushes, 1);
+    EXPECT_TRUE(eeprom_driver_is_dirty());
+
+    eeprom_driver_flush();
+    for (int line = 0; line <= EEPROM_WRITE_BACK_CACHE_LINES; line++) {
+        EXPECT_EQ(driver_read_byte(line * 32), line + 1);
+    }
+}
+
+TEST_F(EepromWriteBack, DiscardDropsPendingWrites) {
+    eeprom_update_byte((uint8_t *)7, 0x42);
+    eeprom_driver_discard();
+
+    EXPECT_FALSE(eeprom_driver_is_dirty());
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)7), 0);
+    eeprom_driver_flush();
+    EXPECT_EQ(driver_read_byte(7), 0);
+}
+
+// Cycles through lighting modes and layers the way a user adjusting settings
+// would, comparing the driver work against writing every update through.
+TEST_F(EepromWriteBack, SettingsChurnWritesLess) {
+    auto churn = [](void (*update)(uintptr_t, const void *, size_t)) {
+        for (uint32_t i = 0; i < 200; i++) {
+            uint32_t rgblight = 0x00FF0000 | (i % 40);
+            uint8_t  layer    = 1 << (i % 4);
+            uint16_t keymap   = 0x1400 | (i & 1);
+            update(0x0C, &keymap, sizeof(keymap));
+            update(0x02, &layer, sizeof(layer));
+            update(0x08, &rgblight, sizeof(rgblight));
+        }
+    };
+
+    uint64_t start = backend_cost();
+    churn(uncached_update);
+    uint64_t uncached = backend_cost() - start;
+
+    SetUp();
+    start = backend_cost();
+    churn([](uintptr_t address, const void *buf, size_t len) { eeprom_update_block(buf, (void *)address, len); });
+    eeprom_driver_flush();
+    uint64_t cached = backend_cost() - start;
+
+    EXPECT_LT(cached, uncached);
+}
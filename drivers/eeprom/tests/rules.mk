@@ -0,0 +1,41 @@
+eeprom_write_back_common_DEFS := \
+	-DEEPROM_DRIVER \
+	-DEEPROM_WRITE_BACK_CACHE \
+	-DEEPROM_WRITE_BACK_CACHE_LINES=4
+eeprom_write_back_common_SRC := \
+	$(DRIVER_PATH)/eeprom/eeprom_driver.c \
+	$(DRIVER_PATH)/eeprom/tests/eeprom_write_back_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+eeprom_write_back_common_INC := \
+	$(DRIVER_PATH)/eeprom
+
+eeprom_write_back_transient_DEFS := \
+	$(eeprom_write_back_common_DEFS) \
+	-DEEPROM_TRANSIENT \
+	-DTRANSIENT_EEPROM_SIZE=256
+eeprom_write_back_transient_SRC := \
+	$(eeprom_write_back_common_SRC) \
+	$(DRIVER_PATH)/eeprom/eeprom_transient.c
+eeprom_write_back_transient_INC := \
+	$(eeprom_write_back_common_INC)
+
+eeprom_write_back_wear_leveling_DEFS := \
+	$(eeprom_write_back_common_DEFS) \
+	-DEEPROM_WEAR_LEVELING \
+	-DWEAR_LEVELING_TESTS \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=256
+eeprom_write_back_wear_leveling_SRC := \
+	$(eeprom_write_back_common_SRC) \
+	$(DRIVER_PATH)/eeprom/eeprom_wear_leveling.c \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(LIB_PATH)/fnv/hash_64a.c \
+	$(QUANTUM_PATH)/wear_leveling/wear_leveling.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/backing_mocks.cpp
+eeprom_write_back_wear_leveling_INC := \
+	$(eeprom_write_back_common_INC) \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/wear_leveling \
+	$(QUANTUM_PATH)/wear_leveling/tests
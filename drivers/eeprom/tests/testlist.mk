@@ -0,0 +1,3 @@
+TEST_LIST += \
+	eeprom_write_back_transient \
+	eeprom_write_back_wear_leveling
@@ -16,6 +16,7 @@
 
 #include "is31fl3218.h"
 #include "i2c_master.h"
+#include "led/register_diff.h"
 #include "gpio.h"
 
 #define IS31FL3218_PWM_REGISTER_COUNT 18
@@ -31,6 +32,7 @@
 
 typedef struct is31fl3218_driver_t {
     uint8_t pwm_buffer[IS31FL3218_PWM_REGISTER_COUNT];
+    uint8_t pwm_dirty[REGISTER_DIFF_SIZE(IS31FL3218_PWM_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3218_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
@@ -39,6 +41,7 @@ typedef struct is31fl3218_driver_t {
 // IS31FL3218 has 18 PWM outputs and a fixed I2C address, so no chaining.
 is31fl3218_driver_t driver_buffers = {
     .pwm_buffer               = {0},
+    .pwm_dirty                = {0},
     .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
@@ -55,13 +58,23 @@ void is31fl3218_write_register(uint8_t reg, uint8_t data) {
 }
 
 void is31fl3218_write_pwm_buffer(void) {
+    // Transmit only the changed PWM registers.
+    register_diff_span_t span = {0};
+
+    while (register_diff_next_span(driver_buffers.pwm_dirty, IS31FL3218_PWM_REGISTER_COUNT, IS31FL3218_PWM_REGISTER_COUNT, &span)) {
 #if IS31FL3218_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
+        for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
+            if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM + span.start, driver_buffers.pwm_buffer + span.start, span.length, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                register_diff_clear_span(driver_buffers.pwm_dirty, &span);
+                break;
+            }
+        }
 #else
-    i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT);
+        if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM + span.start, driver_buffers.pwm_buffer + span.start, span.length, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+            register_diff_clear_span(driver_buffers.pwm_dirty, &span);
+        }
 #endif
+    }
 }
 
 void is31fl3218_init(void) {
@@ -96,6 +109,10 @@ void is31fl3218_init(void) {
     }
 
     is31fl3218_update_led_control_registers();
+
+    // The buffer may no longer match the chip, for example when reinitialised at runtime, so send all of it on the next flush.
+    register_diff_mark_all(driver_buffers.pwm_dirty, IS31FL3218_PWM_REGISTER_COUNT);
+    driver_buffers.pwm_buffer_dirty = true;
 }
 
 void is31fl3218_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
@@ -108,10 +125,10 @@ void is31fl3218_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
             return;
         }
 
-        driver_buffers.pwm_buffer[led.r] = red;
-        driver_buffers.pwm_buffer[led.g] = green;
-        driver_buffers.pwm_buffer[led.b] = blue;
-        driver_buffers.pwm_buffer_dirty  = true;
+        register_diff_write(driver_buffers.pwm_buffer, driver_buffers.pwm_dirty, led.r, red);
+        register_diff_write(driver_buffers.pwm_buffer, driver_buffers.pwm_dirty, led.g, green);
+        register_diff_write(driver_buffers.pwm_buffer, driver_buffers.pwm_dirty, led.b, blue);
+        driver_buffers.pwm_buffer_dirty = true;
     }
 }
 
@@ -157,7 +174,8 @@ void is31fl3218_update_pwm_buffers(void) {
         // Load PWM registers and LED Control register data
         is31fl3218_write_register(IS31FL3218_REG_UPDATE, 0x01);
 
-        driver_buffers.pwm_buffer_dirty = false;
+        // Registers that failed to send are still dirty, try them again on the next flush
+        driver_buffers.pwm_buffer_dirty = register_diff_pending(driver_buffers.pwm_dirty, IS31FL3218_PWM_REGISTER_COUNT);
     }
 }
 
@@ -3,6 +3,7 @@
 
 #include "is31fl3236.h"
 #include "i2c_master.h"
+#include "led/register_diff.h"
 #include "gpio.h"
 
 #define IS31FL3236_PWM_REGISTER_COUNT 36
@@ -35,6 +36,7 @@ const uint8_t i2c_addresses[IS31FL3236_DRIVER_COUNT] = {
 
 typedef struct is31fl3236_driver_t {
     uint8_t pwm_buffer[IS31FL3236_PWM_REGISTER_COUNT];
+    uint8_t pwm_dirty[REGISTER_DIFF_SIZE(IS31FL3236_PWM_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3236_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
@@ -42,6 +44,7 @@ typedef struct is31fl3236_driver_t {
 
 is31fl3236_driver_t driver_buffers[IS31FL3236_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
+    .pwm_dirty                = {0},
     .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
@@ -58,13 +61,23 @@ void is31fl3236_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 }
 
 void is31fl3236_write_pwm_buffer(uint8_t index) {
+    // Transmit only the changed PWM registers.
+    register_diff_span_t span = {0};
+
+    while (register_diff_next_span(driver_buffers[index].pwm_dirty, IS31FL3236_PWM_REGISTER_COUNT, IS31FL3236_PWM_REGISTER_COUNT, &span)) {
 #if IS31FL3236_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
+        for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM + span.start, driver_buffers[index].pwm_buffer + span.start, span.length, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                register_diff_clear_span(driver_buffers[index].pwm_dirty, &span);
+                break;
+            }
+        }
 #else
-    i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT);
+        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM + span.start, driver_buffers[index].pwm_buffer + span.start, span.length, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+            register_diff_clear_span(driver_buffers[index].pwm_dirty, &span);
+        }
 #endif
+    }
 }
 
 void is31fl3236_init_drivers(void) {
@@ -110,6 +123,10 @@ void is31fl3236_init(uint8_t index) {
 
     // Load PWM registers and LED Control register data
     is31fl3236_write_register(index, IS31FL3236_REG_UPDATE, 0x01);
+
+    // The buffer may no longer match the chip, for example when reinitialised at runtime, so send all of it on the next flush.
+    register_diff_mark_all(driver_buffers[index].pwm_dirty, IS31FL3236_PWM_REGISTER_COUNT);
+    driver_buffers[index].pwm_buffer_dirty = true;
 }
 
 void is31fl3236_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
@@ -122,10 +139,10 @@ void is31fl3236_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
             return;
         }
 
-        driver_buffers[led.driver].pwm_buffer[led.r] = red;
-        driver_buffers[led.driver].pwm_buffer[led.g] = green;
-        driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.r, red);
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.g, green);
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.b, blue);
+        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -151,7 +168,8 @@ void is31fl3236_update_pwm_buffers(uint8_t index) {
         // Load PWM registers and LED Control register data
         is31fl3236_write_register(index, IS31FL3236_REG_UPDATE, 0x01);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        // Registers that failed to send are still dirty, try them again on the next flush
+        driver_buffers[index].pwm_buffer_dirty = register_diff_pending(driver_buffers[index].pwm_dirty, IS31FL3236_PWM_REGISTER_COUNT);
     }
 }
 
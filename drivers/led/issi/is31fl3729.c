@@ -18,6 +18,7 @@
 
 #include "is31fl3729.h"
 #include "i2c_master.h"
+#include "led/register_diff.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -81,6 +82,7 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
     uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
+    uint8_t pwm_dirty[REGISTER_DIFF_SIZE(IS31FL3729_PWM_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
@@ -88,6 +90,7 @@ typedef struct is31fl3729_driver_t {
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
+    .pwm_dirty            = {0},
     .pwm_buffer_dirty     = false,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
@@ -104,16 +107,21 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 }
 
 void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
+    // Transmit the changed PWM registers in transfers of up to 13 bytes.
+    register_diff_span_t span = {0};
 
-    // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
+    while (register_diff_next_span(driver_buffers[index].pwm_dirty, IS31FL3729_PWM_REGISTER_COUNT, 13, &span)) {
 #if IS31FL3729_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + span.start, driver_buffers[index].pwm_buffer + span.start, span.length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                register_diff_clear_span(driver_buffers[index].pwm_dirty, &span);
+                break;
+            }
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
+        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + span.start, driver_buffers[index].pwm_buffer + span.start, span.length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+            register_diff_clear_span(driver_buffers[index].pwm_dirty, &span);
+        }
 #endif
     }
 }
@@ -151,6 +159,10 @@ void is31fl3729_init(uint8_t index) {
     is31fl3729_write_register(index, IS31FL3729_REG_GLOBAL_CURRENT, IS31FL3729_GLOBAL_CURRENT);
     is31fl3729_write_register(index, IS31FL3729_REG_CONFIGURATION, IS31FL3729_CONFIGURATION);
 
+    // The PWM registers are not cleared here, so send all of them on the first flush.
+    register_diff_mark_all(driver_buffers[index].pwm_dirty, IS31FL3729_PWM_REGISTER_COUNT);
+    driver_buffers[index].pwm_buffer_dirty = true;
+
     // Wait 10ms to ensure the device has woken up.
     wait_ms(10);
 }
@@ -164,10 +176,10 @@ void is31fl3729_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
             return;
         }
 
-        driver_buffers[led.driver].pwm_buffer[led.r] = red;
-        driver_buffers[led.driver].pwm_buffer[led.g] = green;
-        driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.r, red);
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.g, green);
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.b, blue);
+        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -198,7 +210,8 @@ void is31fl3729_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3729_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        // Registers that failed to send are still dirty, try them again on the next flush
+        driver_buffers[index].pwm_buffer_dirty = register_diff_pending(driver_buffers[index].pwm_dirty, IS31FL3729_PWM_REGISTER_COUNT);
     }
 }
 
@@ -19,6 +19,7 @@
 
 #include "is31fl3731-mono.h"
 #include "i2c_master.h"
+#include "led/register_diff.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -48,11 +49,11 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 
 // These buffers match the IS31FL3731 PWM registers 0x24-0xB3.
 // Storing them like this is optimal for I2C transfers to the registers.
-// We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// is31fl3731_write_pwm_buffer() only sends the registers marked in the dirty bits.
+// Unused registers are only sent after init, which marks every register.
 typedef struct is31fl3731_driver_t {
     uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
+    uint8_t pwm_dirty[REGISTER_DIFF_SIZE(IS31FL3731_PWM_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
@@ -60,6 +61,7 @@ typedef struct is31fl3731_driver_t {
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
+    .pwm_dirty                = {0},
     .pwm_buffer_dirty         = false,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
@@ -81,16 +83,21 @@ void is31fl3731_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3731_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 9 transfers of 16 bytes.
+    // Transmit the changed PWM registers in transfers of up to 16 bytes.
+    register_diff_span_t span = {0};
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+    while (register_diff_next_span(driver_buffers[index].pwm_dirty, IS31FL3731_PWM_REGISTER_COUNT, 16, &span)) {
 #if IS31FL3731_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + span.start, driver_buffers[index].pwm_buffer + span.start, span.length, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                register_diff_clear_span(driver_buffers[index].pwm_dirty, &span);
+                break;
+            }
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
+        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + span.start, driver_buffers[index].pwm_buffer + span.start, span.length, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+            register_diff_clear_span(driver_buffers[index].pwm_dirty, &span);
+        }
 #endif
     }
 }
@@ -166,6 +173,10 @@ void is31fl3731_init(uint8_t index) {
     // most usage after initialization is just writing PWM buffers in page 0
     // as there's not much point in double-buffering
     is31fl3731_select_page(index, IS31FL3731_COMMAND_FRAME_1);
+
+    // The buffer may no longer match the chip, for example when reinitialised at runtime, so send all of it on the next flush.
+    register_diff_mark_all(driver_buffers[index].pwm_dirty, IS31FL3731_PWM_REGISTER_COUNT);
+    driver_buffers[index].pwm_buffer_dirty = true;
 }
 
 void is31fl3731_set_value(int index, uint8_t value) {
@@ -178,8 +189,8 @@ void is31fl3731_set_value(int index, uint8_t value) {
             return;
         }
 
-        driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        register_diff_write(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_dirty, led.v, value);
+        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -209,7 +220,8 @@ void is31fl3731_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3731_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        // Registers that failed to send are still dirty, try them again on the next flush
+        driver_buffers[index].pwm_buffer_dirty = register_diff_pending(driver_buffers[index].pwm_dirty, IS31FL3731_PWM_REGISTER_COUNT);
     }
 }
 
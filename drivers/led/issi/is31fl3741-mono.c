@@ -19,6 +19,7 @@
 
 #include "is31fl3741-mono.h"
 #include "i2c_master.h"
+#include "led/register_diff.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -71,12 +72,13 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // These buffers match the IS31FL3741 and IS31FL3741A PWM registers.
 // The scaling buffers match the page 2 and 3 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
-// We could optimize this and take out the unused registers from these
-// buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// is31fl3741_write_pwm_buffer() only sends the registers marked in the dirty bits.
+// Unused registers are only sent after init, which marks every register.
 typedef struct is31fl3741_driver_t {
     uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
     uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    uint8_t pwm_dirty_0[REGISTER_DIFF_SIZE(IS31FL3741_PWM_0_REGISTER_COUNT)];
+    uint8_t pwm_dirty_1[REGISTER_DIFF_SIZE(IS31FL3741_PWM_1_REGISTER_COUNT)];
     bool    pwm_buffer_dirty;
     uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
     uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
@@ -86,6 +88,8 @@ typedef struct is31fl3741_driver_t {
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
+    .pwm_dirty_0          = {0},
+    .pwm_dirty_1          = {0},
     .pwm_buffer_dirty     = false,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
@@ -108,34 +112,49 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
 }
 
 void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+    register_diff_span_t span = {0};
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    // Transmit the changed PWM0 registers in transfers of up to 30 bytes,
+    // only selecting the page if there are any.
+    if (register_diff_next_span(driver_buffers[index].pwm_dirty_0, IS31FL3741_PWM_0_REGISTER_COUNT, 30, &span)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
+        do {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+            for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+                if (i2c_write_register(i2c_addresses[index] << 1, span.start, driver_buffers[index].pwm_buffer_0 + span.start, span.length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                    register_diff_clear_span(driver_buffers[index].pwm_dirty_0, &span);
+                    break;
+                }
+            }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+            if (i2c_write_register(i2c_addresses[index] << 1, span.start, driver_buffers[index].pwm_buffer_0 + span.start, span.length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                register_diff_clear_span(driver_buffers[index].pwm_dirty_0, &span);
+            }
 #endif
+        } while (register_diff_next_span(driver_buffers[index].pwm_dirty_0, IS31FL3741_PWM_0_REGISTER_COUNT, 30, &span));
     }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+    span = (register_diff_span_t){0};
 
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
+    // Transmit the changed PWM1 registers in transfers of up to 19 bytes.
+    if (register_diff_next_span(driver_buffers[index].pwm_dirty_1, IS31FL3741_PWM_1_REGISTER_COUNT, 19, &span)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
+        do {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+            for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+                if (i2c_write_register(i2c_addresses[index] << 1, span.start, driver_buffers[index].pwm_buffer_1 + span.start, span.length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                    register_diff_clear_span(driver_buffers[index].pwm_dirty_1, &span);
+                    break;
+                }
+            }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+            if (i2c_write_register(i2c_addresses[index] << 1, span.start, driver_buffers[index].pwm_buffer_1 + span.start, span.length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) {
+                register_diff_clear_span(driver_buffers[index].pwm_dirty_1, &span);
+            }
 #endif
+        } while (register_diff_next_span(driver_buffers[index].pwm_dirty_1, IS31FL3741_PWM_1_REGISTER_COUNT, 19, &span));
     }
 }
 
@@ -181,6 +200,11 @@ void is31fl3741_init(uint8_t index) {
 
     // is31fl3741_update_led_scaling_registers(index, 0xFF, 0xFF, 0xFF);
 
+    // The PWM registers are not cleared here, so send all of them on the first flush.
+    register_diff_mark_all(driver_buffers[index].pwm_dirty_0, IS31FL3741_PWM_0_REGISTER_COUNT);
+    register_diff_mark_all(driver_buffers[index].pwm_dirty_1, IS31FL3741_PWM_1_REGISTER_COUNT);
+    driver_buffers[index].pwm_buffer_dirty = true;
+
     // Wait 10ms to ensure the device has woken up.
     wait_ms(10);
 }
@@ -195,9 +219,9 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
-        driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        register_diff_write(driver_buffers[driver].pwm_buffer_1, driver_buffers[driver].pwm_dirty_1, reg & 0xFF, value);
     } else {
-        driver_buffers[driver].pwm_buffer_0[reg] = value;
+        register_diff_write(driver_buffers[driver].pwm_buffer_0, driver_buffers[driver].pwm_dirty_0, reg, value);
     }
 }
 
@@ -243,7 +267,8 @@ void is31fl3741_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3741_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        // Registers that failed to send are still dirty, try them again on the next flush
+        driver_buffers[index].pwm_buffer_dirty = register_diff_pending(driver_buffers[index].pwm_dirty_0, IS31FL3741_PWM_0_REGISTER_COUNT) || register_diff_pending(driver_buffers[index].pwm_dirty_1, IS31FL3741_PWM_1_REGISTER_COUNT);
     }
 }
 
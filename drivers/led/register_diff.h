@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Tracks which registers of an LED driver's buffer changed since they were
+// last sent, so a flush can transmit only those, in as few bursts as possible.
+//
+// The driver buffer holds the values the chip should end up with. Alongside it
+// is one dirty bit per register, set by register_diff_write() when a value
+// actually changes. Together they behave like a shadow copy of what was last
+// sent, at an eighth of the RAM.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Clean registers between two dirty ones that are sent along rather than
+// starting a new transfer. Each transfer costs the device address and the
+// register address on top of its data, plus a start and stop condition.
+#ifndef REGISTER_DIFF_MERGE_GAP
+#    define REGISTER_DIFF_MERGE_GAP 2
+#endif
+
+#define REGISTER_DIFF_SIZE(count) (((count) + 7) / 8)
+
+typedef struct {
+    uint16_t start;
+    uint16_t length;
+} register_diff_span_t;
+
+static inline void register_diff_mark(uint8_t *dirty, uint16_t reg) {
+    dirty[reg / 8] |= 1 << (reg % 8);
+}
+
+// Bits past the last register are set too, and ignored.
+static inline void register_diff_mark_all(uint8_t *dirty, uint16_t count) {
+    memset(dirty, 0xFF, REGISTER_DIFF_SIZE(count));
+}
+
+/**
+ * \brief Store a register value in the buffer, marking it dirty if it changed.
+ *
+ * \return true if the value changed
+ */
+static inline bool register_diff_write(uint8_t *buffer, uint8_t *dirty, uint16_t reg, uint8_t value) {
+    if (buffer[reg] == value) {
+        return false;
+    }
+    buffer[reg] = value;
+    register_diff_mark(dirty, reg);
+    return true;
+}
+
+/**
+ * \brief Find the next span of registers to transmit.
+ *
+ * The dirty bits are left alone, so that a span that fails to send is tried
+ * again on the next flush. Clear them once the transfer succeeded. Start with
+ * a zeroed span; it carries the position from one call to the next:
+ *
+ *     register_diff_span_t span = {0};
+ *     while (register_diff_next_span(dirty, count, 16, &span)) {
+ *         // transmit span.length registers starting at span.start, then
+ *         register_diff_clear_span(dirty, &span);
+ *     }
+ *
+ * \param dirty the dirty bits, REGISTER_DIFF_SIZE(count) bytes
+ * \param count the number of registers in the buffer
+ * \param max_length the longest burst the driver sends in one transfer
+ * \param span the previous span, updated with the next one
+ * \return false once no dirty registers are left
+ */
+static inline bool register_diff_next_span(const uint8_t *dirty, uint16_t count, uint16_t max_length, register_diff_span_t *span) {
+    uint16_t reg = span->start + span->length;
+
+    // Skip clean registers, the rest of a byte at a time when it has no bits left
+    while (reg < count) {
+        uint8_t bits = dirty[reg / 8] >> (reg % 8);
+        if (bits & 1) {
+            break;
+        }
+        reg = bits ? reg + 1 : (reg / 8 + 1) * 8;
+    }
+    if (reg >= count) {
+        return false;
+    }
+
+    uint16_t end   = reg;
+    uint16_t limit = count - reg < max_length ? count : reg + max_length;
+    span->start    = reg;
+    for (; reg < limit; reg++) {
+        if (dirty[reg / 8] & (1 << (reg % 8))) {
+            end = reg + 1;
+        } else if (reg - end >= REGISTER_DIFF_MERGE_GAP) {
+            break;
+        }
+    }
+    span->length = end - span->start;
+    return true;
+}
+
+// Marks the registers of a span as sent.
+static inline void register_diff_clear_span(uint8_t *dirty, const register_diff_span_t *span) {
+    for (uint16_t reg = span->start; reg < span->start + span->length; reg++) {
+        dirty[reg / 8] &= ~(1 << (reg % 8));
+    }
+}
+
+// True while any register is still waiting to be sent.
+static inline bool register_diff_pending(const uint8_t *dirty, uint16_t count) {
+    for (uint16_t reg = 0; reg < count; reg += 8) {
+        uint8_t bits = dirty[reg / 8];
+        if (count - reg < 8) {
+            bits &= (1 << (count - reg)) - 1;
+        }
+        if (bits) {
+            return true;
+        }
+    }
+    return false;
+}
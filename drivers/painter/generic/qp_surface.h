@@ -21,6 +21,23 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_REGIONS
+/**
+ * @def This controls the maximum number of separate dirty regions tracked by each surface.
+ *      Each region is transferred to the target device with its own viewport, so that changes in opposite corners
+ *      don't require everything in between to be sent as well.
+ */
+#    define SURFACE_DIRTY_REGIONS 4
+#endif
+
+#ifndef SURFACE_DIRTY_MERGE_PIXELS
+/**
+ * @def This controls how many unchanged pixels a dirty region may absorb when growing or merging with another,
+ *      instead of a new region being started. Roughly the cost of setting up an extra viewport on the target device.
+ */
+#    define SURFACE_DIRTY_MERGE_PIXELS 64
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -64,4 +81,16 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Supplies a buffer used to remember what was last drawn to the target device.
+ *
+ * Pixels which have been redrawn with the same value since the last transfer are then skipped. The shadow is only
+ * trusted after a transfer of the entire surface, and assumes the surface is always drawn to the same target location.
+ *
+ * @param surface[in] the surface to attach the buffer to
+ * @param shadow_buffer[in] pointer to a preallocated uint8_t buffer the same size as the surface's buffer, or NULL to disable
+ * @return whether the buffer was accepted
+ */
+bool qp_surface_set_shadow_buffer(painter_device_t surface, void *shadow_buffer);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -49,6 +49,84 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
     }
 }
 
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static inline surface_dirty_rect_t dirty_rect_union(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (surface_dirty_rect_t){
+        .l = MIN(a->l, b->l),
+        .t = MIN(a->t, b->t),
+        .r = MAX(a->r, b->r),
+        .b = MAX(a->b, b->b),
+    };
+}
+
+// Folds any other region into the one at `index` when the combined area wastes few enough pixels
+static void dirty_regions_merge_into(surface_dirty_regions_t *regions, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < regions->count; ++i) {
+            if (i == index) {
+                continue;
+            }
+            surface_dirty_rect_t combined = dirty_rect_union(&regions->rects[index], &regions->rects[i]);
+            if (dirty_rect_area(&combined) > dirty_rect_area(&regions->rects[index]) + dirty_rect_area(&regions->rects[i]) + SURFACE_DIRTY_MERGE_PIXELS) {
+                continue;
+            }
+
+            // Keep the merged region, and fill the gap from the end of the list
+            regions->rects[index] = combined;
+            regions->count--;
+            if (i != regions->count) {
+                regions->rects[i] = regions->rects[regions->count];
+                if (index == regions->count) {
+                    index = i;
+                }
+            }
+            merged = true;
+            break;
+        }
+    } while (merged);
+    regions->last = index;
+}
+
+void qp_surface_update_dirty_regions(surface_dirty_regions_t *regions, uint16_t x, uint16_t y) {
+    // Drawing tends to stay within the same area, so check the last one first
+    surface_dirty_rect_t *last = &regions->rects[regions->last];
+    if (regions->count > 0 && x >= last->l && x <= last->r && y >= last->t && y <= last->b) {
+        return;
+    }
+
+    // Find the region which would grow the least to include the pixel
+    surface_dirty_rect_t pixel     = {.l = x, .t = y, .r = x, .b = y};
+    uint8_t              best      = 0;
+    uint32_t             best_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < regions->count; ++i) {
+        surface_dirty_rect_t grown = dirty_rect_union(&regions->rects[i], &pixel);
+        uint32_t             cost  = dirty_rect_area(&grown) - dirty_rect_area(&regions->rects[i]);
+        if (cost == 0) {
+            regions->last = i;
+            return;
+        }
+        if (cost < best_cost) {
+            best      = i;
+            best_cost = cost;
+        }
+    }
+
+    // Start a new region if growing an existing one would send too many unchanged pixels
+    if (best_cost > SURFACE_DIRTY_MERGE_PIXELS && regions->count < SURFACE_DIRTY_REGIONS) {
+        regions->rects[regions->count] = pixel;
+        regions->last                  = regions->count++;
+        return;
+    }
+
+    regions->rects[best] = dirty_rect_union(&regions->rects[best], &pixel);
+    dirty_regions_merge_into(regions, best);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver vtable
 
@@ -63,6 +141,13 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    surface->dirty_regions.count    = 1;
+    surface->dirty_regions.last     = 0;
+    surface->dirty_regions.rects[0] = (surface_dirty_rect_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
+
+    // The target's contents are unknown until the whole surface has been transferred
+    surface->shadow_valid = false;
+
     return true;
 }
 
@@ -83,6 +168,8 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    surface->dirty_regions.count        = 0;
+    surface->dirty_regions.last         = 0;
     return true;
 }
 
@@ -139,3 +226,18 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     qp_dprintf("qp_surface_draw: ok\n");
     return true;
 }
+
+bool qp_surface_set_shadow_buffer(painter_device_t surface, void *shadow_buffer) {
+    painter_driver_t *        surface_driver = (painter_driver_t *)surface;
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    // Only RGB565 surfaces can be transferred to other devices
+    if (surface_driver->native_bits_per_pixel != 16) {
+        qp_dprintf("qp_surface_set_shadow_buffer: fail (unsupported bpp: %d)\n", (int)surface_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    surface_handle->shadow       = shadow_buffer;
+    surface_handle->shadow_valid = false;
+    return true;
+}
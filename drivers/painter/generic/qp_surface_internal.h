@@ -24,6 +24,19 @@ typedef struct surface_dirty_data_t {
     uint16_t b;
 } surface_dirty_data_t;
 
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
+typedef struct surface_dirty_regions_t {
+    uint8_t              count;
+    uint8_t              last; // the region most recently drawn into, checked first
+    surface_dirty_rect_t rects[SURFACE_DIRTY_REGIONS];
+} surface_dirty_regions_t;
+
 typedef struct surface_viewport_data_t {
     // Manually manage the viewport for streaming pixel data to the display
     uint16_t viewport_l;
@@ -52,6 +65,16 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // The separate areas making up the dirty region, transferred individually
+    surface_dirty_regions_t dirty_regions;
+
+    // Optional copy of what was last transferred, used to skip pixels which were redrawn with the same value
+    union {
+        void *    shadow;
+        uint16_t *u16shadow;
+    };
+    bool shadow_valid;
 } surface_painter_device_t;
 
 /**
@@ -89,6 +112,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_update_dirty_regions(surface_dirty_regions_t *regions, uint16_t x, uint16_t y);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -24,6 +24,7 @@ static inline void setpixel_rgb565(surface_painter_device_t *surface, uint16_t x
     if (surface->u16buffer[y * w + x] != rgb565) {
         // Update the dirty region
         qp_surface_update_dirty(&surface->dirty, x, y);
+        qp_surface_update_dirty_regions(&surface->dirty_regions, x, y);
 
         // Update the pixel data in the buffer
         surface->u16buffer[y * w + x] = rgb565;
@@ -68,13 +69,34 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+// Shrinks the region to the pixels which differ from what was last transferred, returning false if there are none
+static bool rgb565_shadow_shrink(surface_painter_device_t *surface, surface_dirty_rect_t *rect) {
+    uint16_t w = surface->base.panel_width;
+    uint16_t l = UINT16_MAX, t = UINT16_MAX, r = 0, b = 0;
+    for (uint16_t y = rect->t; y <= rect->b; ++y) {
+        for (uint16_t x = rect->l; x <= rect->r; ++x) {
+            if (surface->u16buffer[y * w + x] != surface->u16shadow[y * w + x]) {
+                l = MIN(l, x);
+                r = MAX(r, x);
+                t = MIN(t, y);
+                b = y;
+            }
+        }
+    }
+    if (l > r) {
+        return false;
+    }
+    *rect = (surface_dirty_rect_t){.l = l, .t = t, .r = r, .b = b};
+    return true;
+}
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+static bool rgb565_target_pixdata_transfer_rect(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_rect_t *rect) {
+    painter_driver_t *surface_driver = &surface_handle->base;
+
+    uint16_t l = rect->l;
+    uint16_t t = rect->t;
+    uint16_t r = rect->r;
+    uint16_t b = rect->b;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
@@ -116,6 +138,43 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
         }
     }
 
+    // Remember what the target now contains
+    if (surface_handle->shadow) {
+        for (uint16_t y = t; y <= b; ++y) {
+            uint32_t offset = (uint32_t)y * surface_handle->base.panel_width + l;
+            memcpy(&surface_handle->u16shadow[offset], &surface_handle->u16buffer[offset], (r - l + 1) * sizeof(uint16_t));
+        }
+    }
+
+    return true;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    surface_dirty_rect_t      entire         = {.l = 0, .t = 0, .r = surface_handle->base.panel_width - 1, .b = surface_handle->base.panel_height - 1};
+
+    if (entire_surface) {
+        if (!rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, &entire)) {
+            return false;
+        }
+        surface_handle->shadow_valid = surface_handle->shadow != NULL;
+        return true;
+    }
+
+    // Send each dirty region separately
+    for (uint8_t i = 0; i < surface_handle->dirty_regions.count; ++i) {
+        surface_dirty_rect_t rect = surface_handle->dirty_regions.rects[i];
+        if (surface_handle->shadow_valid && !rgb565_shadow_shrink(surface_handle, &rect)) {
+            continue;
+        }
+        if (!rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, &rect)) {
+            return false;
+        }
+        if (surface_handle->shadow && memcmp(&rect, &entire, sizeof(rect)) == 0) {
+            surface_handle->shadow_valid = true;
+        }
+    }
+
     return true;
 }
 
@@ -0,0 +1,23 @@
+ws2812_encode_common_SRC := \
+	$(DRIVER_PATH)/tests/ws2812_encode_tests.cpp
+
+ws2812_encode_grb_DEFS := \
+	-DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_GRB
+ws2812_encode_grb_SRC := \
+	$(ws2812_encode_common_SRC)
+
+ws2812_encode_rgb_DEFS := \
+	-DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_RGB
+ws2812_encode_rgb_SRC := \
+	$(ws2812_encode_common_SRC)
+
+ws2812_encode_bgr_DEFS := \
+	-DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_BGR
+ws2812_encode_bgr_SRC := \
+	$(ws2812_encode_common_SRC)
+
+ws2812_encode_rgbw_DEFS := \
+	-DWS2812_BYTE_ORDER=WS2812_BYTE_ORDER_GRB \
+	-DWS2812_RGBW
+ws2812_encode_rgbw_SRC := \
+	$(ws2812_encode_common_SRC)
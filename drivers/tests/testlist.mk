@@ -0,0 +1,5 @@
+TEST_LIST += \
+	ws2812_encode_grb \
+	ws2812_encode_rgb \
+	ws2812_encode_bgr \
+	ws2812_encode_rgbw
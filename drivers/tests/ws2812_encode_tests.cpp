@@ -0,0 +1,147 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "ws2812_encode.h"
+}
+
+namespace {
+
+#ifdef WS2812_RGBW
+constexpr uint8_t channels = 4;
+#else
+constexpr uint8_t channels = 3;
+#endif
+
+// The bytes of an LED in the order WS2812_BYTE_ORDER puts them on the wire
+std::vector<uint8_t> wire_bytes(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
+    std::vector<uint8_t> bytes = {g, r, b};
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
+    std::vector<uint8_t> bytes = {r, g, b};
+#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
+    std::vector<uint8_t> bytes = {b, g, r};
+#endif
+#ifdef WS2812_RGBW
+    bytes.push_back(w);
+#else
+    (void)w;
+#endif
+    return bytes;
+}
+
+std::vector<rgb_led_t> test_leds(uint16_t count) {
+    std::vector<rgb_led_t> leds(count);
+    for (uint16_t i = 0; i < count; i++) {
+        leds[i].r = i * 7;
+        leds[i].g = i * 13 + 1;
+        leds[i].b = i * 29 + 2;
+#ifdef WS2812_RGBW
+        leds[i].w = i * 31 + 3;
+#endif
+    }
+    return leds;
+}
+
+// The encoding as it was before the lookup table, two bits per call
+uint8_t reference_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+// Reads the data bits back from SPI bytes, as the LED would
+std::vector<uint8_t> decode_spi(const std::vector<uint8_t> &spi) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i < spi.size(); i += WS2812_SPI_BYTES_PER_BYTE) {
+        uint8_t byte = 0;
+        for (size_t j = 0; j < WS2812_SPI_BYTES_PER_BYTE; j++) {
+            for (uint8_t nibble : {spi[i + j] >> 4, spi[i + j] & 0x0F}) {
+                EXPECT_TRUE(nibble == 0b1110 || nibble == 0b1000) << "at byte " << i + j;
+                byte = byte << 1 | (nibble == 0b1110);
+            }
+        }
+        bytes.push_back(byte);
+    }
+    return bytes;
+}
+
+template <typename T>
+void check_pwm(void) {
+    constexpr uint32_t zero = 7, one = sizeof(T) == 1 ? 200 : 60000;
+    auto               leds = test_leds(20);
+    std::vector<T>     buffer(leds.size() * channels * 8 + 1, 0xAA);
+
+    ws2812_encode_pwm(buffer.data(), sizeof(T), (const uint8_t *)leds.data(), leds.size() * sizeof(rgb_led_t), zero, one);
+
+    for (size_t led = 0; led < leds.size(); led++) {
+#ifdef WS2812_RGBW
+        auto expected = wire_bytes(leds[led].r, leds[led].g, leds[led].b, leds[led].w);
+#else
+        auto expected = wire_bytes(leds[led].r, leds[led].g, leds[led].b, 0);
+#endif
+        for (uint8_t byte = 0; byte < channels; byte++) {
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                size_t index = (led * channels + byte) * 8 + bit;
+                EXPECT_EQ(buffer[index], (expected[byte] & (0x80 >> bit)) ? one : zero) << "led " << led << " byte " << +byte << " bit " << +bit;
+            }
+        }
+    }
+    EXPECT_EQ(buffer.back(), 0xAA) << "wrote past the end";
+}
+
+} // namespace
+
+TEST(Ws2812Encode, LedsArePackedInWireOrder) {
+    EXPECT_EQ(sizeof(rgb_led_t), channels);
+}
+
+TEST(Ws2812Encode, SpiMatchesReferenceForAllBytes) {
+    for (int data = 0; data < 256; data++) {
+        uint8_t byte   = data;
+        uint8_t out[5] = {0, 0, 0, 0, 0x55};
+
+        EXPECT_EQ(ws2812_encode_spi(out, &byte, 1), out + WS2812_SPI_BYTES_PER_BYTE);
+        for (int pos = 0; pos < WS2812_SPI_BYTES_PER_BYTE; pos++) {
+            EXPECT_EQ(out[pos], reference_protocol_eq(byte, pos)) << "data " << data << " pos " << pos;
+        }
+        EXPECT_EQ(out[4], 0x55) << "wrote past the end";
+    }
+}
+
+TEST(Ws2812Encode, SpiLedsDecodeInByteOrder) {
+    auto                 leds = test_leds(50);
+    std::vector<uint8_t> spi(leds.size() * channels * WS2812_SPI_BYTES_PER_BYTE + 1, 0x55);
+
+    uint8_t *end = ws2812_encode_spi_leds(spi.data(), leds.data(), leds.size());
+    EXPECT_EQ(end, spi.data() + spi.size() - 1);
+    EXPECT_EQ(spi.back(), 0x55) << "wrote past the end";
+    spi.pop_back();
+
+    std::vector<uint8_t> expected;
+    for (auto &led : leds) {
+#ifdef WS2812_RGBW
+        auto bytes = wire_bytes(led.r, led.g, led.b, led.w);
+#else
+        auto bytes = wire_bytes(led.r, led.g, led.b, 0);
+#endif
+        expected.insert(expected.end(), bytes.begin(), bytes.end());
+    }
+    EXPECT_EQ(decode_spi(spi), expected);
+}
+
+TEST(Ws2812Encode, PwmDutyCyclesInByteOrder) {
+    check_pwm<uint8_t>();
+    check_pwm<uint16_t>();
+    check_pwm<uint32_t>();
+}
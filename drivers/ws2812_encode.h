@@ -0,0 +1,84 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Encodes LED data into the waveform buffers that the DMA based WS2812 drivers
+// stream out, a whole strip at a time.
+//
+// rgb_led_t is packed with its fields declared in WS2812_BYTE_ORDER, followed
+// by white for RGBW, so an array of them already holds the bytes in the order
+// they go on the wire. The encoders only have to expand each bit, most
+// significant first.
+
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+/*
+ * SPI: each data bit is sent as four SPI bits, 1110 for a one and 1000 for a
+ * zero, so every byte of LED data takes four bytes of SPI data.
+ */
+#define WS2812_SPI_BYTES_PER_BYTE 4
+
+// The two SPI bytes for each nibble of LED data
+static const uint8_t ws2812_spi_nibbles[16][2] = {
+    {0x88, 0x88}, {0x88, 0x8E}, {0x88, 0xE8}, {0x88, 0xEE}, {0x8E, 0x88}, {0x8E, 0x8E}, {0x8E, 0xE8}, {0x8E, 0xEE},
+    {0xE8, 0x88}, {0xE8, 0x8E}, {0xE8, 0xE8}, {0xE8, 0xEE}, {0xEE, 0x88}, {0xEE, 0x8E}, {0xEE, 0xE8}, {0xEE, 0xEE},
+};
+
+/**
+ * \brief Encode LED data as SPI bytes.
+ *
+ * \param out the SPI buffer, WS2812_SPI_BYTES_PER_BYTE bytes per byte of data
+ * \param data the bytes to send, in wire order
+ * \param length the number of bytes to send
+ * \return the end of the encoded data in `out`
+ */
+static inline uint8_t *ws2812_encode_spi(uint8_t *out, const uint8_t *data, uint16_t length) {
+    for (const uint8_t *end = data + length; data < end; data++) {
+        const uint8_t *high = ws2812_spi_nibbles[*data >> 4];
+        const uint8_t *low  = ws2812_spi_nibbles[*data & 0x0F];
+
+        *out++ = high[0];
+        *out++ = high[1];
+        *out++ = low[0];
+        *out++ = low[1];
+    }
+    return out;
+}
+
+static inline uint8_t *ws2812_encode_spi_leds(uint8_t *out, const rgb_led_t *leds, uint16_t count) {
+    return ws2812_encode_spi(out, (const uint8_t *)leds, count * sizeof(rgb_led_t));
+}
+
+/**
+ * \brief Encode LED data as one PWM duty cycle per bit.
+ *
+ * The buffer element size depends on the timer and DMA controller, so it is
+ * passed in; once inlined with a constant `width` only one branch is left.
+ *
+ * \param out the duty cycle buffer, 8 elements per byte of data
+ * \param width the size of a buffer element: 1, 2 or 4
+ * \param data the bytes to send, in wire order
+ * \param length the number of bytes to send
+ * \param zero the duty cycle of a zero bit
+ * \param one the duty cycle of a one bit
+ */
+static inline void ws2812_encode_pwm(void *out, uint8_t width, const uint8_t *data, uint16_t length, uint32_t zero, uint32_t one) {
+    for (uint32_t index = 0; length; length--, data++) {
+        for (uint8_t mask = 0x80; mask; mask >>= 1, index++) {
+            uint32_t duty = (*data & mask) ? one : zero;
+            switch (width) {
+                case 1:
+                    ((uint8_t *)out)[index] = duty;
+                    break;
+                case 2:
+                    ((uint16_t *)out)[index] = duty;
+                    break;
+                default:
+                    ((uint32_t *)out)[index] = duty;
+                    break;
+            }
+        }
+    }
+}
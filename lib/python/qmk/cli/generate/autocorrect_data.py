@@ -43,6 +43,9 @@ KC_A = 4
 KC_SPC = 0x2c
 KC_QUOT = 0x34
 
+# Symbol numbering used by the DAWG format, see docs/features/autocorrect.md
+DAWG_SYMBOLS = 'abcdefghijklmnopqrstuvwxyz\':'
+
 TYPO_CHARS = dict([
     ("'", KC_QUOT),
     (':', KC_SPC),  # "Word break" character.
@@ -79,7 +82,7 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         correct_words = ('information', 'available', 'international', 'language', 'loosest', 'reference', 'wealthier', 'entertainment', 'association', 'provides', 'technology', 'statehood')
 
     autocorrections = []
-    typos = set()
+    typos = {}
     for line_number, typo, correction in parse_file_lines(file_name):
         if typo in typos:
             cli.log.warning('{fg_red}Error:%d:{fg_reset} Ignoring duplicate typo: "{fg_cyan}%s{fg_reset}"', line_number, typo)
@@ -89,10 +92,6 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         if not (all([c in TYPO_CHARS for c in typo])):
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" has characters other than a-z, \' and :.', line_number, typo)
             sys.exit(1)
-        for other_typo in typos:
-            if typo in other_typo or other_typo in typo:
-                cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
-                sys.exit(1)
         if len(typo) < 5:
             cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} It is suggested that typos are at least 5 characters long to avoid false triggers: "{fg_cyan}%s{fg_reset}"', line_number, typo)
         if len(typo) > 127:
@@ -102,7 +101,16 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         check_typo_against_dictionary(typo, line_number, correct_words)
 
         autocorrections.append((typo, correction))
-        typos.add(typo)
+        typos[typo] = line_number
+
+    # Looking up every substring keeps this linear in the number of typos, so that large dictionaries are practical
+    for typo, line_number in typos.items():
+        for start in range(len(typo)):
+            for end in range(start + 1, len(typo) + 1):
+                other_typo = typo[start:end]
+                if other_typo != typo and other_typo in typos:
+                    cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
+                    sys.exit(1)
 
     return autocorrections
 
@@ -232,6 +240,127 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def make_dawg_edit(typo: str, correction: str) -> Tuple[int, int, str]:
+    """Describes a correction relative to the start of the typo, so that it doesn't depend on how the typo ends.
+  Args:
+    typo: String, the typo including any word boundaries.
+    correction: String, what it should be replaced with.
+  Returns:
+    Tuple of the number of typo characters kept, the number deleted after those, and the text inserted in their place.
+  """
+    # The last letter of a typo isn't typed yet when it's matched, so can't be kept unless followed by a word break
+    limit = len(typo.strip(':')) - (typo[-1] != ':')
+    typo = typo.strip(':')
+    keep = 0
+    while keep < min(limit, len(correction)) and typo[keep] == correction[keep]:
+        keep += 1
+    same = 0
+    while same < min(len(typo), len(correction)) - keep and typo[-1 - same] == correction[-1 - same]:
+        same += 1
+    return keep, len(typo) - keep - same, correction[keep:len(correction) - same]
+
+
+def serialize_dawg(trie: Dict[str, Any]) -> Tuple[List[int], int]:
+    """Minimizes the trie into a DAWG and serializes it in a form readable by the C code.
+  Args:
+    trie: Dict of dicts, as made by make_trie().
+  Returns:
+    List of ints in the range 0-255, and the number of bytes used by each node link.
+  """
+    # Merge identical subtrees, bottom up. As edits are relative to the start of a typo, typos differing only in their
+    # endings share everything from the point the endings are matched.
+    nodes = []
+    unique = {}
+
+    def minimize(trie_node):
+        if 'LEAF' in trie_node:
+            typo, correction = trie_node['LEAF']
+            keep, delete, insert = make_dawg_edit(typo, correction)
+            backspaces = len(typo.strip(':')) - keep - 1 + (typo[-1] == ':')
+            if not (0 <= backspaces <= 63 and keep <= 255 and delete <= 127):
+                cli.log.error('{fg_red}Error:{fg_reset} The correction for "{fg_cyan}%s{fg_reset}" is too long.', typo)
+                sys.exit(1)
+            key = ('LEAF', keep, delete, insert)
+        else:
+            key = tuple((DAWG_SYMBOLS.index(c), minimize(child)) for c, child in sorted(trie_node.items(), key=lambda e: DAWG_SYMBOLS.index(e[0])))
+        if key not in unique:
+            unique[key] = len(nodes)
+            nodes.append(key)
+        return unique[key]
+
+    root = minimize(trie)
+
+    def node_size(key, chained, link_bytes):
+        if key[0] == 'LEAF':
+            return 2 + len(key[3]) + 1
+        elif len(key) == 1:
+            return 1 if chained else 1 + link_bytes
+        elif len(key) <= 4:
+            return 1 + len(key) * (1 + link_bytes)
+        return 4 + len(key) * link_bytes
+
+    # Lay nodes out depth first, so that chains of single-child nodes can mostly run on without links
+    order = []
+    chained = set()
+    placed = set()
+
+    def place(index):
+        while index not in placed:
+            placed.add(index)
+            order.append(index)
+            key = nodes[index]
+            if key[0] == 'LEAF':
+                return
+            if len(key) == 1:
+                child = key[0][1]
+                if child not in placed:
+                    chained.add(index)
+                index = child
+                continue
+            for _, child in key:
+                place(child)
+            return
+
+    place(root)
+
+    for link_bytes in (2, 3):
+        offsets = {}
+        size = 0
+        for index in order:
+            offsets[index] = size
+            size += node_size(nodes[index], index in chained, link_bytes)
+        if size < (1 << (8 * link_bytes)):
+            break
+    else:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, exceeding 16MB.')
+        sys.exit(1)
+
+    def link(index):
+        return [(offsets[index] >> (8 * n)) & 0xFF for n in range(link_bytes)]
+
+    data = []
+    for index in order:
+        key = nodes[index]
+        if key[0] == 'LEAF':
+            _, keep, delete, insert = key
+            data += [0x80 | delete, keep] + list(bytes(insert, 'ascii')) + [0]
+        elif len(key) == 1:
+            symbol, child = key[0]
+            data += [symbol] if index in chained else [0x20 | symbol] + link(child)
+        elif len(key) <= 4:
+            data += [0x40 | len(key)] + [symbol for symbol, _ in key]
+            for _, child in key:
+                data += link(child)
+        else:
+            bitmap = sum(1 << symbol for symbol, _ in key)
+            data += [0x60 | (bitmap >> 24), bitmap & 0xFF, (bitmap >> 8) & 0xFF, (bitmap >> 16) & 0xFF]
+            for _, child in key:
+                data += link(child)
+
+    assert offsets[root] == 0 and len(data) == size
+    return data, link_bytes
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -254,11 +383,15 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-d', '--dawg', arg_only=True, action='store_true', help="Generate a DAWG, which is much smaller for large dictionaries")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.dawg:
+        data, link_bytes = serialize_dawg(trie)
+    else:
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -279,6 +412,11 @@ def generate_autocorrect_data(cli):
         autocorrect_data_h_lines.append(f'//   {typo:<{len(max_typo)}} -> {correction}')
 
     autocorrect_data_h_lines.append('')
+    if cli.args.dawg:
+        max_changes = max(len(correction) - make_dawg_edit(typo, correction)[0] for typo, correction in autocorrections)
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_DAWG')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_DAWG_LINK_BYTES {link_bytes}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_DAWG_MAX_CHANGES {max_changes}')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
@@ -430,3 +430,60 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    """Compresses bytes using QMK's LZ scheme, see docs/quantum_painter_lz.md.
+
+    Matches are found greedily, using chains of earlier positions sharing the same 3-byte prefix.
+    """
+    data = bytes(bytearray)
+    output = []
+    literals = []
+    chains = {}
+
+    def flush_literals():
+        for n in range(0, len(literals), 128):
+            chunk = literals[n:n + 128]
+            output.append(len(chunk) - 1)
+            output.extend(chunk)
+        literals.clear()
+
+    def remember(pos):
+        if pos + 3 <= len(data):
+            chains.setdefault(data[pos:pos + 3], []).append(pos)
+
+    pos = 0
+    while pos < len(data):
+        best_length = 0
+        best_distance = 0
+        limit = min(130, len(data) - pos)
+        if limit >= 3:
+            # Most recent candidates first, stopping once they're out of reach of the decoder's window
+            for candidate in reversed(chains.get(data[pos:pos + 3], [])):
+                distance = pos - candidate
+                if distance > 256:
+                    break
+                length = 3
+                while length < limit and data[candidate + length] == data[pos + length]:
+                    length += 1
+                if length > best_length:
+                    best_length = length
+                    best_distance = distance
+                    if length == limit:
+                        break
+
+        if best_length >= 3:
+            flush_literals()
+            output.append(0x80 | (best_length - 3))
+            output.append(best_distance - 1)
+            for n in range(pos, pos + best_length):
+                remember(n)
+            pos += best_length
+        else:
+            literals.append(data[pos])
+            remember(pos)
+            pos += 1
+
+    flush_literals()
+    return output
@@ -0,0 +1,28 @@
+import re
+
+import qmk.painter
+from qmk.constants import QMK_FIRMWARE
+
+CODEC_FIXTURES = QMK_FIRMWARE / 'tests' / 'painter_image' / 'painter_codec_fixtures.hpp'
+
+
+def _read_fixtures():
+    """Returns the byte arrays in the fixtures header, keyed by name.
+    """
+    fixtures = {}
+    for name, body in re.findall(r'std::vector<uint8_t> (\w+) = \{([^}]*)\};', CODEC_FIXTURES.read_text()):
+        fixtures[name] = [int(value, 16) for value in re.findall(r'0x[0-9A-F]{2}', body)]
+    return fixtures
+
+
+def test_compress_bytes_match_decoder_fixtures():
+    # tests/painter_image decodes these fixtures in firmware, so the encoders must still produce exactly the same bytes
+    fixtures = _read_fixtures()
+    raw_names = [name for name in fixtures if name.endswith('_raw')]
+    assert raw_names
+
+    for raw_name in raw_names:
+        name = raw_name[:-len('_raw')]
+        raw = fixtures[raw_name]
+        assert qmk.painter.compress_bytes_qmk_rle(raw) == fixtures[name + '_rle'], name
+        assert qmk.painter.compress_bytes_qmk_lz(raw) == fixtures[name + '_lz'], name
@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "util.h"
 #include "debug.h"
+#include "eeprom_driver.h"
 #include "eeprom_legacy_emulated_flash.h"
 #include "legacy_flash_ops.h"
 
@@ -568,7 +569,7 @@ void eeprom_driver_erase(void) {
     EEPROM_Erase();
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read_block(void *buf, const void *addr, size_t len) {
     const uint8_t *src  = (const uint8_t *)addr;
     uint8_t *      dest = (uint8_t *)buf;
 
@@ -598,7 +599,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     }
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
     uint8_t *      dest = (uint8_t *)addr;
     const uint8_t *src  = (const uint8_t *)buf;
 
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "i2c_master.h"
+
+i2c_mock_stats_t i2c_mock_stats;
+uint8_t          i2c_mock_registers[128][256];
+uint16_t         i2c_mock_failing_writes;
+
+void i2c_mock_reset(void) {
+    memset(&i2c_mock_stats, 0, sizeof(i2c_mock_stats));
+    memset(i2c_mock_registers, 0, sizeof(i2c_mock_registers));
+    i2c_mock_failing_writes = 0;
+}
+
+static void i2c_mock_transfer(uint16_t bytes) {
+    i2c_mock_stats.transfers++;
+    i2c_mock_stats.bytes += bytes;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_mock_transfer(1 + length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_mock_transfer(1 + length);
+    memset(data, 0, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    if (i2c_mock_failing_writes) {
+        // Not acknowledged after the device address
+        i2c_mock_failing_writes--;
+        i2c_mock_transfer(1);
+        return I2C_STATUS_ERROR;
+    }
+    i2c_mock_transfer(2 + length);
+    for (uint16_t i = 0; i < length; i++) {
+        i2c_mock_registers[devaddr >> 1][(uint8_t)(regaddr + i)] = data[i];
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_mock_transfer(3 + length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    // Register address write, then a repeated start for the read
+    i2c_mock_transfer(2 + 1 + length);
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = i2c_mock_registers[devaddr >> 1][(uint8_t)(regaddr + i)];
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_mock_transfer(3 + 1 + length);
+    memset(data, 0, length);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    i2c_mock_transfer(1);
+    return I2C_STATUS_SUCCESS;
+}
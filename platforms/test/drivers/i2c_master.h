@@ -0,0 +1,40 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// A stand-in for the I2C master driver that records what would be sent,
+// for testing the drivers of I2C devices on the host.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef int16_t i2c_status_t;
+
+#define I2C_STATUS_SUCCESS (0)
+#define I2C_STATUS_ERROR (-1)
+#define I2C_STATUS_TIMEOUT (-2)
+
+void         i2c_init(void);
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
+
+typedef struct {
+    uint32_t transfers; // Number of transactions, each with its own start and stop condition
+    uint32_t bytes;     // Bytes on the bus, counting the device address and any register address
+} i2c_mock_stats_t;
+
+extern i2c_mock_stats_t i2c_mock_stats;
+
+// Last value written to each 8-bit register address of each 7-bit device address,
+// without regard for the pages some devices switch between.
+extern uint8_t i2c_mock_registers[128][256];
+
+// Number of upcoming register writes to fail, as if the device did not acknowledge them.
+extern uint16_t i2c_mock_failing_writes;
+
+void i2c_mock_reset(void); // Clear the statistics and registers, and stop failing writes
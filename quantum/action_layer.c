@@ -2,11 +2,16 @@
 #include <stdint.h>
 
 #include "keyboard.h"
+#include "matrix.h"
 #include "action.h"
 #include "encoder.h"
 #include "util.h"
 #include "action_layer.h"
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+#    include "split_util.h"
+#endif
+
 /** \brief Default Layer State
  */
 layer_state_t default_layer_state = 0;
@@ -37,6 +42,9 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_debug();
     ac_dprintf(" to ");
     default_layer_state = state;
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+    split_sync_mark_dirty(SPLIT_SYNC_DEFAULT_LAYER_STATE);
+#endif
     default_layer_debug();
     ac_dprintf("\n");
 #if defined(STRICT_LAYER_RELEASE)
@@ -117,6 +125,9 @@ void layer_state_set(layer_state_t state) {
     layer_debug();
     ac_dprintf(" to ");
     layer_state = state;
+#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+    split_sync_mark_dirty(SPLIT_SYNC_LAYER_STATE);
+#    endif
     layer_debug();
     ac_dprintf("\n");
 #    if defined(STRICT_LAYER_RELEASE)
@@ -316,16 +327,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Layer switch resolve layer
  *
- * Gets the layer based on key info
+ * Walks the active layers from the top down to find the first non-transparent action for key
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_switch_resolve_layer(keypos_t key, layer_state_t layers) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +347,84 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/** \brief layer lookup cache
+ *
+ * Holds the resolved layer of every matrix position, filled on first lookup. A set bit in
+ * layer_lookup_cache_valid marks the matching entry as usable for the layer state it was
+ * resolved against.
+ */
+static uint8_t       layer_lookup_cache[MATRIX_ROWS][MATRIX_COLS];
+static matrix_row_t  layer_lookup_cache_valid[MATRIX_ROWS];
+static layer_state_t layer_lookup_cache_state = 0;
+
+/** \brief Invalidate layer lookup cache
+ *
+ * Drops every cached entry, to be called when the keymap contents change in bulk
+ */
+void layer_lookup_cache_invalidate(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        layer_lookup_cache_valid[row] = 0;
+    }
+}
+
+/** \brief Invalidate layer lookup cache key
+ *
+ * Drops the cached entry for a single key, to be called when one of its keycodes changes
+ */
+void layer_lookup_cache_invalidate_key(keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layer_lookup_cache_valid[key.row] &= ~((matrix_row_t)1 << key.col);
+    }
+}
+
+/** \brief Update layer lookup cache state
+ *
+ * Layers below the highest toggled layer cannot change the result for keys resolved above it,
+ * so only entries at or below that layer are dropped.
+ */
+static void layer_lookup_cache_update_state(layer_state_t layers) {
+    const layer_state_t changed = layers ^ layer_lookup_cache_state;
+    if (!changed) {
+        return;
+    }
+
+    const uint8_t highest_changed = get_highest_layer(changed);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t valid = layer_lookup_cache_valid[row];
+        for (uint8_t col = 0; valid; col++, valid >>= 1) {
+            if ((valid & 1) && layer_lookup_cache[row][col] <= highest_changed) {
+                layer_lookup_cache_valid[row] &= ~((matrix_row_t)1 << col);
+            }
+        }
+    }
+    layer_lookup_cache_state = layers;
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_LOOKUP_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layer_lookup_cache_update_state(layers);
+
+        const matrix_row_t mask = (matrix_row_t)1 << key.col;
+        if (!(layer_lookup_cache_valid[key.row] & mask)) {
+            layer_lookup_cache[key.row][key.col] = layer_switch_resolve_layer(key, layers);
+            layer_lookup_cache_valid[key.row] |= mask;
+        }
+        return layer_lookup_cache[key.row][key.col];
+    }
+#    endif
+    return layer_switch_resolve_layer(key, layers);
 #else
     return get_highest_layer(default_layer_state);
 #endif
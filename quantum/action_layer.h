@@ -163,6 +163,17 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* resolved layer lookup cache */
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+void layer_lookup_cache_invalidate(void);
+void layer_lookup_cache_invalidate_key(keypos_t key);
+#else
+static inline void layer_lookup_cache_invalidate(void) {}
+static inline void layer_lookup_cache_invalidate_key(keypos_t key) {
+    (void)key;
+}
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
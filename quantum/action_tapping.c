@@ -1,10 +1,13 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
 #include "action_tapping.h"
+#include "debug.h"
 #include "keycode.h"
+#include "print.h"
 #include "timer.h"
 
 #ifndef NO_ACTION_TAPPING
@@ -55,6 +58,12 @@ __attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyreco
 }
 #    endif
 
+#    ifdef TAPPING_STREAK_TERM_PER_KEY
+__attribute__((weak)) uint16_t get_tapping_streak_term(uint16_t keycode, keyrecord_t *record) {
+    return get_adaptive_tapping_streak_term(record);
+}
+#    endif
+
 #    if defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)
 #        include "process_auto_shift.h"
 #    endif
@@ -73,12 +82,203 @@ static void waiting_buffer_scan_tap(void);
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
+#    if defined(TAPPING_LATENCY_STATS) || defined(TAPPING_STREAK_TERM)
+#        ifdef TAPPING_LATENCY_STATS
+typedef struct {
+    tapping_latency_stats_t stats;
+    uint32_t                tap_total;
+    uint32_t                hold_total;
+} tapping_latency_totals_t;
+
+static tapping_latency_totals_t tapping_latency = {0};
+#        endif
+
+typedef struct {
+    keypos_t key;
+#        ifdef TAPPING_LATENCY_STATS
+    tapping_latency_totals_t latency;
+#        endif
+#        ifdef TAPPING_STREAK_TERM
+    uint16_t hold_gap; // Moving average of the time from the previous key press to this key being pressed and held
+#        endif
+} tapping_key_slot_t;
+
+static tapping_key_slot_t tapping_key_slots[TAPPING_TRACKED_KEYS];
+static uint8_t            tapping_key_slots_used = 0;
+static uint8_t            tapping_key_slot_next  = 0;
+
+/** \brief Finds the statistics of a tap-hold key, optionally taking over a slot for it
+ *
+ * Once all slots are in use, new keys replace the tracked ones in turn.
+ */
+static tapping_key_slot_t *tapping_key_slot(keypos_t key, bool create) {
+    for (uint8_t i = 0; i < tapping_key_slots_used; i++) {
+        if (KEYEQ(tapping_key_slots[i].key, key)) {
+            return &tapping_key_slots[i];
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    tapping_key_slot_t *slot;
+    if (tapping_key_slots_used < TAPPING_TRACKED_KEYS) {
+        slot = &tapping_key_slots[tapping_key_slots_used++];
+    } else {
+        slot                  = &tapping_key_slots[tapping_key_slot_next];
+        tapping_key_slot_next = (tapping_key_slot_next + 1) % TAPPING_TRACKED_KEYS;
+    }
+    memset(slot, 0, sizeof(*slot));
+    slot->key = key;
+#        ifdef TAPPING_STREAK_TERM
+    slot->hold_gap = 2 * TAPPING_STREAK_TERM;
+#        endif
+    return slot;
+}
+
+#        ifdef TAPPING_LATENCY_STATS
+static void tapping_latency_add(tapping_latency_totals_t *totals, bool hold, bool early, uint16_t latency) {
+    tapping_latency_t *latencies = hold ? &totals->stats.hold : &totals->stats.tap;
+    if (latencies->count == UINT16_MAX) {
+        return;
+    }
+
+    uint8_t bucket = 0;
+    while (bucket < TAPPING_LATENCY_BUCKETS - 1 && latency >= ((uint32_t)1 << bucket)) {
+        bucket++;
+    }
+    latencies->histogram[bucket]++;
+
+    if (!latencies->count || latency < latencies->min) latencies->min = latency;
+    if (latency > latencies->max) latencies->max = latency;
+    latencies->count++;
+    *(hold ? &totals->hold_total : &totals->tap_total) += latency;
+    if (early) {
+        totals->stats.early_taps++;
+    }
+}
+
+static void tapping_latency_copy(const tapping_latency_totals_t *totals, tapping_latency_stats_t *stats) {
+    *stats          = totals->stats;
+    stats->tap.avg  = totals->stats.tap.count ? totals->tap_total / totals->stats.tap.count : 0;
+    stats->hold.avg = totals->stats.hold.count ? totals->hold_total / totals->stats.hold.count : 0;
+}
+
+void get_tapping_latency_stats(tapping_latency_stats_t *stats) {
+    tapping_latency_copy(&tapping_latency, stats);
+}
+
+bool get_tapping_key_latency_stats(keypos_t key, tapping_latency_stats_t *stats) {
+    tapping_key_slot_t *slot = tapping_key_slot(key, false);
+    if (!slot) {
+        return false;
+    }
+    tapping_latency_copy(&slot->latency, stats);
+    return true;
+}
+
+void clear_tapping_latency_stats(void) {
+    memset(&tapping_latency, 0, sizeof(tapping_latency));
+    for (uint8_t i = 0; i < tapping_key_slots_used; i++) {
+        memset(&tapping_key_slots[i].latency, 0, sizeof(tapping_key_slots[i].latency));
+    }
+}
+
+static void tapping_latency_print(const char *name, const tapping_latency_t *latencies) {
+    uprintf("  %s: %u, min %u avg %u max %u ms, histogram", name, latencies->count, latencies->min, latencies->avg, latencies->max);
+    for (uint8_t i = 0; i < TAPPING_LATENCY_BUCKETS; i++) {
+        uprintf(" %u", latencies->histogram[i]);
+    }
+    print("\n");
+}
+
+static void tapping_latency_print_stats(const tapping_latency_totals_t *totals) {
+    tapping_latency_stats_t stats;
+    tapping_latency_copy(totals, &stats);
+    tapping_latency_print("tap", &stats.tap);
+    tapping_latency_print("hold", &stats.hold);
+    uprintf("  streak taps: %u\n", stats.early_taps);
+}
+
+void print_tapping_latency_stats(void) {
+    print("tapping latency: all keys\n");
+    tapping_latency_print_stats(&tapping_latency);
+    for (uint8_t i = 0; i < tapping_key_slots_used; i++) {
+        uprintf("tapping latency: key %u,%u\n", tapping_key_slots[i].key.row, tapping_key_slots[i].key.col);
+        tapping_latency_print_stats(&tapping_key_slots[i].latency);
+    }
+}
+#        endif
+
+#        ifdef TAPPING_STREAK_TERM
+static uint16_t tapping_streak_last_press = 0;
+static bool     tapping_streak_recent     = false;
+static uint16_t tapping_streak_gap        = UINT16_MAX; // Time from the previous key press to the tapping key press
+
+/** \brief Tracks the time of the last key press, called for every event once processed
+ */
+static void tapping_streak_track(keyevent_t event) {
+    if (IS_EVENT(event)) {
+        if (event.pressed) {
+            tapping_streak_last_press = event.time;
+            tapping_streak_recent     = true;
+        }
+    } else if (tapping_streak_recent && TIMER_DIFF_16(event.time, tapping_streak_last_press) >= 2 * TAPPING_STREAK_TERM) {
+        // Forget it before the 16 bit timer can wrap around
+        tapping_streak_recent = false;
+    }
+}
+
+/** \brief Tapping streak term learned from how soon after another key this key is usually held
+ *
+ * Half the moving average of the time between the previous key press and
+ * pressing this key to hold it, so that holds typically begin well outside
+ * the term. Keys that have not been held yet use TAPPING_STREAK_TERM.
+ */
+uint16_t get_adaptive_tapping_streak_term(keyrecord_t *record) {
+    tapping_key_slot_t *slot = tapping_key_slot(record->event.key, false);
+    return slot ? slot->hold_gap / 2 : TAPPING_STREAK_TERM;
+}
+#        else
+#            define tapping_streak_track(event)
+#        endif
+
+/** \brief Accounts for the tap or hold decision just made for the tapping key
+ */
+static void tapping_key_resolved(bool hold, bool early) {
+    if (tapping_key.event.type != KEY_EVENT) {
+        return;
+    }
+    tapping_key_slot_t *slot = tapping_key_slot(tapping_key.event.key, true);
+
+#        ifdef TAPPING_LATENCY_STATS
+    uint16_t latency = TIMER_DIFF_16(timer_read(), tapping_key.event.time);
+    tapping_latency_add(&tapping_latency, hold, early, latency);
+    tapping_latency_add(&slot->latency, hold, early, latency);
+#            ifdef CONSOLE_ENABLE
+    dprintf("tapping latency: key %u,%u %s after %u ms\n", tapping_key.event.key.row, tapping_key.event.key.col, hold ? "hold" : (early ? "streak tap" : "tap"), latency);
+#            endif
+#        endif
+
+#        ifdef TAPPING_STREAK_TERM
+    if (hold) {
+        uint16_t gap   = tapping_streak_gap < 2 * TAPPING_STREAK_TERM ? tapping_streak_gap : 2 * TAPPING_STREAK_TERM;
+        slot->hold_gap = slot->hold_gap - slot->hold_gap / 4 + gap / 4;
+    }
+#        endif
+}
+#    else
+#        define tapping_streak_track(event)
+#        define tapping_key_resolved(hold, early)
+#    endif
+
 /** \brief Action Tapping Process
  *
  * FIXME: Needs doc
  */
 void action_tapping_process(keyrecord_t record) {
     if (process_tapping(&record)) {
+        tapping_streak_track(record.event);
         if (IS_EVENT(record.event)) {
             ac_dprintf("processed: ");
             debug_record(record);
@@ -100,6 +300,7 @@ void action_tapping_process(keyrecord_t record) {
     }
     for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+            tapping_streak_track(waiting_buffer[waiting_buffer_tail].event);
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
@@ -206,6 +407,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     tapping_key.tap.count = 1;
                     debug_tapping_key();
                     process_record(&tapping_key);
+                    tapping_key_resolved(false, false);
 
                     // copy tapping state
                     keyp->tap = tapping_key.tap;
@@ -229,6 +431,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // clang-format on
                     ac_dprintf("Tapping: End. No tap. Interfered by typing key\n");
                     process_record(&tapping_key);
+                    tapping_key_resolved(true, false);
                     tapping_key = (keyrecord_t){0};
                     debug_tapping_key();
                     // enqueue
@@ -280,6 +483,7 @@ bool process_tapping(keyrecord_t *keyp) {
                         ) {
                             ac_dprintf("Tapping: End. No tap. Interfered by pressed key\n");
                             process_record(&tapping_key);
+                            tapping_key_resolved(true, false);
                             tapping_key = (keyrecord_t){0};
                             debug_tapping_key();
                             // enqueue
@@ -337,6 +541,7 @@ bool process_tapping(keyrecord_t *keyp) {
                 debug_event(event);
                 ac_dprintf("\n");
                 process_record(&tapping_key);
+                tapping_key_resolved(true, false);
                 tapping_key = (keyrecord_t){0};
                 debug_tapping_key();
                 return false;
@@ -512,12 +717,26 @@ void waiting_buffer_scan_tap(void) {
             tapping_key.tap.count = 1;
             candidate->tap.count  = 1;
             process_record(&tapping_key);
+            tapping_key_resolved(false, false);
 
             ac_dprintf("waiting_buffer_scan_tap: found at [%u]\n", i);
             debug_waiting_buffer();
             return;
         }
     }
+
+#    ifdef TAPPING_STREAK_TERM
+    // A tap key pressed in quick succession to the previous key is taken to
+    // be typed as part of a word, and is tapped without waiting for release.
+    tapping_streak_gap = tapping_streak_recent ? TIMER_DIFF_16(tapping_key.event.time, tapping_streak_last_press) : UINT16_MAX;
+    if (tapping_streak_gap < GET_TAPPING_STREAK_TERM(get_record_keycode(&tapping_key, false), &tapping_key)) {
+        ac_dprintf("Tapping: Tap within streak(0->1).\n");
+        tapping_key.tap.count = 1;
+        process_record(&tapping_key);
+        tapping_key_resolved(false, true);
+        debug_tapping_key();
+    }
+#    endif
 }
 
 /** \brief Tapping key debug print
@@ -63,3 +63,44 @@ extern uint16_t g_tapping_term;
 #else
 #    define GET_QUICK_TAP_TERM(keycode, record) (QUICK_TAP_TERM)
 #endif
+
+/* number of tap-hold keys with their own latency statistics and streak term */
+#ifndef TAPPING_TRACKED_KEYS
+#    define TAPPING_TRACKED_KEYS 8
+#endif
+
+#ifdef TAPPING_STREAK_TERM
+uint16_t get_tapping_streak_term(uint16_t keycode, keyrecord_t *record);
+uint16_t get_adaptive_tapping_streak_term(keyrecord_t *record);
+
+#    ifdef TAPPING_STREAK_TERM_PER_KEY
+#        define GET_TAPPING_STREAK_TERM(keycode, record) get_tapping_streak_term(keycode, record)
+#    else
+#        define GET_TAPPING_STREAK_TERM(keycode, record) get_adaptive_tapping_streak_term(record)
+#    endif
+#endif
+
+#ifdef TAPPING_LATENCY_STATS
+#    ifndef TAPPING_LATENCY_BUCKETS
+#        define TAPPING_LATENCY_BUCKETS 10
+#    endif
+
+typedef struct {
+    uint16_t count;                              // Number of decisions measured since the last clear
+    uint16_t min;                                // Shortest time from pressing the key to the decision being sent, in milliseconds
+    uint16_t avg;                                // Average time from pressing the key to the decision being sent, in milliseconds
+    uint16_t max;                                // Longest time from pressing the key to the decision being sent, in milliseconds
+    uint16_t histogram[TAPPING_LATENCY_BUCKETS]; // Bucket n counts latencies below 2^n ms, the last bucket everything above
+} tapping_latency_t;
+
+typedef struct {
+    tapping_latency_t tap;        // Keys resolved as a tap
+    tapping_latency_t hold;       // Keys resolved as a hold
+    uint16_t          early_taps; // Taps resolved on press by the tapping streak term, also counted in `tap`
+} tapping_latency_stats_t;
+
+void get_tapping_latency_stats(tapping_latency_stats_t *stats);                  // Copy the latencies of all tap-hold keys, suitable for sending over raw HID
+bool get_tapping_key_latency_stats(keypos_t key, tapping_latency_stats_t *stats); // Copy the latencies of one key, false if it is not tracked
+void clear_tapping_latency_stats(void);                                          // Reset all latency counters and histograms
+void print_tapping_latency_stats(void);                                          // Print the latencies of all keys and of each tracked key to the console
+#endif
@@ -23,6 +23,23 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include <string.h>
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+#    include "split_util.h"
+#    define split_mods_changed() split_sync_mark_dirty(SPLIT_SYNC_MODS)
+// Only flag the split batch when the value actually changes
+#    define split_mods_update(var, value)     \
+        do {                                  \
+            uint8_t new_mods = (value);       \
+            if (new_mods != (var)) {          \
+                (var) = new_mods;             \
+                split_mods_changed();         \
+            }                                 \
+        } while (0)
+#else
+#    define split_mods_changed()
+#    define split_mods_update(var, value) ((var) = (value))
+#endif
+
 extern keymap_config_t keymap_config;
 
 static uint8_t real_mods = 0;
@@ -52,24 +69,28 @@ uint8_t        get_oneshot_locked_mods(void) {
 void add_oneshot_locked_mods(uint8_t mods) {
     if ((oneshot_locked_mods & mods) != mods) {
         oneshot_locked_mods |= mods;
+        split_mods_changed();
         oneshot_locked_mods_changed_kb(oneshot_locked_mods);
     }
 }
 void set_oneshot_locked_mods(uint8_t mods) {
     if (mods != oneshot_locked_mods) {
         oneshot_locked_mods = mods;
+        split_mods_changed();
         oneshot_locked_mods_changed_kb(oneshot_locked_mods);
     }
 }
 void clear_oneshot_locked_mods(void) {
     if (oneshot_locked_mods) {
         oneshot_locked_mods = 0;
+        split_mods_changed();
         oneshot_locked_mods_changed_kb(oneshot_locked_mods);
     }
 }
 void del_oneshot_locked_mods(uint8_t mods) {
     if (oneshot_locked_mods & mods) {
         oneshot_locked_mods &= ~mods;
+        split_mods_changed();
         oneshot_locked_mods_changed_kb(oneshot_locked_mods);
     }
 }
@@ -289,6 +310,17 @@ void send_6kro_report(void) {
     host_keyboard_send(keyboard_report);
 #else
     static report_keyboard_t last_report;
+    static uint16_t          last_generation = 0;
+
+    /* Nothing to compare if no key was added or removed since the last report was checked. */
+    if (keyboard_report->mods == last_report.mods && get_keys_generation() == last_generation
+#    ifdef KEYBOARD_SHARED_EP
+        && keyboard_report->report_id == last_report.report_id
+#    endif
+    ) {
+        return;
+    }
+    last_generation = get_keys_generation();
 
     /* Only send the report if there are changes to propagate to the host. */
     if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
@@ -303,6 +335,13 @@ void send_nkro_report(void) {
     nkro_report->mods = get_mods_for_report();
 
     static report_nkro_t last_report;
+    static uint16_t      last_generation = 0;
+
+    /* Nothing to compare if no key was added or removed since the last report was checked. */
+    if (nkro_report->mods == last_report.mods && nkro_report->report_id == last_report.report_id && get_keys_generation() == last_generation) {
+        return;
+    }
+    last_generation = get_keys_generation();
 
     /* Only send the report if there are changes to propagate to the host. */
     if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
@@ -340,28 +379,28 @@ uint8_t get_mods(void) {
  * FIXME: needs doc
  */
 void add_mods(uint8_t mods) {
-    real_mods |= mods;
+    split_mods_update(real_mods, real_mods | mods);
 }
 /** \brief del mods
  *
  * FIXME: needs doc
  */
 void del_mods(uint8_t mods) {
-    real_mods &= ~mods;
+    split_mods_update(real_mods, real_mods & ~mods);
 }
 /** \brief set mods
  *
  * FIXME: needs doc
  */
 void set_mods(uint8_t mods) {
-    real_mods = mods;
+    split_mods_update(real_mods, mods);
 }
 /** \brief clear mods
  *
  * FIXME: needs doc
  */
 void clear_mods(void) {
-    real_mods = 0;
+    split_mods_update(real_mods, 0);
 }
 
 /** \brief get weak mods
@@ -376,28 +415,28 @@ uint8_t get_weak_mods(void) {
  * FIXME: needs doc
  */
 void add_weak_mods(uint8_t mods) {
-    weak_mods |= mods;
+    split_mods_update(weak_mods, weak_mods | mods);
 }
 /** \brief del weak mods
  *
  * FIXME: needs doc
  */
 void del_weak_mods(uint8_t mods) {
-    weak_mods &= ~mods;
+    split_mods_update(weak_mods, weak_mods & ~mods);
 }
 /** \brief set weak mods
  *
  * FIXME: needs doc
  */
 void set_weak_mods(uint8_t mods) {
-    weak_mods = mods;
+    split_mods_update(weak_mods, mods);
 }
 /** \brief clear weak mods
  *
  * FIXME: needs doc
  */
 void clear_weak_mods(void) {
-    weak_mods = 0;
+    split_mods_update(weak_mods, 0);
 }
 
 #ifdef KEY_OVERRIDE_ENABLE
@@ -439,6 +478,7 @@ void add_oneshot_mods(uint8_t mods) {
         oneshot_time = timer_read();
 #    endif
         oneshot_mods |= mods;
+        split_mods_changed();
         oneshot_mods_changed_kb(mods);
     }
 }
@@ -446,6 +486,7 @@ void add_oneshot_mods(uint8_t mods) {
 void del_oneshot_mods(uint8_t mods) {
     if (oneshot_mods & mods) {
         oneshot_mods &= ~mods;
+        split_mods_changed();
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = oneshot_mods ? timer_read() : 0;
 #    endif
@@ -464,6 +505,7 @@ void set_oneshot_mods(uint8_t mods) {
             oneshot_time = timer_read();
 #    endif
             oneshot_mods = mods;
+            split_mods_changed();
             oneshot_mods_changed_kb(mods);
         }
     }
@@ -476,6 +518,7 @@ void set_oneshot_mods(uint8_t mods) {
 void clear_oneshot_mods(void) {
     if (oneshot_mods) {
         oneshot_mods = 0;
+        split_mods_changed();
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = 0;
 #    endif
@@ -109,8 +109,10 @@ typedef struct PACKED HSV {
     uint8_t v;
 } HSV;
 
-RGB hsv_to_rgb(HSV hsv);
-RGB hsv_to_rgb_nocie(HSV hsv);
+RGB  hsv_to_rgb(HSV hsv);
+RGB  hsv_to_rgb_nocie(HSV hsv);
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count);
+void hsv_to_rgb_nocie_batch(const HSV *hsv, RGB *rgb, uint8_t count);
 #ifdef WS2812_RGBW
 void convert_rgb_to_rgbw(rgb_led_t *led);
 #endif
@@ -0,0 +1,126 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "led_tables.h"
+#include "progmem.h"
+}
+
+namespace {
+
+// The conversion as it was before the division was removed, to compare against
+__attribute__((noinline)) RGB reference_hsv_to_rgb(HSV hsv, bool use_cie) {
+    RGB      rgb = {};
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h, s, v;
+
+#ifdef USE_CIE1931_CURVE
+    uint8_t value = use_cie ? pgm_read_byte(&CIE1931_CURVE[hsv.v]) : hsv.v;
+#else
+    (void)use_cie;
+    uint8_t value = hsv.v;
+#endif
+
+    if (hsv.s == 0) {
+        rgb.r = rgb.g = rgb.b = value;
+        return rgb;
+    }
+
+    h = hsv.h;
+    s = hsv.s;
+    v = value;
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb.r = v, rgb.g = t, rgb.b = p;
+            break;
+        case 1:
+            rgb.r = q, rgb.g = v, rgb.b = p;
+            break;
+        case 2:
+            rgb.r = p, rgb.g = v, rgb.b = t;
+            break;
+        case 3:
+            rgb.r = p, rgb.g = q, rgb.b = v;
+            break;
+        case 4:
+            rgb.r = t, rgb.g = p, rgb.b = v;
+            break;
+        default:
+            rgb.r = v, rgb.g = p, rgb.b = q;
+            break;
+    }
+    return rgb;
+}
+
+#ifdef USE_CIE1931_CURVE
+constexpr bool default_cie = true;
+#else
+constexpr bool default_cie = false;
+#endif
+
+// Every hue for one saturation and value, the span the batch functions are given
+void fill_hues(HSV *hsv, uint8_t s, uint8_t v) {
+    for (int h = 0; h < 256; h++) {
+        hsv[h] = {(uint8_t)h, s, v};
+    }
+}
+
+::testing::AssertionResult same_rgb(HSV hsv, RGB expected, RGB actual) {
+    if (expected.r == actual.r && expected.g == actual.g && expected.b == actual.b) {
+        return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << "HSV(" << (int)hsv.h << ", " << (int)hsv.s << ", " << (int)hsv.v << ") gave RGB(" << (int)actual.r << ", " << (int)actual.g << ", " << (int)actual.b << "), expected RGB(" << (int)expected.r << ", " << (int)expected.g << ", " << (int)expected.b << ")";
+}
+
+} // namespace
+
+TEST(Color, MatchesReferenceForAllInputs) {
+    for (int s = 0; s < 256; s++) {
+        for (int v = 0; v < 256; v++) {
+            for (int h = 0; h < 256; h++) {
+                HSV hsv = {(uint8_t)h, (uint8_t)s, (uint8_t)v};
+                ASSERT_TRUE(same_rgb(hsv, reference_hsv_to_rgb(hsv, default_cie), hsv_to_rgb(hsv)));
+                ASSERT_TRUE(same_rgb(hsv, reference_hsv_to_rgb(hsv, false), hsv_to_rgb_nocie(hsv)));
+            }
+        }
+    }
+}
+
+TEST(Color, BatchMatchesReferenceForAllInputs) {
+    HSV hsv[256];
+    RGB rgb[256], rgb_nocie[256];
+    for (int s = 0; s < 256; s++) {
+        for (int v = 0; v < 256; v++) {
+            fill_hues(hsv, s, v);
+            // The batch length is a uint8_t, so convert in two halves
+            hsv_to_rgb_batch(hsv, rgb, 128);
+            hsv_to_rgb_batch(&hsv[128], &rgb[128], 128);
+            hsv_to_rgb_nocie_batch(hsv, rgb_nocie, 128);
+            hsv_to_rgb_nocie_batch(&hsv[128], &rgb_nocie[128], 128);
+            for (int h = 0; h < 256; h++) {
+                ASSERT_TRUE(same_rgb(hsv[h], reference_hsv_to_rgb(hsv[h], default_cie), rgb[h]));
+                ASSERT_TRUE(same_rgb(hsv[h], reference_hsv_to_rgb(hsv[h], false), rgb_nocie[h]));
+            }
+        }
+    }
+}
+
+TEST(Color, BatchOfNothing) {
+    RGB rgb;
+    rgb.r = 1, rgb.g = 2, rgb.b = 3;
+    hsv_to_rgb_batch(nullptr, &rgb, 0);
+    EXPECT_EQ(rgb.r, 1);
+    EXPECT_EQ(rgb.g, 2);
+    EXPECT_EQ(rgb.b, 3);
+}
@@ -0,0 +1,12 @@
+color_DEFS :=
+
+color_SRC := \
+	$(QUANTUM_PATH)/color/tests/color_tests.cpp \
+	$(QUANTUM_PATH)/color.c
+
+color_cie_DEFS := \
+	-DUSE_CIE1931_CURVE
+
+color_cie_SRC := \
+	$(color_SRC) \
+	$(QUANTUM_PATH)/led_tables.c
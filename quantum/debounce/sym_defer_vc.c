@@ -0,0 +1,173 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm using vertical counters. Behaves like sym_defer_pk:
+on any state change a per-key timer is set, and when DEBOUNCE milliseconds of no
+changes have occurred on that key the key status change is pushed.
+
+Instead of one 8-bit counter per key, bit n of every counter in a row is stored
+in the same matrix_row_t word, so a whole row is counted down and compared with
+a few bitwise operations per counter bit regardless of the number of columns.
+The counters are statically allocated.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of bits needed to hold DEBOUNCE
+#    if DEBOUNCE < 2
+#        define DEBOUNCE_COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define DEBOUNCE_COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define DEBOUNCE_COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define DEBOUNCE_COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define DEBOUNCE_COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define DEBOUNCE_COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define DEBOUNCE_COUNTER_BITS 7
+#    else
+#        define DEBOUNCE_COUNTER_BITS 8
+#    endif
+
+// counters[row][n] holds bit n of the remaining time of every key in the row,
+// a key with all bits clear is not being debounced
+static matrix_row_t counters[MATRIX_ROWS][DEBOUNCE_COUNTER_BITS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            counters[row][bit] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static inline matrix_row_t bit_mask(uint8_t value, uint8_t bit) {
+    return (value >> bit) & 1 ? ~(matrix_row_t)0 : 0;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = counters[row];
+        matrix_row_t  active  = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            active |= counter[bit];
+        }
+        if (!active) {
+            continue;
+        }
+
+        // Find the keys with more than elapsed_time left, most significant bit first
+        matrix_row_t greater = 0;
+        matrix_row_t equal   = ~(matrix_row_t)0;
+        for (int8_t bit = DEBOUNCE_COUNTER_BITS - 1; bit >= 0; bit--) {
+            matrix_row_t elapsed_bit = bit_mask(elapsed_time, bit);
+            greater |= equal & counter[bit] & ~elapsed_bit;
+            equal &= ~(counter[bit] ^ elapsed_bit);
+        }
+        // elapsed_time may not fit in the counter at all
+        if (elapsed_time >> DEBOUNCE_COUNTER_BITS) {
+            greater = 0;
+        }
+
+        // Count those down, and clear the rest
+        matrix_row_t borrow = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            matrix_row_t elapsed_bit = bit_mask(elapsed_time, bit);
+            matrix_row_t difference  = counter[bit] ^ elapsed_bit ^ borrow;
+            borrow                   = (~counter[bit] & elapsed_bit) | (~(counter[bit] ^ elapsed_bit) & borrow);
+            counter[bit]             = difference & greater;
+        }
+
+        matrix_row_t expired     = active & ~greater;
+        matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+        cooked_changed |= cooked[row] ^ cooked_next;
+        cooked[row] = cooked_next;
+
+        if (greater) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = counters[row];
+        matrix_row_t  delta   = raw[row] ^ cooked[row];
+        matrix_row_t  active  = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            active |= counter[bit];
+        }
+
+        // Keys that changed start counting, keys back to their cooked state stop
+        matrix_row_t start = delta & ~active;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            counter[bit] = (counter[bit] & delta) | (start & bit_mask(DEBOUNCE, bit));
+        }
+
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
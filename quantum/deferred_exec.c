@@ -15,30 +15,52 @@
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
-    }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
-        }
-    }
-    return true;
+// Each token has a home slot in the table, and an entry only ever lives in its token's home slot:
+//   slot == (token - 1) % table_count
+// Lookups by token therefore never search the table, and a token is free whenever its home slot doesn't hold it. Tokens
+// can only address the first UINT8_MAX slots of a table.
+
+static inline size_t usable_table_count(size_t table_count) {
+    return table_count > UINT8_MAX ? UINT8_MAX : table_count;
+}
+
+static inline deferred_executor_t *home_entry(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    return &table[(size_t)(token - 1) % table_count];
+}
+
+static inline deferred_executor_t *find_entry(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    deferred_executor_t *home = home_entry(table, table_count, token);
+    return home->token == token ? home : NULL;
 }
 
 static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
+    // Tokens whose home slot is taken are skipped, so a stale token only comes back once every other token has been
+    // handed out. Unless the table is nearly full the first token tried is free.
     deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
+    while (current_token == INVALID_DEFERRED_TOKEN || home_entry(table, table_count, current_token)->token != INVALID_DEFERRED_TOKEN) {
         ++current_token;
         if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
             return INVALID_DEFERRED_TOKEN;
         }
     }
     return current_token;
 }
 
+static inline void clear_entry(deferred_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+// Keeps the earliest of the supplied trigger times, relative to now
+static inline void track_deadline(uint32_t now, uint32_t trigger_time, bool *has_deadline, uint32_t *deadline) {
+    if (!*has_deadline || ((int32_t)TIMER_DIFF_32(trigger_time, now)) < ((int32_t)TIMER_DIFF_32(*deadline, now))) {
+        *deadline     = trigger_time;
+        *has_deadline = true;
+    }
+}
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
@@ -49,27 +71,20 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim a token whose home slot is unused
+    deferred_token token = allocate_token(table, table_count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        // None available
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    deferred_executor_t *entry = home_entry(table, table_count, token);
+    entry->token        = token;
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +94,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,60 +112,82 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    clear_entry(entry);
+    return true;
 }
 
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
-    uint32_t now = timer_read32();
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *deadline) {
+    uint32_t now          = timer_read32();
+    bool     has_deadline = false;
+    for (size_t i = 0; table && i < usable_table_count(table_count); ++i) {
+        if (table[i].token != INVALID_DEFERRED_TOKEN) {
+            track_deadline(now, table[i].trigger_time, &has_deadline, deadline);
+        }
+    }
+    return has_deadline;
+}
 
-    // Throttle only once per millisecond
-    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
-        *last_execution_time = now;
+static bool deferred_exec_run_table(deferred_executor_t *table, size_t table_count, uint32_t now, uint32_t *deadline) {
+    bool has_deadline = false;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
-            deferred_token       curr_token = entry->token;
+    // Run through each of the executors
+    for (size_t i = 0; i < usable_table_count(table_count); ++i) {
+        deferred_executor_t *entry      = &table[i];
+        deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+        if (curr_token == INVALID_DEFERRED_TOKEN) {
+            continue;
+        }
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+        // Check if we're supposed to execute this entry
+        if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                if (deadline && entry->token != INVALID_DEFERRED_TOKEN) {
+                    track_deadline(now, entry->trigger_time, &has_deadline, deadline);
                 }
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                clear_entry(entry);
+                continue;
             }
         }
+
+        if (deadline) {
+            track_deadline(now, entry->trigger_time, &has_deadline, deadline);
+        }
+    }
+
+    return has_deadline;
+}
+
+void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    uint32_t now = timer_read32();
+
+    // Throttle only once per millisecond
+    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
+        *last_execution_time = now;
+        deferred_exec_run_table(table, table_count, now, NULL);
     }
 }
 
@@ -163,15 +198,57 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
+// Earliest trigger time of the basic table. It may be earlier than the real one after an extension, in which case the
+// next task run simply finds nothing to do and recalculates it.
+static uint32_t basic_deadline     = 0;
+static bool     basic_has_deadline = false;
+
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    deferred_token token = defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    if (token != INVALID_DEFERRED_TOKEN) {
+        track_deadline(timer_read32(), find_entry(basic_executors, MAX_DEFERRED_EXECUTORS, token)->trigger_time, &basic_has_deadline, &basic_deadline);
+    }
+    return token;
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    if (!extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms)) {
+        return false;
+    }
+    track_deadline(timer_read32(), find_entry(basic_executors, MAX_DEFERRED_EXECUTORS, token)->trigger_time, &basic_has_deadline, &basic_deadline);
+    return true;
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    if (!cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token)) {
+        return false;
+    }
+    // The cancelled executor may have been the next one due, or the last one queued
+    basic_has_deadline = deferred_exec_advanced_next_deadline(basic_executors, MAX_DEFERRED_EXECUTORS, &basic_deadline);
+    return true;
+}
+bool deferred_exec_next_deadline(uint32_t *deadline) {
+    if (basic_has_deadline) {
+        *deadline = basic_deadline;
+    }
+    return basic_has_deadline;
 }
 void deferred_exec_task(void) {
-    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    uint32_t now = timer_read32();
+
+    // Nothing is due, skip walking the table
+    uint32_t next;
+    if (!deferred_exec_next_deadline(&next) || ((int32_t)TIMER_DIFF_32(next, now)) > 0) {
+        return;
+    }
+
+    // Throttle only once per millisecond
+    if (((int32_t)TIMER_DIFF_32(now, last_deferred_exec_check)) > 0) {
+        last_deferred_exec_check = now;
+
+        // Callbacks queueing new executors update the deadline through defer_exec(), so start from a clean slate
+        uint32_t deadline;
+        basic_has_deadline = false;
+        if (deferred_exec_run_table(basic_executors, MAX_DEFERRED_EXECUTORS, now, &deadline)) {
+            track_deadline(now, deadline, &basic_has_deadline, &basic_deadline);
+        }
+    }
 }
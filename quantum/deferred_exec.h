@@ -60,6 +60,15 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Queries when the next deferred execution is due, allowing the caller to idle until then.
+ * The reported deadline is never later than the real one, but may be earlier after extensions.
+ *
+ * @param deadline[out] the time the next executor is due -- equivalent time-space as timer_read32()
+ * @return true if any executor is queued, otherwise false and deadline is left untouched
+ */
+bool deferred_exec_next_deadline(uint32_t *deadline);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -110,6 +119,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Queries when the next deferred execution of a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param deadline[out] the time the next executor is due -- equivalent time-space as timer_read32()
+ * @return true if any executor is queued, otherwise false and deadline is left untouched
+ */
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *deadline);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
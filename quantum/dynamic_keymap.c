@@ -17,10 +17,12 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "wait.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -125,6 +127,7 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    layer_lookup_cache_invalidate_key((keypos_t){.row = row, .col = column});
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -193,6 +196,7 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+    layer_lookup_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -284,6 +288,21 @@ void dynamic_keymap_macro_send(uint8_t id) {
         ++p;
     }
 
+#ifdef SEND_STRING_ASYNC_BUFFER_SIZE
+    // Queue the macro straight from EEPROM so it doesn't block the keyboard while it types.
+    // If there is no room, type out what is already queued until there is. A macro too big
+    // for the queue is sent by the blocking path below once the queue is empty, so that it
+    // isn't reordered with queued strings.
+    bool queued;
+    while (!(queued = send_string_async_with_reader(p, eeprom_read_byte, DYNAMIC_KEYMAP_MACRO_DELAY, NULL)) && send_string_async_busy()) {
+        send_string_async_task();
+        wait_ms(1);
+    }
+    if (queued) {
+        return;
+    }
+#endif
+
     // Send the macro string by making a temporary string.
     char data[8] = {0};
     // We already checked there was a null at the end of
@@ -46,6 +46,9 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
  */
 void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
+#    if defined(EEPROM_WRITE_BACK_CACHE)
+    eeprom_driver_discard();
+#    endif
     eeprom_driver_erase();
 #endif
 
@@ -108,6 +111,9 @@ void eeconfig_enable(void) {
  */
 void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
+#    if defined(EEPROM_WRITE_BACK_CACHE)
+    eeprom_driver_discard();
+#    endif
     eeprom_driver_erase();
 #endif
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
@@ -4,7 +4,7 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
-#include "wait.h"
+#include "timer.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
@@ -27,35 +27,110 @@ static void encoder_queue_drain(void) {
     encoder_events.dequeued = encoder_events.enqueued;
 }
 
-static bool encoder_handle_queue(void) {
-    bool    changed = false;
+#ifdef ENCODER_MAP_ENABLE
+
+// The encoder map key currently being tapped, press and release spaced
+// ENCODER_MAP_KEY_DELAY apart. The delays cater for Windows and its wonderful
+// requirements; they are timed rather than waited for, so a fast spin does not
+// hold up matrix scanning and split sync while the taps are sent.
+static struct {
+    uint16_t time;      // When the last press or release was sent
+    uint8_t  index;     // The encoder being tapped
+    bool     clockwise; // Its direction
+    bool     pressed;   // Whether its key is down
+    bool     waiting;   // Whether the delay since `time` is still running
+    uint8_t  taps;      // Taps left to send, including the current one
+    uint8_t  detents;   // Further detents in the same direction, coalesced into the next taps
+} encoder_map_tap;
+
+#    ifdef ENCODER_MAP_COALESCE
+// Takes the detents at the front of the queue that turn the same way as the current taps.
+static void encoder_map_coalesce(void) {
     uint8_t index;
     bool    clockwise;
-    while (encoder_dequeue_event(&index, &clockwise)) {
-#ifdef ENCODER_MAP_ENABLE
+    while (encoder_events.head != encoder_events.tail) {
+        encoder_event_t event = encoder_events.queue[encoder_events.tail];
+        if (event.index != encoder_map_tap.index || event.clockwise != encoder_map_tap.clockwise || encoder_map_tap.detents == UINT8_MAX) {
+            break;
+        }
+        encoder_dequeue_event(&index, &clockwise);
+        encoder_map_tap.detents++;
+    }
+}
+#    endif // ENCODER_MAP_COALESCE
+
+static bool encoder_handle_queue(void) {
+    bool changed = false;
+    while (true) {
+#    ifdef ENCODER_MAP_COALESCE
+        if (encoder_map_tap.taps || encoder_map_tap.waiting) {
+            encoder_map_coalesce();
+        }
+#    endif // ENCODER_MAP_COALESCE
 
-        // The delays below cater for Windows and its wonderful requirements.
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+        if (encoder_map_tap.waiting && timer_elapsed(encoder_map_tap.time) < ENCODER_MAP_KEY_DELAY) {
+            break;
+        }
+        encoder_map_tap.waiting = false;
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+        if (encoder_map_tap.pressed) {
+            action_exec(encoder_map_tap.clockwise ? MAKE_ENCODER_CW_EVENT(encoder_map_tap.index, false) : MAKE_ENCODER_CCW_EVENT(encoder_map_tap.index, false));
+            encoder_map_tap.pressed = false;
+            encoder_map_tap.taps--;
+        } else {
+            if (!encoder_map_tap.taps) {
+                uint8_t detents = encoder_map_tap.detents;
+                if (detents) {
+                    encoder_map_tap.detents = 0;
+                } else if (encoder_dequeue_event(&encoder_map_tap.index, &encoder_map_tap.clockwise)) {
+                    detents = 1;
+#    ifdef ENCODER_MAP_COALESCE
+                    encoder_map_coalesce();
+                    detents += encoder_map_tap.detents;
+                    encoder_map_tap.detents = 0;
+#    endif // ENCODER_MAP_COALESCE
+                } else {
+                    break;
+                }
+#    ifdef ENCODER_MAP_COALESCE
+                encoder_map_tap.taps = encoder_map_coalesce_kb(encoder_map_tap.index, encoder_map_tap.clockwise, detents);
+#    else
+                encoder_map_tap.taps = detents;
+#    endif // ENCODER_MAP_COALESCE
+                if (!encoder_map_tap.taps) {
+                    continue;
+                }
+            }
+            action_exec(encoder_map_tap.clockwise ? MAKE_ENCODER_CW_EVENT(encoder_map_tap.index, true) : MAKE_ENCODER_CCW_EVENT(encoder_map_tap.index, true));
+            encoder_map_tap.pressed = true;
+        }
+
+        changed = true;
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+        encoder_map_tap.time    = timer_read();
+        encoder_map_tap.waiting = true;
 #    endif // ENCODER_MAP_KEY_DELAY > 0
+    }
+    return changed;
+}
 
 #else // ENCODER_MAP_ENABLE
 
+static bool encoder_handle_queue(void) {
+    bool    changed = false;
+    uint8_t index;
+    bool    clockwise;
+    while (encoder_dequeue_event(&index, &clockwise)) {
         encoder_update_kb(index, clockwise);
-
-#endif // ENCODER_MAP_ENABLE
-
         changed = true;
     }
     return changed;
 }
 
+#endif // ENCODER_MAP_ENABLE
+
 bool encoder_task(void) {
     bool changed = false;
 
@@ -148,6 +223,16 @@ void encoder_signal_queue_drain(void) {
     signal_queue_drain = true;
 }
 
+#if defined(ENCODER_MAP_ENABLE) && defined(ENCODER_MAP_COALESCE)
+__attribute__((weak)) uint8_t encoder_map_coalesce_user(uint8_t index, bool clockwise, uint8_t detents) {
+    return detents;
+}
+
+__attribute__((weak)) uint8_t encoder_map_coalesce_kb(uint8_t index, bool clockwise, uint8_t detents) {
+    return encoder_map_coalesce_user(index, clockwise, detents);
+}
+#endif // defined(ENCODER_MAP_ENABLE) && defined(ENCODER_MAP_COALESCE)
+
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) {
     return true;
 }
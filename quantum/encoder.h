@@ -105,6 +105,12 @@ void encoder_signal_queue_drain(void);
 #        define ENCODER_CCW_CW(ccw, cw) \
             { (cw), (ccw) }
 extern const uint16_t encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS];
+
+#        ifdef ENCODER_MAP_COALESCE
+// Number of taps to send for detents that were turned faster than they could be tapped
+uint8_t encoder_map_coalesce_kb(uint8_t index, bool clockwise, uint8_t detents);
+uint8_t encoder_map_coalesce_user(uint8_t index, bool clockwise, uint8_t detents);
+#        endif // ENCODER_MAP_COALESCE
 #    endif // ENCODER_MAP_ENABLE
 
 // "Custom encoder lite" support
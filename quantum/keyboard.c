@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode_config.h"
 #include "matrix.h"
@@ -140,6 +141,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
+#ifdef SEND_STRING_ENABLE
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -195,25 +199,107 @@ static uint32_t matrix_timer           = 0;
 static uint32_t matrix_scan_count      = 0;
 static uint32_t last_matrix_scan_count = 0;
 
+static matrix_scan_stats_t matrix_scan_stats      = {0};
+static uint32_t            matrix_last_scan_time  = 0;
+static bool                matrix_has_scanned     = false;
+static uint16_t            matrix_period_min      = UINT16_MAX;
+static uint16_t            matrix_period_max      = 0;
+static uint32_t            matrix_latency_total   = 0;
+static uint32_t            matrix_raw_change_time = 0;
+static bool                matrix_raw_change_seen = false;
+
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
 
     uint32_t timer_now = timer_read32();
-    if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
+    if (matrix_has_scanned) {
+        uint32_t period = TIMER_DIFF_32(timer_now, matrix_last_scan_time);
+        if (period > UINT16_MAX) period = UINT16_MAX;
+        if (period < matrix_period_min) matrix_period_min = period;
+        if (period > matrix_period_max) matrix_period_max = period;
+    }
+    matrix_last_scan_time = timer_now;
+    matrix_has_scanned    = true;
+
+    uint32_t elapsed = TIMER_DIFF_32(timer_now, matrix_timer);
+    if (elapsed >= 1000) {
+        matrix_scan_stats.scan_rate     = matrix_scan_count;
+        matrix_scan_stats.period_avg_us = (elapsed * 1000) / matrix_scan_count;
+        matrix_scan_stats.period_min    = matrix_period_min == UINT16_MAX ? 0 : matrix_period_min;
+        matrix_scan_stats.period_max    = matrix_period_max;
 #    if defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+        dprintf("matrix scan period: min %u ms, avg %lu us, max %u ms\n", matrix_scan_stats.period_min, matrix_scan_stats.period_avg_us, matrix_scan_stats.period_max);
+        if (matrix_scan_stats.latency_count) {
+            dprintf("matrix key latency: min %u ms, avg %lu ms, max %u ms\n", matrix_scan_stats.latency_min, matrix_latency_total / matrix_scan_stats.latency_count, matrix_scan_stats.latency_max);
+        }
 #    endif
         last_matrix_scan_count = matrix_scan_count;
         matrix_timer           = timer_now;
         matrix_scan_count      = 0;
+        matrix_period_min      = UINT16_MAX;
+        matrix_period_max      = 0;
+    }
+}
+
+void matrix_scan_perf_raw_change(void) {
+    // Keep the first change of a burst, bouncing contacts should not shorten the measurement
+    if (!matrix_raw_change_seen) {
+        matrix_raw_change_time = timer_read32();
+        matrix_raw_change_seen = true;
+    }
+}
+
+void matrix_scan_perf_raw_settled(const matrix_row_t raw[], const matrix_row_t debounced[], uint8_t num_rows) {
+    // Back where debouncing left it: the change was filtered out and must not count towards the next key event
+    if (matrix_raw_change_seen && memcmp(raw, debounced, num_rows * sizeof(matrix_row_t)) == 0) {
+        matrix_raw_change_seen = false;
     }
 }
 
+static void matrix_scan_perf_key_event(void) {
+    if (!matrix_raw_change_seen) {
+        return;
+    }
+    matrix_raw_change_seen = false;
+
+    uint32_t latency = TIMER_DIFF_32(timer_read32(), matrix_raw_change_time);
+    if (latency > UINT16_MAX) latency = UINT16_MAX;
+
+    uint8_t bucket = 0;
+    while (bucket < MATRIX_SCAN_LATENCY_BUCKETS - 1 && latency >= ((uint32_t)1 << bucket)) {
+        bucket++;
+    }
+    if (matrix_scan_stats.latency_histogram[bucket] < UINT16_MAX) {
+        matrix_scan_stats.latency_histogram[bucket]++;
+    }
+
+    if (!matrix_scan_stats.latency_count || latency < matrix_scan_stats.latency_min) matrix_scan_stats.latency_min = latency;
+    if (latency > matrix_scan_stats.latency_max) matrix_scan_stats.latency_max = latency;
+    matrix_scan_stats.latency_count++;
+    matrix_latency_total += latency;
+}
+
 uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
+
+void get_matrix_scan_stats(matrix_scan_stats_t *stats) {
+    *stats             = matrix_scan_stats;
+    stats->latency_avg = matrix_scan_stats.latency_count ? matrix_latency_total / matrix_scan_stats.latency_count : 0;
+}
+
+void clear_matrix_scan_latency(void) {
+    matrix_scan_stats.latency_count = 0;
+    matrix_scan_stats.latency_min   = 0;
+    matrix_scan_stats.latency_max   = 0;
+    memset(matrix_scan_stats.latency_histogram, 0, sizeof(matrix_scan_stats.latency_histogram));
+    matrix_latency_total   = 0;
+    matrix_raw_change_seen = false;
+}
 #else
 #    define matrix_scan_perf_task()
+#    define matrix_scan_perf_key_event()
 #endif
 
 #ifdef MATRIX_HAS_GHOST
@@ -535,11 +621,19 @@ static bool matrix_task(void) {
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+    // Rows held back by ghost detection have to be revisited even if the matrix did not report them again
+    static bool    ghost_pending  = false;
+    bool           matrix_changed = matrix_scan() || ghost_pending;
+    const uint8_t *changed_rows   = ghost_pending ? NULL : matrix_get_changed_rows();
+    ghost_pending                 = false;
+#else
     matrix_scan();
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
     }
+#endif
 
     matrix_scan_perf_task();
 
@@ -556,10 +650,21 @@ static bool matrix_task(void) {
     const bool process_keypress = should_process_keypress();
 
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+        if (changed_rows && !(changed_rows[row / 8] & (1 << (row % 8)))) {
+            continue;
+        }
+#endif
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
+        if (!row_changes) {
+            continue;
+        }
+        if (has_ghost_in_row(row, current_row)) {
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+            ghost_pending = true;
+#endif
             continue;
         }
 
@@ -579,6 +684,8 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+    matrix_scan_perf_key_event();
+
     return matrix_changed;
 }
 
@@ -743,6 +850,18 @@ void keyboard_task(void) {
     haptic_task();
 #endif
 
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_BUFFER_SIZE)
+    send_string_async_task();
+#endif
+
+#ifdef HOST_REPORT_QUEUE_SIZE
+    host_report_queue_task();
+#endif
+
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_BACK_CACHE)
+    eeprom_driver_task();
+#endif
+
     led_task();
 
 #ifdef OS_DETECTION_ENABLE
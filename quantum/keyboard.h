@@ -139,6 +139,27 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 
 uint32_t get_matrix_scan_rate(void);
 
+#ifdef DEBUG_MATRIX_SCAN_RATE
+#    ifndef MATRIX_SCAN_LATENCY_BUCKETS
+#        define MATRIX_SCAN_LATENCY_BUCKETS 8
+#    endif
+
+typedef struct {
+    uint32_t scan_rate;     // Number of scans during the last measurement window
+    uint32_t period_avg_us; // Average time between two scans during the last measurement window, in microseconds
+    uint16_t period_min;    // Shortest time between two scans during the last measurement window, in milliseconds
+    uint16_t period_max;    // Longest time between two scans during the last measurement window, in milliseconds
+    uint32_t latency_count; // Number of key changes measured since the last clear
+    uint16_t latency_min;   // Shortest time from raw key change to event processing, in milliseconds
+    uint16_t latency_avg;   // Average time from raw key change to event processing, in milliseconds
+    uint16_t latency_max;   // Longest time from raw key change to event processing, in milliseconds
+    uint16_t latency_histogram[MATRIX_SCAN_LATENCY_BUCKETS]; // Bucket n counts latencies below 2^n ms, the last bucket everything above
+} matrix_scan_stats_t;
+
+void get_matrix_scan_stats(matrix_scan_stats_t *stats); // Copy the current scan telemetry, suitable for sending over raw HID
+void clear_matrix_scan_latency(void);                   // Reset the key change latency counters and histogram
+#endif
+
 #ifdef __cplusplus
 }
 #endif
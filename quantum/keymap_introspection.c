@@ -108,4 +108,18 @@ __attribute__((weak)) combo_t* combo_get(uint16_t combo_idx) {
     return combo_get_raw(combo_idx);
 }
 
+#    ifdef COMBO_INDEX_BUCKETS
+#        define COMBO_INDEX_BUCKET_SIZE_RAW ((sizeof(key_combos) / sizeof(combo_t) + 7) / 8)
+
+static uint8_t combo_index_buckets[COMBO_INDEX_BUCKETS][COMBO_INDEX_BUCKET_SIZE_RAW];
+
+uint16_t combo_index_bucket_size_raw(void) {
+    return COMBO_INDEX_BUCKET_SIZE_RAW;
+}
+
+uint8_t* combo_index_bucket_raw(uint8_t bucket) {
+    return combo_index_buckets[bucket];
+}
+#    endif // COMBO_INDEX_BUCKETS
+
 #endif // defined(COMBO_ENABLE)
@@ -66,4 +66,11 @@ combo_t* combo_get_raw(uint16_t combo_idx);
 // Get the keycode for the encoder mapping location, potentially stored dynamically
 combo_t* combo_get(uint16_t combo_idx);
 
+#    ifdef COMBO_INDEX_BUCKETS
+// Get the number of bytes in each combo index bucket, one bit for each combo defined in the user's keymap
+uint16_t combo_index_bucket_size_raw(void);
+// Get the storage for a combo index bucket, sized for the combos defined in the user's keymap
+uint8_t* combo_index_bucket_raw(uint8_t bucket);
+#    endif // COMBO_INDEX_BUCKETS
+
 #endif // defined(COMBO_ENABLE)
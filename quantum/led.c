@@ -19,6 +19,10 @@
 #include "debug.h"
 #include "gpio.h"
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+#    include "split_util.h"
+#endif
+
 #ifdef BACKLIGHT_CAPS_LOCK
 #    ifdef BACKLIGHT_ENABLE
 #        include "backlight.h"
@@ -181,6 +185,9 @@ void led_task(void) {
     if (last_led_status != led_status) {
         last_led_status            = led_status;
         last_led_modification_time = timer_read32();
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+        split_sync_mark_dirty(SPLIT_SYNC_LED_STATE);
+#endif
 
         if (debug_keyboard) {
             dprintf("led_task: %02X\n", led_status);
@@ -71,6 +71,14 @@ extern matrix_row_t matrix[MATRIX_ROWS];     // debounced values
 extern uint8_t thisHand, thatHand;
 #endif
 
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+static uint8_t changed_rows[MATRIX_CHANGED_ROWS_SIZE];
+
+const uint8_t *matrix_get_changed_rows(void) {
+    return changed_rows;
+}
+#endif
+
 // user-defined overridable functions
 __attribute__((weak)) void matrix_init_pins(void);
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row);
@@ -339,11 +347,39 @@ uint8_t matrix_scan(void) {
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+    // Debouncing only tells whether anything changed, keep the debounced rows to find out which ones did
+    matrix_row_t debounced[MATRIX_ROWS];
+    memcpy(debounced, matrix, sizeof(debounced));
+#endif
+
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    if (changed) matrix_scan_perf_raw_change();
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
+
+#ifdef DEBUG_MATRIX_SCAN_RATE
+#    ifdef SPLIT_KEYBOARD
+    if (!changed) matrix_scan_perf_raw_settled(raw_matrix, matrix + thisHand, ROWS_PER_HAND);
+#    else
+    if (!changed) matrix_scan_perf_raw_settled(raw_matrix, matrix, ROWS_PER_HAND);
+#    endif
+#endif
+
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+    memset(changed_rows, 0, sizeof(changed_rows));
+    for (uint8_t row = 0; changed && row < MATRIX_ROWS; row++) {
+        if (matrix[row] != debounced[row]) {
+            changed_rows[row / 8] |= 1 << (row % 8);
+        }
+    }
+#endif
+
     return (uint8_t)changed;
 }
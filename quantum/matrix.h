@@ -75,6 +75,19 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+#    define MATRIX_CHANGED_ROWS_SIZE ((MATRIX_ROWS + 7) / 8)
+/* bitmap of rows that changed during the last matrix_scan, one bit per row, or NULL to compare every row */
+const uint8_t *matrix_get_changed_rows(void);
+#endif
+
+#ifdef DEBUG_MATRIX_SCAN_RATE
+/* notify scan telemetry that the raw (undebounced) matrix state changed */
+void matrix_scan_perf_raw_change(void);
+/* notify scan telemetry that the debounced matrix did not change, a raw change that is undone again was a glitch */
+void matrix_scan_perf_raw_settled(const matrix_row_t raw[], const matrix_row_t debounced[], uint8_t num_rows);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
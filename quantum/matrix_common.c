@@ -3,11 +3,11 @@
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#include <string.h>
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
-#    include <string.h>
 
 #    define ROWS_PER_HAND (MATRIX_ROWS / 2)
 #else
@@ -91,6 +91,13 @@ void matrix_print(void) {
     }
 }
 
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+// Custom matrices that don't track their changed rows make the keyboard loop compare every row when the scan reports a change
+__attribute__((weak)) const uint8_t *matrix_get_changed_rows(void) {
+    return NULL;
+}
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void) {
     bool changed = false;
@@ -168,6 +175,10 @@ __attribute__((weak)) void matrix_init(void) {
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    if (changed) matrix_scan_perf_raw_change();
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
@@ -175,6 +186,14 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     matrix_scan_kb();
 #endif
 
+#ifdef DEBUG_MATRIX_SCAN_RATE
+#    ifdef SPLIT_KEYBOARD
+    if (!changed) matrix_scan_perf_raw_settled(raw_matrix, matrix + thisHand, ROWS_PER_HAND);
+#    else
+    if (!changed) matrix_scan_perf_raw_settled(raw_matrix, matrix, ROWS_PER_HAND);
+#    endif
+#endif
+
     return changed;
 }
 
@@ -56,6 +56,42 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of glyphs per font whose width and location are remembered between calls to
+ *      \ref qp_drawtext and \ref qp_textwidth, avoiding a search of the font's glyph tables for each character. The
+ *      least recently used glyph is replaced when the cache is full. Defaults to 0, disabling the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE
+/**
+ * @def This controls the number of bytes of RAM, shared between all fonts, used to hold decompressed pixel data for
+ *      the glyphs in the glyph cache. Cached glyphs are drawn straight from RAM without touching the font's data at
+ *      all. When the arena fills up, all cached pixel data is discarded at once. Only used when
+ *      \ref QUANTUM_PAINTER_GLYPH_CACHE_SIZE is non-zero. Defaults to 0, disabling pixel caching.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE
+
+#ifndef QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE
+/**
+ * @def This controls the number of strings, shared between all fonts, whose width is remembered by
+ *      \ref qp_textwidth. Only strings up to \ref QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH bytes long are cached.
+ *      Defaults to 0, disabling the cache.
+ */
+#    define QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH
+/**
+ * @def This controls the length in bytes of the longest string \ref qp_textwidth will cache the width of. Each entry
+ *      in the width cache holds a copy of its string, so increasing this number increases the amount of RAM required.
+ */
+#    define QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH 16
+#endif // QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
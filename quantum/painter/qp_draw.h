@@ -73,6 +73,13 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            bool    is_match; // whether the current run copies from the window rather than the stream
+            uint8_t remain;   // number of bytes remaining in the current run
+            uint8_t offset;   // the current match copies from (offset + 1) bytes back in the window
+            uint8_t pos;      // window write position, wraps along with the window
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -98,3 +105,11 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
+
+// Block-based equivalent of the above, decoding many bytes per call. Returns the number of bytes written to the buffer, which is only ever less than requested on error.
+typedef uint32_t (*qp_internal_block_input_callback)(void* cb_arg, uint8_t* buffer, uint32_t length);
+
+// Same as qp_internal_appender, but decodes and hands pixels to the driver in blocks rather than one at a time
+bool qp_internal_block_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_block_input_callback input_callback, void* input_state);
+
+qp_internal_block_input_callback qp_internal_prepare_block_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
@@ -6,6 +6,8 @@
 #include "qp_draw.h"
 #include "qp_comms.h"
 
+#include <string.h>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Palette / Monochrome-format decoder
 
@@ -126,6 +128,137 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+// Sliding window shared by the LZ decoders, matches can only refer back this far
+static uint8_t qp_internal_lz_window[256];
+
+static inline bool qp_drawimage_lz_next_run(qp_internal_byte_input_state_t* state) {
+    int16_t token = qp_stream_get(state->src_stream);
+    if (token < 0) {
+        return false;
+    }
+
+    if (token < 128) {
+        // Literal run, bytes are copied from the stream
+        state->lz.is_match = false;
+        state->lz.remain   = token + 1;
+    } else {
+        // Match, bytes are copied from earlier in the window
+        int16_t offset = qp_stream_get(state->src_stream);
+        if (offset < 0) {
+            return false;
+        }
+        state->lz.is_match = true;
+        state->lz.remain   = (token & 0x7F) + 3;
+        state->lz.offset   = offset;
+    }
+    return true;
+}
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    if (state->lz.remain == 0 && !qp_drawimage_lz_next_run(state)) {
+        return STREAM_EOF;
+    }
+
+    if (state->lz.is_match) {
+        state->curr = qp_internal_lz_window[(uint8_t)(state->lz.pos - state->lz.offset - 1)];
+    } else {
+        state->curr = qp_stream_get(state->src_stream);
+        if (state->curr < 0) {
+            return STREAM_EOF;
+        }
+    }
+
+    qp_internal_lz_window[state->lz.pos++] = state->curr;
+    state->lz.remain--;
+    return state->curr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Progressive pull of blocks of bytes
+
+static uint32_t qp_drawimage_block_uncompressed_decoder(void* cb_arg, uint8_t* buffer, uint32_t length) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+    return qp_stream_read(buffer, 1, length, state->src_stream);
+}
+
+static uint32_t qp_drawimage_block_rle_decoder(void* cb_arg, uint8_t* buffer, uint32_t length) {
+    qp_internal_byte_input_state_t* state   = (qp_internal_byte_input_state_t*)cb_arg;
+    uint32_t                        written = 0;
+    while (written < length) {
+        // Work out if we're parsing the marker byte
+        if (state->rle.remain == 0) {
+            int16_t c = qp_stream_get(state->src_stream);
+            if (c < 0) {
+                return written;
+            }
+            if (c >= 128) {
+                state->rle.mode   = NON_REPEATING_RUN;
+                state->rle.remain = c - 127;
+            } else {
+                state->rle.mode   = REPEATING_RUN;
+                state->rle.remain = c;
+                state->curr       = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    return written;
+                }
+            }
+            continue;
+        }
+
+        // Copy as much of the run as fits
+        uint32_t count = length - written;
+        if (count > state->rle.remain) {
+            count = state->rle.remain;
+        }
+        if (state->rle.mode == REPEATING_RUN) {
+            memset(&buffer[written], state->curr, count);
+        } else if (qp_stream_read(&buffer[written], 1, count, state->src_stream) != count) {
+            return written;
+        }
+        state->rle.remain -= count;
+        written += count;
+    }
+    return written;
+}
+
+static uint32_t qp_drawimage_block_lz_decoder(void* cb_arg, uint8_t* buffer, uint32_t length) {
+    qp_internal_byte_input_state_t* state   = (qp_internal_byte_input_state_t*)cb_arg;
+    uint32_t                        written = 0;
+    while (written < length) {
+        if (state->lz.remain == 0 && !qp_drawimage_lz_next_run(state)) {
+            return written;
+        }
+
+        // Copy as much of the run as fits, keeping the window up to date as we go
+        uint8_t  count = (length - written) < state->lz.remain ? (length - written) : state->lz.remain;
+        uint8_t* out   = &buffer[written];
+        uint8_t  pos   = state->lz.pos;
+        if (state->lz.is_match) {
+            // Matches may overlap the bytes they produce, so this has to go byte by byte
+            uint8_t src = pos - state->lz.offset - 1;
+            for (uint8_t i = 0; i < count; ++i) {
+                out[i] = qp_internal_lz_window[pos++] = qp_internal_lz_window[src++];
+            }
+        } else {
+            if (qp_stream_read(out, 1, count, state->src_stream) != count) {
+                return written;
+            }
+            for (uint8_t i = 0; i < count; ++i) {
+                qp_internal_lz_window[pos++] = out[i];
+            }
+        }
+        state->lz.pos = pos;
+        state->lz.remain -= count;
+        written += count;
+    }
+    return written;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Progressive push of pixels
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -204,6 +337,96 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
     return ret;
 }
 
+// Number of bytes decoded at a time by qp_internal_block_appender, the palette indices they unpack to live on the stack alongside them
+#define QP_BLOCK_DECODE_BYTES 16
+
+bool qp_internal_block_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_block_input_callback input_callback, void* input_state) {
+    painter_driver_t* driver = (painter_driver_t*)device;
+    uint8_t           block[QP_BLOCK_DECODE_BYTES];
+
+    // Non-native pixel format
+    if (bpp <= 8) {
+        const uint8_t  pixel_bitmask   = (1 << bpp) - 1;
+        const uint8_t  pixels_per_byte = 8 / bpp;
+        const uint32_t max_pixels      = qp_internal_num_pixels_in_buffer(device);
+        uint32_t       write_pos       = 0;
+        uint8_t        indices[QP_BLOCK_DECODE_BYTES * 8];
+
+        while (pixel_count > 0) {
+            // Decode as many bytes as are needed, up to the size of the block
+            uint32_t byte_count = (pixel_count + pixels_per_byte - 1) / pixels_per_byte;
+            if (byte_count > sizeof(block)) {
+                byte_count = sizeof(block);
+            }
+            if (input_callback(input_state, block, byte_count) != byte_count) {
+                return false;
+            }
+
+            // Unpack the palette indices, least significant bits first
+            uint16_t block_pixels = byte_count * pixels_per_byte;
+            if (block_pixels > pixel_count) {
+                block_pixels = pixel_count;
+            }
+            for (uint16_t i = 0; i < block_pixels;) {
+                uint8_t byteval = block[i / pixels_per_byte];
+                for (uint8_t q = 0; q < pixels_per_byte && i < block_pixels; ++q, ++i) {
+                    indices[i] = byteval & pixel_bitmask;
+                    byteval >>= bpp;
+                }
+            }
+            pixel_count -= block_pixels;
+
+            // Hand the pixels to the driver in as few calls as the pixdata buffer allows
+            for (uint16_t done = 0; done < block_pixels;) {
+                uint32_t count = block_pixels - done;
+                if (count > max_pixels - write_pos) {
+                    count = max_pixels - write_pos;
+                }
+                if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, write_pos, count, &indices[done])) {
+                    return false;
+                }
+                write_pos += count;
+                done += count;
+
+                // If we've hit the transmit limit, send out the entire buffer and reset the write position
+                if (write_pos == max_pixels) {
+                    if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos)) {
+                        return false;
+                    }
+                    write_pos = 0;
+                }
+            }
+        }
+
+        // Any leftovers need transmission as well.
+        return write_pos == 0 || driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos);
+    }
+
+    // Native pixel format
+    if (bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
+        return false;
+    }
+
+    qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
+    uint32_t                        byte_count   = pixel_count * bpp / 8;
+    while (byte_count > 0) {
+        uint32_t block_bytes = byte_count < sizeof(block) ? byte_count : sizeof(block);
+        if (input_callback(input_state, block, block_bytes) != block_bytes) {
+            return false;
+        }
+        for (uint32_t i = 0; i < block_bytes; ++i) {
+            if (!qp_internal_byte_appender(block[i], &output_state)) {
+                return false;
+            }
+        }
+        byte_count -= block_bytes;
+    }
+
+    // Any leftovers need transmission as well.
+    return output_state.byte_write_pos == 0 || driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+}
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
@@ -212,6 +435,27 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.remain = 0;
+            input_state->lz.pos    = 0;
+            return qp_drawimage_byte_lz_decoder;
+        default:
+            return NULL;
+    }
+}
+
+qp_internal_block_input_callback qp_internal_prepare_block_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
+    switch (compression) {
+        case IMAGE_UNCOMPRESSED:
+            return qp_drawimage_block_uncompressed_decoder;
+        case IMAGE_COMPRESSED_RLE:
+            input_state->rle.mode   = MARKER_BYTE;
+            input_state->rle.remain = 0;
+            return qp_drawimage_block_rle_decoder;
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.remain = 0;
+            input_state->lz.pos    = 0;
+            return qp_drawimage_block_lz_decoder;
         default:
             return NULL;
     }
@@ -12,6 +12,25 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0 && QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE > 0
+#    define QP_GLYPH_ARENA_ENABLE
+_Static_assert(QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE <= UINT16_MAX, "QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE must be less than 64kB");
+#endif
+
+// Width and location of a single glyph's pixel data within the font
+typedef struct qff_glyph_t {
+    uint32_t code_point;
+    uint32_t data_offset;
+    uint8_t  width;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    uint16_t last_used; // glyph cache clock at the most recent lookup
+#endif
+#ifdef QP_GLYPH_ARENA_ENABLE
+    uint16_t pixels_offset; // start of the decompressed pixel data in the glyph arena
+    uint16_t pixels_length; // zero if the pixel data isn't cached
+#endif
+} qff_glyph_t;
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -32,10 +51,72 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    qff_glyph_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+    uint16_t    glyph_cache_clock;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph and string width caches
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+static void qp_glyph_cache_reset(qff_font_handle_t *qff_font) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        qff_font->glyph_cache[i] = (qff_glyph_t){.code_point = UINT32_MAX};
+    }
+    qff_font->glyph_cache_clock = 0;
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+#ifdef QP_GLYPH_ARENA_ENABLE
+static uint8_t  glyph_arena[QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE];
+static uint16_t glyph_arena_used = 0;
+
+static bool qp_glyph_arena_alloc(uint32_t length, uint16_t *offset) {
+    if (length == 0 || length > sizeof(glyph_arena)) {
+        return false;
+    }
+
+    // Out of space, so forget all the cached pixel data and start again
+    if (glyph_arena_used + length > sizeof(glyph_arena)) {
+        for (int i = 0; i < QUANTUM_PAINTER_NUM_FONTS; ++i) {
+            for (uint16_t j = 0; j < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++j) {
+                font_descriptors[i].glyph_cache[j].pixels_length = 0;
+            }
+        }
+        glyph_arena_used = 0;
+    }
+
+    *offset = glyph_arena_used;
+    glyph_arena_used += length;
+    return true;
+}
+#endif // QP_GLYPH_ARENA_ENABLE
+
+#if QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+typedef struct qp_textwidth_cache_entry_t {
+    qff_font_handle_t *font; // NULL if unused
+    uint16_t           last_used;
+    int16_t            width;
+    uint8_t            length;
+    char               str[QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH]; // not NUL-terminated
+} qp_textwidth_cache_entry_t;
+
+static qp_textwidth_cache_entry_t textwidth_cache[QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE];
+static uint16_t                   textwidth_cache_clock = 0;
+
+static void qp_textwidth_cache_forget_font(qff_font_handle_t *qff_font) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE; ++i) {
+        if (textwidth_cache[i].font == qff_font) {
+            textwidth_cache[i].font = NULL;
+        }
+    }
+}
+#endif // QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -106,6 +187,11 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Anything cached belonged to whichever font previously used this slot
+    qp_glyph_cache_reset(font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -151,6 +237,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+    // Don't let a font loaded into this slot later on pick up these widths
+    qp_textwidth_cache_forget_font(qff_font);
+#endif // QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -161,7 +252,7 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, qff_glyph_t *glyph, uint8_t height, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -214,7 +305,18 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Helper that works out where a glyph's pixel data starts, from the offset stored in the glyph tables
+static inline uint32_t qp_drawtext_glyph_data_offset(qff_font_handle_t *qff_font, uint32_t glyph_offset) {
+    return sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+           + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+           + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+           + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
+           + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+}
+
+// Helper that searches the font's glyph tables for a code point
+static inline bool qp_drawtext_read_glyph_info(qff_font_handle_t *qff_font, uint32_t code_point, qff_glyph_t *glyph) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,21 +333,9 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
+        glyph->code_point  = code_point;
+        glyph->width       = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+        glyph->data_offset = qp_drawtext_glyph_data_offset(qff_font, (glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
         return true;
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
@@ -266,21 +356,9 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             }
 
             if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
+                glyph->code_point  = code_point;
+                glyph->width       = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+                glyph->data_offset = qp_drawtext_glyph_data_offset(qff_font, (glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
                 return true;
             }
         }
@@ -292,6 +370,47 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
+// Helper that finds a glyph, either in the glyph cache or in the font itself. Returns NULL if the glyph isn't present.
+static inline qff_glyph_t *qp_drawtext_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, qff_glyph_t *scratch) {
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Once the clock wraps, every entry is treated as equally old
+    if (++qff_font->glyph_cache_clock == 0) {
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+            qff_font->glyph_cache[i].last_used = 0;
+        }
+        qff_font->glyph_cache_clock = 1;
+    }
+
+    qff_glyph_t *victim = &qff_font->glyph_cache[0];
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        qff_glyph_t *entry = &qff_font->glyph_cache[i];
+        if (entry->code_point == code_point) {
+            entry->last_used = qff_font->glyph_cache_clock;
+            return entry;
+        }
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    if (!qp_drawtext_read_glyph_info(qff_font, code_point, scratch)) {
+        return NULL;
+    }
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Replace the least recently used glyph
+    *victim           = *scratch;
+    victim->last_used = qff_font->glyph_cache_clock;
+#    ifdef QP_GLYPH_ARENA_ENABLE
+    victim->pixels_length = 0;
+#    endif // QP_GLYPH_ARENA_ENABLE
+    return victim;
+#else
+    return scratch;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
@@ -302,13 +421,14 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        qff_glyph_t  scratch;
+        qff_glyph_t *glyph = qp_drawtext_lookup_glyph(qff_font, code_point, &scratch);
+        if (!glyph) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, glyph, qff_font->base.line_height, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -325,11 +445,11 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, qff_glyph_t *glyph, uint8_t height, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
     // Increment the overall width by this glyph's width
-    state->width += width;
+    state->width += glyph->width;
 
     return true;
 }
@@ -347,13 +467,42 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_pixel_output_state_t *output_state;
 } code_point_iter_drawglyph_state_t;
 
+#ifdef QP_GLYPH_ARENA_ENABLE
+// Decompresses a glyph's pixel data into the glyph arena, leaving the glyph uncached if there's a problem
+static void qp_drawtext_cache_glyph_pixels(qff_font_handle_t *qff_font, qff_glyph_t *glyph, uint32_t pixel_count, code_point_iter_drawglyph_state_t *state) {
+    // The same amount of data qp_internal_appender() consumes
+    const uint8_t bpp    = qff_font->bpp;
+    uint32_t      length = bpp <= 8 ? (pixel_count + (8 / bpp) - 1) / (8 / bpp) : pixel_count * bpp / 8;
+    uint16_t      offset;
+    if (!qp_glyph_arena_alloc(length, &offset)) {
+        return;
+    }
+
+    if (qp_stream_setpos(&qff_font->stream, glyph->data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while caching glyph data\n");
+        return;
+    }
+
+    state->input_state->rle.mode  = MARKER_BYTE; // ignored if not using RLE
+    state->input_state->lz.remain = 0;           // ignored if not using LZ
+    for (uint32_t i = 0; i < length; ++i) {
+        int16_t byteval = state->input_callback(state->input_state);
+        if (byteval < 0) {
+            return;
+        }
+        glyph_arena[offset + i] = (uint8_t)byteval;
+    }
+
+    glyph->pixels_offset = offset;
+    glyph->pixels_length = length;
+}
+#endif // QP_GLYPH_ARENA_ENABLE
+
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, qff_glyph_t *glyph, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
-
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+    uint8_t                            width  = glyph->width;
 
     // Reset the output state
     state->output_state->pixel_write_pos = 0;
@@ -364,8 +513,31 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
+
+#ifdef QP_GLYPH_ARENA_ENABLE
+    // Stream cached glyphs straight out of RAM, without touching the font data
+    if (glyph->pixels_length == 0) {
+        qp_drawtext_cache_glyph_pixels(qff_font, glyph, pixel_count, state);
+    }
+    if (glyph->pixels_length > 0) {
+        qp_memory_stream_t              pixels      = qp_make_memory_stream(&glyph_arena[glyph->pixels_offset], glyph->pixels_length);
+        qp_internal_byte_input_state_t  input_state = {.device = state->device, .src_stream = &pixels.base};
+        qp_internal_byte_input_callback input       = qp_internal_prepare_input_state(&input_state, IMAGE_UNCOMPRESSED);
+        return qp_internal_appender(state->device, qff_font->bpp, pixel_count, input, &input_state);
+    }
+#endif // QP_GLYPH_ARENA_ENABLE
+
+    if (qp_stream_setpos(&qff_font->stream, glyph->data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    // Reset the input state's RLE/LZ mode, as each glyph's data starts afresh
+    state->input_state->rle.mode  = MARKER_BYTE; // ignored if not using RLE
+    state->input_state->lz.remain = 0;           // ignored if not using LZ
+
+    // Decode the pixel data for the glyph, and stream it
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
@@ -379,10 +551,50 @@ int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
         return false;
     }
 
+#if QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+    // Once the clock wraps, every entry is treated as equally old
+    if (++textwidth_cache_clock == 0) {
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE; ++i) {
+            textwidth_cache[i].last_used = 0;
+        }
+        textwidth_cache_clock = 1;
+    }
+
+    size_t                      length = strnlen(str, QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH + 1);
+    qp_textwidth_cache_entry_t *victim = &textwidth_cache[0];
+    if (length <= QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH) {
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE; ++i) {
+            qp_textwidth_cache_entry_t *entry = &textwidth_cache[i];
+            if (entry->font == qff_font && entry->length == length && memcmp(entry->str, str, length) == 0) {
+                entry->last_used = textwidth_cache_clock;
+                return entry->width;
+            }
+            if (!entry->font || (victim->font && entry->last_used < victim->last_used)) {
+                victim = entry;
+            }
+        }
+    }
+#endif // QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+
     // Create the codepoint iterator state
     code_point_iter_calcwidth_state_t state = {.width = 0};
     // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+    if (!qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state)) {
+        return 0;
+    }
+
+#if QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+    // Remember the width, replacing the least recently used entry
+    if (length <= QUANTUM_PAINTER_TEXTWIDTH_CACHE_MAX_LENGTH) {
+        victim->font      = qff_font;
+        victim->last_used = textwidth_cache_clock;
+        victim->width     = state.width;
+        victim->length    = length;
+        memcpy(victim->str, str, length);
+    }
+#endif // QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE > 0
+
+    return state.width;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -218,6 +218,33 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+#ifdef POINTING_DEVICE_MOTION_PIPELINE
+/**
+ * @brief Reads the pointing device into the motion pipeline
+ *
+ * Buttons go straight into the mouse report, motion is accumulated by the pipeline until the next report is sent.
+ *
+ */
+static void pointing_device_motion_read(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        else
+    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        endif
+        return;
+    }
+#    endif
+    report_mouse_t sample      = {.buttons = local_mouse_report.buttons};
+    sample                     = pointing_device_driver.get_report(sample);
+    local_mouse_report.buttons = sample.buttons;
+#    ifdef POINTING_DEVICE_MOTION_STATS
+    pointing_device_motion_sampled();
+#    endif
+    pointing_device_motion_add(sample);
+}
+#endif
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -233,6 +260,11 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_PIPELINE
+    // The sensor is read on every pass, its motion is kept until the next report
+    pointing_device_motion_read();
+#endif
+
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -241,40 +273,44 @@ __attribute__((weak)) bool pointing_device_task(void) {
     last_exec = timer_read32();
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_PIPELINE
+    local_mouse_report = pointing_device_motion_split(local_mouse_report);
+    local_mouse_report = pointing_device_task_kb(local_mouse_report);
+#else
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        if defined(SPLIT_POINTING_ENABLE)
+#            error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
+#        endif
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
+#        else
     if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
+#        endif
     {
-#endif
+#    endif
 
-#if defined(SPLIT_POINTING_ENABLE)
-#    if defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE)
+#        if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
         local_mouse_report         = pointing_device_driver.get_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
-#    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+#        elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
         local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver.get_report(local_mouse_report) : shared_mouse_report;
+#        else
+#            error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
+#        endif
 #    else
-#        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
-#    endif
-#else
     local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
+#    endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#    ifdef POINTING_DEVICE_MOTION_PIN
     }
-#endif
+#    endif
 
     // allow kb to intercept and modify report
-#if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
     if (is_keyboard_left()) {
         local_mouse_report  = pointing_device_adjust_by_defines(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines_right(shared_mouse_report);
@@ -283,9 +319,10 @@ __attribute__((weak)) bool pointing_device_task(void) {
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
     }
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
-#else
+#    else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
+#    endif
 #endif
     // automatic mouse layer function
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
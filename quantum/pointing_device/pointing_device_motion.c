@@ -0,0 +1,299 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_MOTION_PIPELINE
+
+#    include <stdlib.h>
+#    include <string.h>
+#    include "pointing_device.h"
+#    include "progmem.h"
+#    include "timer.h"
+#    include "util.h"
+
+/* Motion of the samples read since the last report, in 1/256ths of a count */
+static pointing_device_motion_t motion = {0};
+
+/* Speed estimate: counts read during the current millisecond, and the rate over the last one that ended */
+static uint16_t speed_time   = 0;
+static uint16_t speed_window = 0;
+static uint16_t speed        = 0;
+
+static bool scroll_mode = false;
+
+/* Part of the scrolling motion too small to make 1/256th of a step, in 1/256ths of a count */
+static int16_t scroll_remainder_h = 0;
+static int16_t scroll_remainder_v = 0;
+
+#    ifdef POINTING_DEVICE_ACCEL_CURVE
+static const uint16_t PROGMEM accel_curve[] = POINTING_DEVICE_ACCEL_CURVE;
+#    endif
+
+#    ifdef POINTING_DEVICE_MOTION_STATS
+static pointing_device_motion_stats_t motion_stats        = {0};
+static uint32_t                       motion_latency_total = 0;
+static uint32_t                       motion_accel_total   = 0;
+static uint32_t                       last_sample_time     = 0;
+static uint32_t                       last_report_time     = 0;
+static uint32_t                       first_pending_time   = 0;
+static bool                           motion_pending       = false;
+
+static inline void motion_stats_count(pointing_device_motion_stage_t stage, int32_t x, int32_t y, int32_t h, int32_t v) {
+    motion_stats.stage_counts[stage] += labs(x) + labs(y) + labs(h) + labs(v);
+}
+#    else
+#        define motion_stats_count(stage, x, y, h, v)
+#    endif
+
+/**
+ * @brief Weak function allowing for keyboard level adjustment of the acceleration gain
+ *
+ * @param[in] speed uint16_t speed in counts per millisecond
+ * @param[in] gain uint16_t gain of the acceleration curve, in 1/256ths
+ * @return uint16_t gain to apply, pointing_device_motion_gain_user(speed, gain) by default
+ */
+__attribute__((weak)) uint16_t pointing_device_motion_gain_kb(uint16_t speed, uint16_t gain) {
+    return pointing_device_motion_gain_user(speed, gain);
+}
+
+/**
+ * @brief Weak function allowing for user level adjustment of the acceleration gain
+ *
+ * @param[in] speed uint16_t speed in counts per millisecond
+ * @param[in] gain uint16_t gain of the acceleration curve, in 1/256ths
+ * @return uint16_t gain to apply, gain by default
+ */
+__attribute__((weak)) uint16_t pointing_device_motion_gain_user(uint16_t speed, uint16_t gain) {
+    return gain;
+}
+
+/**
+ * @brief Looks up the acceleration curve
+ *
+ * Interpolates linearly between the points of POINTING_DEVICE_ACCEL_CURVE, which are POINTING_DEVICE_ACCEL_CURVE_STEP
+ * counts per millisecond apart. Beyond the last point the gain stays the same.
+ *
+ * @param[in] speed uint16_t speed in counts per millisecond
+ * @return uint16_t gain in 1/256ths, 256 when no curve is defined
+ */
+uint16_t pointing_device_motion_get_gain(uint16_t speed) {
+#    ifdef POINTING_DEVICE_ACCEL_CURVE
+    uint16_t index = speed / POINTING_DEVICE_ACCEL_CURVE_STEP;
+    if (index >= ARRAY_SIZE(accel_curve) - 1) {
+        return pgm_read_word(&accel_curve[ARRAY_SIZE(accel_curve) - 1]);
+    }
+    int32_t from = pgm_read_word(&accel_curve[index]);
+    int32_t to   = pgm_read_word(&accel_curve[index + 1]);
+    return from + (to - from) * (speed % POINTING_DEVICE_ACCEL_CURVE_STEP) / POINTING_DEVICE_ACCEL_CURVE_STEP;
+#    else
+    return POINTING_DEVICE_MOTION_ONE;
+#    endif
+}
+
+/**
+ * @brief Updates the speed estimate with the motion of a sample
+ *
+ * The sensor adds up motion between reads, so a sample carries all the motion since the previous one. Samples
+ * read within the same millisecond are added up before being turned into a rate.
+ *
+ * @param[in] counts uint16_t approximate length of the motion of the sample
+ * @return uint16_t speed in counts per millisecond
+ */
+static uint16_t pointing_device_motion_speed(uint16_t counts) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, speed_time);
+    if (elapsed) {
+        speed        = MIN((uint32_t)speed_window + counts, UINT16_MAX) / elapsed;
+        speed_window = 0;
+        speed_time   = now;
+        return speed;
+    }
+    speed_window = MIN((uint32_t)speed_window + counts, UINT16_MAX);
+    return MAX(speed, speed_window);
+}
+
+uint16_t pointing_device_motion_get_speed(void) {
+    return speed;
+}
+
+/**
+ * @brief Feeds a sensor sample through the motion pipeline
+ *
+ * Applies rotation and inversion, then either the acceleration curve or the conversion to scrolling, and adds the
+ * result to the motion that goes into the next report. Nothing is lost to rounding: fractions of a count stay in
+ * the accumulator until they add up to a whole one.
+ *
+ * @param[in] sample report_mouse_t as read from the sensor
+ */
+void pointing_device_motion_add(report_mouse_t sample) {
+    motion_stats_count(POINTING_DEVICE_STAGE_READ, sample.x, sample.y, sample.h, sample.v);
+    sample = pointing_device_adjust_by_defines(sample);
+    motion_stats_count(POINTING_DEVICE_STAGE_ORIENT, sample.x, sample.y, sample.h, sample.v);
+
+    if (!sample.x && !sample.y && !sample.h && !sample.v) {
+        pointing_device_motion_speed(0);
+        return;
+    }
+#    ifdef POINTING_DEVICE_MOTION_STATS
+    motion_stats.motion_samples++;
+    if (!motion_pending) {
+        first_pending_time = timer_read32();
+        motion_pending     = true;
+    }
+    pointing_device_motion_t before = motion;
+#    endif
+
+    // Wheel motion from the sensor is neither accelerated nor scaled
+    motion.h += (int32_t)sample.h * POINTING_DEVICE_MOTION_ONE;
+    motion.v += (int32_t)sample.v * POINTING_DEVICE_MOTION_ONE;
+
+    uint16_t ax     = abs(sample.x);
+    uint16_t ay     = abs(sample.y);
+    uint16_t counts = MAX(ax, ay) + MIN(ax, ay) / 2;
+    uint16_t rate   = pointing_device_motion_speed(counts);
+
+    if (scroll_mode) {
+        // Keep what the division leaves over, the divisor need not divide POINTING_DEVICE_MOTION_ONE
+        int32_t h          = (int32_t)sample.x * POINTING_DEVICE_MOTION_ONE + scroll_remainder_h;
+        int32_t v          = (int32_t)sample.y * POINTING_DEVICE_MOTION_ONE + scroll_remainder_v;
+        scroll_remainder_h = h % POINTING_DEVICE_SCROLL_DIVISOR;
+        scroll_remainder_v = v % POINTING_DEVICE_SCROLL_DIVISOR;
+        motion.h += h / POINTING_DEVICE_SCROLL_DIVISOR;
+        motion.v += v / POINTING_DEVICE_SCROLL_DIVISOR;
+    } else {
+        uint16_t gain = pointing_device_motion_gain_kb(rate, pointing_device_motion_get_gain(rate));
+        motion.x += (int32_t)sample.x * gain;
+        motion.y += (int32_t)sample.y * gain;
+    }
+
+#    ifdef POINTING_DEVICE_MOTION_STATS
+    motion_accel_total += labs(motion.x - before.x) + labs(motion.y - before.y) + labs(motion.h - before.h) + labs(motion.v - before.v);
+    motion_stats.stage_counts[POINTING_DEVICE_STAGE_ACCEL] += motion_accel_total >> POINTING_DEVICE_MOTION_FRACTION_BITS;
+    motion_accel_total &= POINTING_DEVICE_MOTION_ONE - 1;
+#    endif
+}
+
+/**
+ * @brief Moves whole counts from the accumulator into a report field
+ *
+ * Adds as much of the accumulated motion as the field can carry, keeping the fraction and what did not fit for the
+ * next report. No more than a full report is kept back, so a long burst does not keep the pointer moving afterwards.
+ *
+ * @param[in] accumulated int32_t motion in 1/256ths of a count
+ * @param[in] current int32_t value already in the report
+ * @param[in] min int32_t smallest value the report can carry
+ * @param[in] max int32_t largest value the report can carry
+ * @param[out] clamped bool set when not all the whole counts fitted
+ * @return int32_t new value for the report
+ */
+static int32_t pointing_device_motion_take(int32_t *accumulated, int32_t current, int32_t min, int32_t max, bool *clamped) {
+    int32_t value = current + *accumulated / POINTING_DEVICE_MOTION_ONE;
+    if (value < min) {
+        value    = min;
+        *clamped = true;
+    } else if (value > max) {
+        value    = max;
+        *clamped = true;
+    }
+    *accumulated -= (value - current) * POINTING_DEVICE_MOTION_ONE;
+    *accumulated = MIN(MAX(*accumulated, min * POINTING_DEVICE_MOTION_ONE), max * POINTING_DEVICE_MOTION_ONE);
+    return value;
+}
+
+/**
+ * @brief Moves the motion accumulated since the last report into a report
+ *
+ * @param[in] mouse_report report_mouse_t to add the motion to
+ * @return report_mouse_t with the whole counts added, within what the report can carry
+ */
+report_mouse_t pointing_device_motion_split(report_mouse_t mouse_report) {
+    bool clamped = false;
+#    ifdef POINTING_DEVICE_MOTION_STATS
+    report_mouse_t before = mouse_report;
+#    endif
+
+    mouse_report.x = pointing_device_motion_take(&motion.x, mouse_report.x, XY_REPORT_MIN, XY_REPORT_MAX, &clamped);
+    mouse_report.y = pointing_device_motion_take(&motion.y, mouse_report.y, XY_REPORT_MIN, XY_REPORT_MAX, &clamped);
+    mouse_report.h = pointing_device_motion_take(&motion.h, mouse_report.h, INT8_MIN, INT8_MAX, &clamped);
+    mouse_report.v = pointing_device_motion_take(&motion.v, mouse_report.v, INT8_MIN, INT8_MAX, &clamped);
+
+#    ifdef POINTING_DEVICE_MOTION_STATS
+    if (mouse_report.x == before.x && mouse_report.y == before.y && mouse_report.h == before.h && mouse_report.v == before.v) {
+        return mouse_report;
+    }
+    motion_stats_count(POINTING_DEVICE_STAGE_REPORT, mouse_report.x - before.x, mouse_report.y - before.y, mouse_report.h - before.h, mouse_report.v - before.v);
+
+    uint32_t now = timer_read32();
+    if (motion_stats.reports) {
+        motion_stats.report_period_max = MIN(MAX(motion_stats.report_period_max, TIMER_DIFF_32(now, last_report_time)), UINT16_MAX);
+    }
+    last_report_time = now;
+
+    uint32_t latency = MIN(TIMER_DIFF_32(now, first_pending_time), UINT16_MAX);
+    motion_stats.latency_max = MAX(motion_stats.latency_max, latency);
+    motion_latency_total += latency;
+    motion_stats.reports++;
+    motion_stats.clamped += clamped;
+
+    // Whatever is left over has been waiting since this report
+    first_pending_time = now;
+    motion_pending     = motion.x || motion.y || motion.h || motion.v;
+#    else
+    (void)clamped;
+#    endif
+    return mouse_report;
+}
+
+void pointing_device_motion_get(pointing_device_motion_t *motion_out) {
+    *motion_out = motion;
+}
+
+void pointing_device_motion_clear(void) {
+    memset(&motion, 0, sizeof(motion));
+    scroll_remainder_h = 0;
+    scroll_remainder_v = 0;
+#    ifdef POINTING_DEVICE_MOTION_STATS
+    motion_pending = false;
+#    endif
+}
+
+/**
+ * @brief Turns motion into scrolling instead of moving the cursor
+ *
+ * Motion accumulated so far is dropped, so that none of it ends up on the wrong axes.
+ *
+ * @param[in] scroll bool true to scroll
+ */
+void pointing_device_set_scroll_mode(bool scroll) {
+    if (scroll != scroll_mode) {
+        pointing_device_motion_clear();
+        scroll_mode = scroll;
+    }
+}
+
+bool pointing_device_get_scroll_mode(void) {
+    return scroll_mode;
+}
+
+#    ifdef POINTING_DEVICE_MOTION_STATS
+void pointing_device_motion_sampled(void) {
+    uint32_t now = timer_read32();
+    if (motion_stats.samples) {
+        motion_stats.sample_period_max = MIN(MAX(motion_stats.sample_period_max, TIMER_DIFF_32(now, last_sample_time)), UINT16_MAX);
+    }
+    last_sample_time = now;
+    motion_stats.samples++;
+}
+
+void get_pointing_device_motion_stats(pointing_device_motion_stats_t *stats) {
+    *stats             = motion_stats;
+    stats->latency_avg = motion_stats.reports ? motion_latency_total / motion_stats.reports : 0;
+}
+
+void clear_pointing_device_motion_stats(void) {
+    memset(&motion_stats, 0, sizeof(motion_stats));
+    motion_latency_total = 0;
+    motion_accel_total   = 0;
+}
+#    endif
+
+#endif // POINTING_DEVICE_MOTION_PIPELINE
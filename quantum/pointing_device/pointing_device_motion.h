@@ -0,0 +1,71 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+/* check settings and set defaults */
+#ifndef POINTING_DEVICE_MOTION_PIPELINE
+#    error "POINTING_DEVICE_MOTION_PIPELINE not defined! check config settings"
+#endif
+
+#if defined(SPLIT_POINTING_ENABLE)
+#    error POINTING_DEVICE_MOTION_PIPELINE is not supported when sharing the pointing device report between sides.
+#endif
+
+// Motion is accumulated in 1/256ths of a sensor count, so fractions are carried over to the next report
+#define POINTING_DEVICE_MOTION_FRACTION_BITS 8
+#define POINTING_DEVICE_MOTION_ONE (1 << POINTING_DEVICE_MOTION_FRACTION_BITS)
+
+#ifndef POINTING_DEVICE_ACCEL_CURVE_STEP
+#    define POINTING_DEVICE_ACCEL_CURVE_STEP 4 // counts per millisecond between two points of the acceleration curve
+#endif
+#ifndef POINTING_DEVICE_SCROLL_DIVISOR
+#    define POINTING_DEVICE_SCROLL_DIVISOR 8 // counts of motion per scroll step while scrolling
+#endif
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} pointing_device_motion_t;
+
+void           pointing_device_motion_add(report_mouse_t sample);                 // Feed one sensor sample through rotation, acceleration and scrolling
+report_mouse_t pointing_device_motion_split(report_mouse_t mouse_report);         // Move the whole counts accumulated so far into a report, keeping the fractions
+void           pointing_device_motion_get(pointing_device_motion_t *motion);      // Copy the motion accumulated since the last report, in 1/256ths of a count
+void           pointing_device_motion_clear(void);                                // Drop the motion accumulated since the last report
+uint16_t       pointing_device_motion_get_speed(void);                            // Current speed in counts per millisecond, as used by the acceleration curve
+uint16_t       pointing_device_motion_get_gain(uint16_t speed);                   // Gain of the acceleration curve at a speed, in 1/256ths
+void           pointing_device_set_scroll_mode(bool scroll);                      // Turn motion into scrolling instead of moving the cursor
+bool           pointing_device_get_scroll_mode(void);                             // True while motion is turned into scrolling
+uint16_t       pointing_device_motion_gain_kb(uint16_t speed, uint16_t gain);     // Adjust the acceleration gain at keyboard level
+uint16_t       pointing_device_motion_gain_user(uint16_t speed, uint16_t gain);   // Adjust the acceleration gain at user level
+
+#ifdef POINTING_DEVICE_MOTION_STATS
+typedef struct {
+    uint32_t samples;           // Sensor reads since the last clear
+    uint32_t motion_samples;    // Sensor reads that returned motion
+    uint32_t reports;           // Reports that carried motion
+    uint32_t clamped;           // Reports that could not carry all the motion, the rest went into the next report
+    uint16_t sample_period_max; // Longest time between two sensor reads, in milliseconds
+    uint16_t report_period_max; // Longest time between two reports carrying motion, in milliseconds
+    uint16_t latency_avg;       // Average time from the first sample of a report to the report, in milliseconds
+    uint16_t latency_max;       // Longest time from the first sample of a report to the report, in milliseconds
+    uint32_t stage_counts[4];   // Counts of motion that came out of each stage, see pointing_device_motion_stage_t
+} pointing_device_motion_stats_t;
+
+typedef enum {
+    POINTING_DEVICE_STAGE_READ,   // As read from the sensor
+    POINTING_DEVICE_STAGE_ORIENT, // After rotation and inversion
+    POINTING_DEVICE_STAGE_ACCEL,  // After the acceleration curve, before being split into reports
+    POINTING_DEVICE_STAGE_REPORT, // As sent in reports
+} pointing_device_motion_stage_t;
+
+void pointing_device_motion_sampled(void);                                  // Count a sensor read, with or without motion
+void get_pointing_device_motion_stats(pointing_device_motion_stats_t *stats); // Copy the current pipeline telemetry, suitable for sending over raw HID
+void clear_pointing_device_motion_stats(void);                                // Reset the pipeline telemetry
+#endif
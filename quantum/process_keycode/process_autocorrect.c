@@ -188,6 +188,129 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_DAWG
+#    define autocorrect_strcpy strcpy
+#    define autocorrect_send_string send_string
+#    define AUTOCORRECT_CORRECT_LENGTH (AUTOCORRECT_MAX_LENGTH + AUTOCORRECT_DAWG_MAX_CHANGES)
+
+/**
+ * @brief reads a link to another node in the DAWG
+ *
+ * @param state offset of the link in `autocorrect_data`
+ * @return offset of the linked node
+ */
+static inline uint32_t autocorrect_read_link(uint32_t state) {
+    uint32_t link = pgm_read_byte(autocorrect_data + state) | (uint16_t)pgm_read_byte(autocorrect_data + state + 1) << 8;
+#    if AUTOCORRECT_DAWG_LINK_BYTES > 2
+    link |= (uint32_t)pgm_read_byte(autocorrect_data + state + 2) << 16;
+#    endif
+    return link;
+}
+
+/**
+ * @brief maps a buffered keycode to its symbol in the DAWG
+ */
+static inline uint8_t autocorrect_symbol(uint8_t keycode) {
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            return keycode - KC_A;
+        case KC_QUOTE:
+            return 26;
+        default:
+            return 27; // word break
+    }
+}
+
+/**
+ * @brief maps a buffered keycode to the character it types
+ */
+static inline char autocorrect_char(uint8_t keycode) {
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            return keycode - KC_A + 'a';
+        case KC_QUOTE:
+            return '\'';
+        default:
+            return ' ';
+    }
+}
+#else
+#    define autocorrect_strcpy strcpy_P
+#    define autocorrect_send_string send_string_P
+#    define AUTOCORRECT_CORRECT_LENGTH (AUTOCORRECT_MAX_LENGTH + 10) // let's hope this is big enough
+#endif
+
+/**
+ * @brief applies the correction once a typo has been found
+ *
+ * @param keycode the keycode completing the typo
+ * @param backspaces number of characters to remove
+ * @param changes string to replace them with, in PROGMEM unless using a DAWG
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_correct_typo(uint16_t keycode, uint8_t backspaces, const char *changes) {
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_CORRECT_LENGTH] = {0};
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    autocorrect_strcpy(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        autocorrect_send_string(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -278,6 +401,58 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
+#ifdef AUTOCORRECT_DAWG
+    // Check for typo in buffer using a DAWG stored in `autocorrect_data`.
+    uint32_t state = 0;
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const code   = pgm_read_byte(autocorrect_data + state);
+        uint8_t const symbol = autocorrect_symbol(typo_buffer[i]);
+
+        if (!(code & 64)) { // Check for match in a chain node.
+            if ((code & 31) != symbol) return true;
+            // Follow link to child node, unless it follows on directly.
+            state = (code & 32) ? autocorrect_read_link(state + 1) : state + 1;
+        } else if (!(code & 32)) { // Check for match in node with a few children.
+            uint8_t const count = code & 31;
+            uint8_t       child = 0;
+            while (pgm_read_byte(autocorrect_data + state + 1 + child) != symbol) {
+                if (++child == count) return true;
+            }
+            state = autocorrect_read_link(state + 1 + count + child * AUTOCORRECT_DAWG_LINK_BYTES);
+        } else { // Check for match in node with many children, where the bitmap gives the child's index.
+            uint32_t const bitmap = (uint32_t)(code & 31) << 24 | pgm_read_byte(autocorrect_data + state + 1) | (uint32_t)pgm_read_byte(autocorrect_data + state + 2) << 8 | (uint32_t)pgm_read_byte(autocorrect_data + state + 3) << 16;
+            if (!(bitmap & ((uint32_t)1 << symbol))) return true;
+            uint8_t const child = __builtin_popcountl(bitmap & (((uint32_t)1 << symbol) - 1));
+            state               = autocorrect_read_link(state + 4 + child * AUTOCORRECT_DAWG_LINK_BYTES);
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return true;
+        }
+
+        uint8_t const leaf = pgm_read_byte(autocorrect_data + state);
+        if (leaf & 128) { // A typo was found! Apply autocorrect.
+            // The edit is relative to the start of the typo, which occupies the rest of the buffer minus any word breaks.
+            uint8_t const start   = i + (typo_buffer[i] == KC_SPC);
+            uint8_t const end     = typo_buffer_size - (keycode == KC_SPC);
+            uint8_t const keep    = pgm_read_byte(autocorrect_data + state + 1);
+            uint8_t const deleted = leaf & 127;
+
+            // The inserted text, followed by the rest of the typo, as it was typed.
+            char    changes[AUTOCORRECT_DAWG_MAX_CHANGES + 1];
+            uint8_t length = strlen_P((const char *)(autocorrect_data + state + 2));
+            memcpy_P(changes, autocorrect_data + state + 2, length);
+            for (uint8_t j = start + keep + deleted; j < end; ++j) {
+                changes[length++] = autocorrect_char(typo_buffer[j]);
+            }
+            changes[length] = 0;
+
+            return autocorrect_correct_typo(keycode, end - start - keep - 1 + (keycode == KC_SPC), changes);
+        }
+    }
+#else
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
     uint16_t state = 0;
     uint8_t  code  = pgm_read_byte(autocorrect_data + state);
@@ -310,66 +485,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             const uint8_t backspaces = (code & 63) + !record->event.pressed;
             const char *  changes    = (const char *)(autocorrect_data + state + 1);
 
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_correct_typo(keycode, backspaces, changes);
         }
     }
+#endif
     return true;
 }
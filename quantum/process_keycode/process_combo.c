@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -141,6 +142,54 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
         } while (0)
 #endif
 
+#ifdef COMBO_INDEX_BUCKETS
+_Static_assert(COMBO_INDEX_BUCKETS <= 32 && (COMBO_INDEX_BUCKETS & (COMBO_INDEX_BUCKETS - 1)) == 0, "COMBO_INDEX_BUCKETS must be a power of two, up to 32");
+
+#    define COMBO_INDEX_BUCKET(keycode) ((uint8_t)(((keycode) ^ ((keycode) >> 8)) & (COMBO_INDEX_BUCKETS - 1)))
+
+/* Each bucket holds a bitset of the combos with at least one key hashing to
+ * it. Combos past combo_index_count (e.g. added dynamically through
+ * combo_count()) are not indexed and always checked. */
+static bool     combo_index_valid     = false;
+static uint16_t combo_index_count     = 0;
+static uint32_t combo_touched_buckets = 0;
+
+static void combo_index_build(void) {
+    uint16_t size = combo_index_bucket_size_raw();
+    for (uint8_t bucket = 0; bucket < COMBO_INDEX_BUCKETS; ++bucket) {
+        memset(combo_index_bucket_raw(bucket), 0, size);
+    }
+
+    combo_index_count = MIN(combo_count(), size * 8);
+    for (uint16_t idx = 0; idx < combo_index_count; ++idx) {
+        combo_t *combo = combo_get(idx);
+        uint16_t key;
+        for (uint8_t key_idx = 0; (key = pgm_read_word(&combo->keys[key_idx])) != COMBO_END; ++key_idx) {
+            combo_index_bucket_raw(COMBO_INDEX_BUCKET(key))[idx / 8] |= 1 << (idx % 8);
+        }
+    }
+
+    combo_touched_buckets = (uint32_t)-1;
+    combo_index_valid     = true;
+}
+
+static inline uint16_t combo_index_next(const uint8_t *candidates, uint16_t idx) {
+    while (idx < combo_index_count) {
+        uint8_t bits = candidates[idx / 8] >> (idx % 8);
+        if (bits) {
+            while (!(bits & 1)) {
+                bits >>= 1;
+                idx++;
+            }
+            return idx;
+        }
+        // skip the rest of this byte
+        idx = (idx | 7) + 1;
+    }
+    return idx;
+}
+#endif
+
 static inline void release_combo(uint16_t combo_index, combo_t *combo) {
     if (combo->keycode) {
         keyrecord_t record = {
@@ -194,7 +243,31 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
-    for (index = 0; index < combo_count(); ++index) {
+#ifdef COMBO_INDEX_BUCKETS
+    if (combo_index_valid) {
+        /* Only combos sharing a bucket with a key processed since the last
+         * clear can have picked up any state. */
+        for (uint16_t byte = 0; byte < (combo_index_count + 7) / 8; ++byte) {
+            uint8_t touched = 0;
+            for (uint32_t buckets = combo_touched_buckets, bucket = 0; buckets; buckets >>= 1, ++bucket) {
+                if (buckets & 1) {
+                    touched |= combo_index_bucket_raw(bucket)[byte];
+                }
+            }
+            for (uint8_t bit = 0; touched; ++bit, touched >>= 1) {
+                if (touched & 1) {
+                    combo_t *combo = combo_get(byte * 8 + bit);
+                    if (!COMBO_ACTIVE(combo)) {
+                        RESET_COMBO_STATE(combo);
+                    }
+                }
+            }
+        }
+        combo_touched_buckets = 0;
+        index                 = combo_index_count;
+    }
+#endif
+    for (; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
@@ -535,8 +608,7 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool is_combo_key = false;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -564,10 +636,23 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
+#ifdef COMBO_INDEX_BUCKETS
+    if (!combo_index_valid) {
+        combo_index_build();
+    }
+
+    /* Combos without a key in this keycode's bucket can't contain it, and
+     * process_single_combo() would leave them untouched anyway. */
+    const uint8_t  bucket     = COMBO_INDEX_BUCKET(keycode);
+    const uint8_t *candidates = combo_index_bucket_raw(bucket);
+    combo_touched_buckets |= (uint32_t)1 << bucket;
+
+    for (uint16_t idx = combo_index_next(candidates, 0); idx < combo_count(); idx = combo_index_next(candidates, idx + 1)) {
+#else
     for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+#endif
         combo_t *combo = combo_get(idx);
         is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -627,6 +712,10 @@ void combo_task(void) {
 
 void combo_enable(void) {
     b_combo_enable = true;
+#ifdef COMBO_INDEX_BUCKETS
+    // Combos may have been changed while disabled, rebuild the index on next use
+    combo_index_valid = false;
+#endif
 }
 
 void combo_disable(void) {
@@ -39,6 +39,10 @@
 #    define COMBO_BUFFER_LENGTH 4
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef struct combo_t {
     const uint16_t *keys;
     uint16_t        keycode;
@@ -81,3 +85,7 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef __cplusplus
+}
+#endif
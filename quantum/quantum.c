@@ -72,6 +72,10 @@
 #    include "process_unicode_common.h"
 #endif
 
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_BACK_CACHE)
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -178,6 +182,10 @@ __attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+#ifdef HOST_REPORT_QUEUE_SIZE
+    // Queued reports, including the releases from clear_keyboard(), have to reach the host before it goes away
+    host_report_queue_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -198,6 +206,10 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_BACK_CACHE)
+    // Settings changed during shutdown_kb() must reach the driver too
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -260,141 +272,227 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
-/* Core keycode function, hands off handling to other functions,
-    then processes internal quantum keycodes, and then processes
-    ACTIONs.                                                      */
-bool process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
+#define PROCESS_EVENT_PRESS (1 << 0)
+#define PROCESS_EVENT_RELEASE (1 << 1)
+#define PROCESS_EVENT_ANY (PROCESS_EVENT_PRESS | PROCESS_EVENT_RELEASE)
 
-    // This is how you use actions here
-    // if (keycode == QK_LEADER) {
-    //   action_t action;
-    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
-    //   process_action(record, action);
-    //   return false;
-    // }
-
-#if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
-        return false;
-    }
-#endif
+typedef struct {
+    bool (*process)(uint16_t keycode, keyrecord_t *record);
+    uint16_t first;
+    uint16_t last;
+    uint8_t  events;
+} process_record_handler_t;
 
-#ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
-        // The tap dance might have updated the layer state, therefore the
-        // result of the keycode lookup might change.
-        keycode = get_record_keycode(record, true);
-    }
-#endif
+// Handlers that record, interrupt or react to every key
+#define PROCESS_HANDLER_ALL(fn) {fn, 0, UINT16_MAX, PROCESS_EVENT_ANY}
+// Handlers that only act on their own keycodes, and only on the given events
+#define PROCESS_HANDLER_RANGE(fn, first, last, events) {fn, first, last, events}
 
-#ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
-        preprocess_rgblight();
-    }
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+static bool process_rgb_handler(uint16_t keycode, keyrecord_t *record) {
+    return process_rgb(keycode, record);
+}
+#    ifdef RGB_TRIGGER_ON_KEYDOWN
+#        define PROCESS_RGB_EVENTS PROCESS_EVENT_PRESS
+#    else
+#        define PROCESS_RGB_EVENTS PROCESS_EVENT_RELEASE
+#    endif
 #endif
-
-#ifdef WPM_ENABLE
-    if (record->event.pressed) {
-        update_wpm(keycode);
-    }
+#ifdef KEY_OVERRIDE_ENABLE
+static bool process_key_override_handler(uint16_t keycode, keyrecord_t *record) {
+    return process_key_override(keycode, record);
+}
 #endif
 
-    if (!(
-#if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
+/* The process_record_quantum handler chain, in the order the handlers run.
+ * The table is fixed at compile time; a key skips any handler whose range
+ * and events it falls outside of, which is the same as that handler
+ * returning true without doing anything. */
+// clang-format off
+static const process_record_handler_t PROGMEM process_record_handlers_table[] = {
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+    // Must run asap to ensure all keypresses are recorded.
+    PROCESS_HANDLER_ALL(process_dynamic_macro),
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_last_key),
+    PROCESS_HANDLER_ALL(process_repeat_key),
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_clicky),
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_haptic),
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_record_via),
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_auto_mouse),
 #endif
-            process_record_kb(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_record_kb),
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_secure),
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX, PROCESS_EVENT_PRESS),
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_midi, QK_MIDI, QK_MIDI_MAX, PROCESS_EVENT_ANY),
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_audio, QK_AUDIO, QK_AUDIO_MAX, PROCESS_EVENT_PRESS),
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_EVENT_PRESS),
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_led_matrix, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_EVENT_PRESS),
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_steno, QK_STENO, QK_STENO_MAX, PROCESS_EVENT_ANY),
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_music),
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_caps_word),
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_key_override_handler),
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_tap_dance),
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_unicode_common),
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_leader),
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_auto_shift),
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN, PROCESS_EVENT_PRESS),
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+    // Resets on any other key press
+    PROCESS_HANDLER_ALL(process_space_cadet),
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_magic, QK_MAGIC, QK_MAGIC_MAX, PROCESS_EVENT_PRESS),
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_grave_esc, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE, PROCESS_EVENT_ANY),
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_rgb(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_rgb_handler, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_RGB_EVENTS),
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX, PROCESS_EVENT_ANY),
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX, PROCESS_EVENT_ANY),
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+    PROCESS_HANDLER_ALL(process_autocorrect),
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+    PROCESS_HANDLER_RANGE(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER, PROCESS_EVENT_ANY),
+#endif
+};
+// clang-format on
+
+#ifdef PROCESS_RECORD_HANDLER_STATS
+static uint32_t process_record_handler_calls = 0;
+
+uint8_t process_record_handler_count(void) {
+    return ARRAY_SIZE(process_record_handlers_table);
+}
+
+uint32_t process_record_handler_invocations(void) {
+    return process_record_handler_calls;
+}
+
+void process_record_handler_invocations_reset(void) {
+    process_record_handler_calls = 0;
+}
+#endif
+
+static bool process_record_handlers(uint16_t keycode, keyrecord_t *record) {
+    const uint8_t event = record->event.pressed ? PROCESS_EVENT_PRESS : PROCESS_EVENT_RELEASE;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(process_record_handlers_table); i++) {
+        const process_record_handler_t *entry = &process_record_handlers_table[i];
+        if (keycode < pgm_read_word(&entry->first) || keycode > pgm_read_word(&entry->last) || !(pgm_read_byte(&entry->events) & event)) {
+            continue;
+        }
+#ifdef PROCESS_RECORD_HANDLER_STATS
+        process_record_handler_calls++;
 #endif
-            true)) {
+        bool (*process)(uint16_t, keyrecord_t *) = pgm_read_ptr(&entry->process);
+        if (!process(keycode, record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Core keycode function, hands off handling to other functions,
+    then processes internal quantum keycodes, and then processes
+    ACTIONs.                                                      */
+bool process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, true);
+
+    // This is how you use actions here
+    // if (keycode == QK_LEADER) {
+    //   action_t action;
+    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
+    //   process_action(record, action);
+    //   return false;
+    // }
+
+#if defined(SECURE_ENABLE)
+    if (!preprocess_secure(keycode, record)) {
+        return false;
+    }
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+    if (preprocess_tap_dance(keycode, record)) {
+        // The tap dance might have updated the layer state, therefore the
+        // result of the keycode lookup might change.
+        keycode = get_record_keycode(record, true);
+    }
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+    if (record->event.pressed) {
+        preprocess_rgblight();
+    }
+#endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_BUFFER_SIZE) && defined(SEND_STRING_ASYNC_CANCEL_ON_KEYPRESS)
+    if (record->event.pressed) {
+        send_string_async_cancel();
+    }
+#endif
+
+#ifdef WPM_ENABLE
+    if (record->event.pressed) {
+        update_wpm(keycode);
+    }
+#endif
+
+#if defined(KEY_LOCK_ENABLE)
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
+        return false;
+    }
+#endif
+
+    if (!process_record_handlers(keycode, record)) {
         return false;
     }
 
@@ -510,6 +608,9 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 }
 
 void suspend_power_down_quantum(void) {
+#ifdef HOST_REPORT_QUEUE_SIZE
+    host_report_queue_flush();
+#endif
     suspend_power_down_kb();
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
@@ -555,6 +656,11 @@ void suspend_power_down_quantum(void) {
     pointing_device_task();
 #    endif
 #endif
+
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_BACK_CACHE)
+    // Power may be removed while suspended
+    eeprom_driver_flush();
+#endif
 }
 
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
@@ -259,6 +259,12 @@ bool     process_record_user(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_kb(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_user(uint16_t keycode, keyrecord_t *record);
 
+#ifdef PROCESS_RECORD_HANDLER_STATS
+uint8_t  process_record_handler_count(void);
+uint32_t process_record_handler_invocations(void);
+void     process_record_handler_invocations_reset(void);
+#endif
+
 void reset_keyboard(void);
 void soft_reset_keyboard(void);
 
@@ -16,35 +16,115 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
-void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
-#        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
-    // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-#        else
-    if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
-        return;
+// Cells with a non-zero temperature, so cold cells can skip the decay and colour conversion.
+static matrix_row_t heatmap_hot[MATRIX_ROWS];
+
+static inline void heatmap_heat(uint8_t row, uint8_t col, uint8_t amount) {
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], amount);
+    heatmap_hot[row] |= (matrix_row_t)1 << col;
+}
+
+#        if !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
+
+static uint8_t heatmap_spread_amount(uint8_t row, uint8_t col, uint8_t i_row, uint8_t i_col) {
+    uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
+    if (distance > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
+    }
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
     }
+    return amount;
+}
+
+#            undef LED_DISTANCE
+
+static void heatmap_spread_scan(uint8_t row, uint8_t col) {
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
                 continue;
             }
             if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                heatmap_heat(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
             } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
-                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+                uint8_t amount = heatmap_spread_amount(row, col, i_row, i_col);
+                if (amount) {
+                    heatmap_heat(i_row, i_col, amount);
+                }
+            }
+        }
+    }
+}
+
+#            ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col;
+    uint8_t amount;
+} heatmap_neighbor_t;
+
+// Keys within RGB_MATRIX_TYPING_HEATMAP_SPREAD of each key, built from g_led_config on first use.
+// A count of UINT8_MAX means the key has too many neighbors and falls back to scanning the matrix.
+static heatmap_neighbor_t heatmap_neighbors[MATRIX_ROWS][MATRIX_COLS][RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS];
+static uint8_t            heatmap_neighbor_count[MATRIX_ROWS][MATRIX_COLS];
+static bool               heatmap_neighbors_built = false;
+
+static void heatmap_build_neighbors(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t count = 0;
+            if (g_led_config.matrix_co[row][col] != NO_LED) {
+                for (uint8_t i_row = 0; i_row < MATRIX_ROWS && count != UINT8_MAX; i_row++) {
+                    for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                        if (g_led_config.matrix_co[i_row][i_col] == NO_LED || (i_row == row && i_col == col)) {
+                            continue;
+                        }
+                        uint8_t amount = heatmap_spread_amount(row, col, i_row, i_col);
+                        if (!amount) {
+                            continue;
+                        }
+                        if (count == RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS) {
+                            count = UINT8_MAX;
+                            break;
+                        }
+                        heatmap_neighbors[row][col][count++] = (heatmap_neighbor_t){.row = i_row, .col = i_col, .amount = amount};
                     }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
                 }
             }
+            heatmap_neighbor_count[row][col] = count;
+        }
+    }
+    heatmap_neighbors_built = true;
+}
+#            endif // RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS
+#        endif     // !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM)
+
+void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
+#        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
+    // Limit effect to pressed keys
+    heatmap_heat(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+#        else
+    if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
+        return;
+    }
+#            ifdef RGB_MATRIX_TYPING_HEATMAP_NEIGHBORS
+    if (!heatmap_neighbors_built) {
+        heatmap_build_neighbors();
+    }
+    uint8_t count = heatmap_neighbor_count[row][col];
+    if (count != UINT8_MAX) {
+        heatmap_heat(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+        for (uint8_t i = 0; i < count; i++) {
+            const heatmap_neighbor_t *neighbor = &heatmap_neighbors[row][col][i];
+            heatmap_heat(neighbor->row, neighbor->col, neighbor->amount);
         }
+        return;
     }
+#            endif
+    heatmap_spread_scan(row, col);
 #        endif
 }
 
@@ -59,6 +139,7 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
         memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+        memset(heatmap_hot, 0, sizeof heatmap_hot);
     }
 
     // The heatmap animation might run in several iterations depending on
@@ -73,21 +154,33 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         }
     }
 
+    // Every cold cell renders the same colour
+    HSV cold_hsv = {170, rgb_matrix_config.hsv.s, 0};
+    RGB cold_rgb = rgb_matrix_hsv_to_rgb(cold_hsv);
+
     // Render heatmap & decrease
     uint8_t count = 0;
     for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
         for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
-                uint8_t val = g_rgb_frame_buffer[row][col];
                 if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
 
-                HSV hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
-                RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
+                if (!(heatmap_hot[row] & ((matrix_row_t)1 << col))) {
+                    rgb_matrix_set_color(g_led_config.matrix_co[row][col], cold_rgb.r, cold_rgb.g, cold_rgb.b);
+                    continue;
+                }
+
+                uint8_t val = g_rgb_frame_buffer[row][col];
+                HSV     hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
+                RGB     rgb = rgb_matrix_hsv_to_rgb(hsv);
                 rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
 
                 if (decrease_heatmap_values) {
                     g_rgb_frame_buffer[row][col] = qsub8(val, 1);
+                    if (val <= 1) {
+                        heatmap_hot[row] &= ~((matrix_row_t)1 << col);
+                    }
                 }
             }
         }
@@ -21,6 +21,7 @@
 #include "eeprom.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "matrix.h"
 #include "sync_timer.h"
 #include "debug.h"
 #include <string.h>
@@ -35,10 +36,52 @@ const led_point_t k_rgb_matrix_center = {112, 32};
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
-__attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+static RGB rgb_matrix_hsv_to_rgb_default(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Weak alias rather than a weak definition, so that the batch conversion below can tell whether it was overridden
+RGB rgb_matrix_hsv_to_rgb(HSV hsv) __attribute__((weak, alias("rgb_matrix_hsv_to_rgb_default")));
+
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+    if (rgb_matrix_hsv_to_rgb == rgb_matrix_hsv_to_rgb_default) {
+        hsv_to_rgb_batch(hsv, rgb, count);
+        return;
+    }
+    // Keyboards that override rgb_matrix_hsv_to_rgb() still get their colors from it
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 8
+#endif
+
+// LED colors collected by the effect runners, converted to RGB a batch at a time
+typedef struct rgb_matrix_hsv_batch_t {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    HSV     hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+} rgb_matrix_hsv_batch_t;
+
+static void rgb_matrix_hsv_batch_flush(rgb_matrix_hsv_batch_t *batch) {
+    RGB rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        rgb_matrix_set_color(batch->index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    batch->count = 0;
+}
+
+static inline void rgb_matrix_hsv_batch_set(rgb_matrix_hsv_batch_t *batch, uint8_t index, HSV hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_hsv_batch_flush(batch);
+    }
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -60,6 +103,8 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
 // -----End rgb effect includes macros-------
 // ------------------------------------------
 
+_Static_assert(sizeof(rgb_config_t) == sizeof(uint64_t), "RGB Matrix EECONFIG out of spec.");
+
 // globals
 rgb_config_t rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
 uint32_t     g_rgb_timer;
@@ -68,7 +113,10 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+last_hit_lookup_t g_last_hit_lookup;
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
+#endif     // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // internals
 static bool            suspend_state     = false;
@@ -81,7 +129,13 @@ static rgb_task_states rgb_task_state    = SYNCING;
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 static last_hit_t last_hit_buffer;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+// The lookup is too large to double buffer. Hits recorded since the last frame started are applied to it when the next
+// one starts: the lookup drops its first last_hit_shift hits, then gets the hits of last_hit_buffer from last_hit_synced on.
+static uint8_t last_hit_shift  = 0;
+static uint8_t last_hit_synced = 0;
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
+#endif     // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
@@ -179,6 +233,10 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
         memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
         memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+        last_hit_shift  = MIN(last_hit_shift + led_count, LED_HITS_TO_REMEMBER);
+        last_hit_synced = last_hit_synced > led_count ? last_hit_synced - led_count : 0;
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
         last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
     }
 
@@ -255,8 +313,34 @@ static void rgb_task_timers(void) {
         }
         last_hit_buffer.tick[i] += deltaTime;
     }
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+    last_hit_synced = MIN(last_hit_synced, last_hit_buffer.count);
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
+#endif     // RGB_MATRIX_KEYREACTIVE_ENABLED
+}
+
+#ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+static void rgb_task_sync_last_hit_lookup(void) {
+    if (last_hit_shift) {
+        memmove(&g_last_hit_lookup.dist[0], &g_last_hit_lookup.dist[last_hit_shift], (LED_HITS_TO_REMEMBER - last_hit_shift) * RGB_MATRIX_LED_COUNT);
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            uint8_t hit                  = g_last_hit_lookup.led_hit[i];
+            g_last_hit_lookup.led_hit[i] = (hit == UINT8_MAX || hit < last_hit_shift) ? UINT8_MAX : hit - last_hit_shift;
+        }
+        last_hit_shift = 0;
+    }
+
+    for (uint8_t index = last_hit_synced; index < last_hit_buffer.count; index++) {
+        g_last_hit_lookup.led_hit[last_hit_buffer.index[index]] = index;
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+            int16_t dx                       = g_led_config.point[j].x - last_hit_buffer.x[index];
+            int16_t dy                       = g_led_config.point[j].y - last_hit_buffer.y[index];
+            g_last_hit_lookup.dist[index][j] = sqrt16(dx * dx + dy * dy);
+        }
+    }
+    last_hit_synced = last_hit_buffer.count;
 }
+#endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
 
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
@@ -272,7 +356,10 @@ static void rgb_task_start(void) {
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker = last_hit_buffer;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+    rgb_task_sync_last_hit_lookup();
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
+#endif     // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
     rgb_task_state = RENDERING;
@@ -458,6 +545,11 @@ void rgb_matrix_init(void) {
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+    memset(g_last_hit_lookup.led_hit, UINT8_MAX, sizeof(g_last_hit_lookup.led_hit));
+    last_hit_shift  = 0;
+    last_hit_synced = 0;
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     eeconfig_init_rgb_matrix();
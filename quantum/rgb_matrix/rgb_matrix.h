@@ -273,6 +273,9 @@ extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+extern last_hit_lookup_t g_last_hit_lookup;
+#    endif
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
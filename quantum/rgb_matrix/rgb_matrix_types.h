@@ -38,7 +38,15 @@ typedef struct PACKED {
     uint8_t  index[LED_HITS_TO_REMEMBER];
     uint16_t tick[LED_HITS_TO_REMEMBER];
 } last_hit_t;
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
+#    ifdef RGB_MATRIX_KEYREACTIVE_LOOKUP
+// Indexed like the hits of g_last_hit_tracker, and only updated along with it
+typedef struct PACKED {
+    uint8_t led_hit[RGB_MATRIX_LED_COUNT];                     // most recent hit of each led, UINT8_MAX if none
+    uint8_t dist[LED_HITS_TO_REMEMBER][RGB_MATRIX_LED_COUNT]; // distance from each hit to every led
+} last_hit_lookup_t;
+#    endif // RGB_MATRIX_KEYREACTIVE_LOOKUP
+#endif     // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
 
@@ -83,5 +91,3 @@ typedef union {
         led_flags_t flags;
     };
 } rgb_config_t;
-
-_Static_assert(sizeof(rgb_config_t) == sizeof(uint64_t), "RGB Matrix EECONFIG out of spec.");
@@ -18,11 +18,13 @@
 
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
 #include "wait.h"
+#include "timer.h"
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
@@ -336,3 +338,307 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     }
 }
 #endif
+
+#ifdef SEND_STRING_ASYNC_BUFFER_SIZE
+#    ifndef SEND_STRING_ASYNC_CHARS_PER_MS
+#        define SEND_STRING_ASYNC_CHARS_PER_MS 1
+#    endif
+
+_Static_assert(SEND_STRING_ASYNC_BUFFER_SIZE <= UINT16_MAX, "SEND_STRING_ASYNC_BUFFER_SIZE must fit in 16 bits");
+
+/* Each queued string is stored as its interval, its callback and then its
+ * characters including the null terminator.
+ */
+#    define ASYNC_HEADER_SIZE (1 + sizeof(send_string_async_callback_t))
+
+enum {
+    ASYNC_STEP_NEXT,
+    ASYNC_STEP_SHIFT_DOWN,
+    ASYNC_STEP_ALTGR_DOWN,
+    ASYNC_STEP_KEY_DOWN,
+    ASYNC_STEP_KEY_UP,
+    ASYNC_STEP_ALTGR_UP,
+    ASYNC_STEP_SHIFT_UP,
+    ASYNC_STEP_DEAD_DOWN,
+    ASYNC_STEP_DEAD_UP,
+};
+
+static uint8_t  async_buffer[SEND_STRING_ASYNC_BUFFER_SIZE];
+static uint16_t async_head;
+static uint16_t async_count;
+
+static bool                         async_in_string;
+static uint8_t                      async_interval;
+static send_string_async_callback_t async_callback;
+
+static uint8_t  async_step;
+static uint8_t  async_keycode;
+static bool     async_shifted;
+static bool     async_altgred;
+static bool     async_dead;
+static uint16_t async_next_step;
+static uint16_t async_ms;
+static uint8_t  async_chars_this_ms;
+
+/* Keys currently held down by queued strings, so they can be released on cancel */
+static uint8_t async_held[256 / 8];
+
+static uint8_t async_pop(void) {
+    uint8_t byte = async_buffer[async_head];
+    async_head   = (async_head + 1) % SEND_STRING_ASYNC_BUFFER_SIZE;
+    async_count--;
+    return byte;
+}
+
+static uint8_t async_peek(void) {
+    return async_buffer[async_head];
+}
+
+static void async_push(uint8_t byte) {
+    async_buffer[(async_head + async_count) % SEND_STRING_ASYNC_BUFFER_SIZE] = byte;
+    async_count++;
+}
+
+static void async_register(uint8_t keycode) {
+    async_held[keycode / 8] |= 1 << (keycode % 8);
+    register_code(keycode);
+}
+
+static void async_unregister(uint8_t keycode) {
+    async_held[keycode / 8] &= ~(1 << (keycode % 8));
+    unregister_code(keycode);
+}
+
+static void async_wait(uint16_t ms) {
+    async_next_step = timer_read() + ms;
+}
+
+static uint8_t async_read_ram(const uint8_t *address) {
+    return *address;
+}
+
+bool send_string_async_with_reader(const void *string, send_string_async_read_t read, uint8_t interval, send_string_async_callback_t callback) {
+    const uint8_t *address = string;
+    uint16_t       length  = 1;
+    while (read(address + length - 1) != 0) {
+        if (++length > SEND_STRING_ASYNC_BUFFER_SIZE) {
+            return false;
+        }
+    }
+    if (ASYNC_HEADER_SIZE + length > SEND_STRING_ASYNC_BUFFER_SIZE - async_count) {
+        return false;
+    }
+
+    if (!send_string_async_busy()) {
+        async_next_step = timer_read();
+    }
+    async_push(interval);
+    for (uint8_t i = 0; i < sizeof(callback); i++) {
+        async_push(((uint8_t *)&callback)[i]);
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        async_push(read(address + i));
+    }
+    return true;
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval, send_string_async_callback_t callback) {
+    return send_string_async_with_reader(string, async_read_ram, interval, callback);
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY, NULL);
+}
+
+#    if defined(__AVR__)
+static uint8_t async_read_progmem(const uint8_t *address) {
+    return pgm_read_byte(address);
+}
+
+bool send_string_async_with_delay_P(const char *string, uint8_t interval, send_string_async_callback_t callback) {
+    return send_string_async_with_reader(string, async_read_progmem, interval, callback);
+}
+
+bool send_string_async_P(const char *string) {
+    return send_string_async_with_delay_P(string, TAP_CODE_DELAY, NULL);
+}
+#    endif
+
+bool send_string_async_busy(void) {
+    return async_in_string || async_count > 0;
+}
+
+void send_string_async_cancel(void) {
+    for (uint16_t keycode = 0; keycode < 256; keycode++) {
+        if (async_held[keycode / 8] & (1 << (keycode % 8))) {
+            async_unregister(keycode);
+        }
+    }
+
+    // Callbacks may queue new strings, so detach everything first
+    send_string_async_callback_t callbacks[SEND_STRING_ASYNC_BUFFER_SIZE / (ASYNC_HEADER_SIZE + 1) + 1];
+    uint8_t                      callback_count = 0;
+    if (async_in_string) {
+        callbacks[callback_count++] = async_callback;
+        while (async_pop() != 0) {
+        }
+    }
+    while (async_count > 0) {
+        async_pop();
+        for (uint8_t i = 0; i < sizeof(send_string_async_callback_t); i++) {
+            ((uint8_t *)&callbacks[callback_count])[i] = async_pop();
+        }
+        callback_count++;
+        while (async_pop() != 0) {
+        }
+    }
+    async_in_string = false;
+    async_step      = ASYNC_STEP_NEXT;
+
+    for (uint8_t i = 0; i < callback_count; i++) {
+        if (callbacks[i]) {
+            callbacks[i](false);
+        }
+    }
+}
+
+/* Starts on the next character or control sequence of the current string.
+ * Returns false once the string has ended.
+ */
+static bool async_next(void) {
+    uint8_t ascii_code = async_pop();
+    if (ascii_code == 0) {
+        return false;
+    }
+
+    if (ascii_code == SS_QMK_PREFIX) {
+        ascii_code = async_peek() ? async_pop() : 0;
+
+        if (ascii_code == SS_TAP_CODE || ascii_code == SS_DOWN_CODE || ascii_code == SS_UP_CODE) {
+            uint8_t keycode = async_peek() ? async_pop() : KC_NO;
+            if (ascii_code == SS_TAP_CODE) {
+                tap_code(keycode);
+            } else if (ascii_code == SS_DOWN_CODE) {
+                async_register(keycode);
+            } else {
+                async_unregister(keycode);
+            }
+            async_wait(async_interval);
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint16_t ms = 0;
+            while (isdigit(async_peek())) {
+                ms *= 10;
+                ms += async_pop() - '0';
+            }
+            if (async_peek() != 0) {
+                async_pop();
+            }
+            async_wait(ms + async_interval);
+        }
+        return true;
+    }
+
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return true;
+    }
+#    endif
+
+    async_keycode = pgm_read_byte(&ascii_to_keycode_lut[ascii_code]);
+    async_shifted = PGM_LOADBIT(ascii_to_shift_lut, ascii_code);
+    async_altgred = PGM_LOADBIT(ascii_to_altgr_lut, ascii_code);
+    async_dead    = PGM_LOADBIT(ascii_to_dead_lut, ascii_code);
+    async_step    = ASYNC_STEP_SHIFT_DOWN;
+    return true;
+}
+
+/* Performs the next keystroke of the current character, mirroring send_char_with_delay() */
+static void async_char_step(void) {
+    uint8_t step = async_step++;
+    switch (step) {
+        case ASYNC_STEP_SHIFT_DOWN:
+            if (async_shifted) {
+                async_register(KC_LEFT_SHIFT);
+                async_wait(async_interval);
+            }
+            break;
+        case ASYNC_STEP_ALTGR_DOWN:
+            if (async_altgred) {
+                async_register(KC_RIGHT_ALT);
+                async_wait(async_interval);
+            }
+            break;
+        case ASYNC_STEP_KEY_DOWN:
+            async_register(async_keycode);
+            async_wait(async_interval);
+            break;
+        case ASYNC_STEP_KEY_UP:
+            async_unregister(async_keycode);
+            async_wait(async_interval);
+            break;
+        case ASYNC_STEP_ALTGR_UP:
+            if (async_altgred) {
+                async_unregister(KC_RIGHT_ALT);
+                async_wait(async_interval);
+            }
+            break;
+        case ASYNC_STEP_SHIFT_UP:
+            if (async_shifted) {
+                async_unregister(KC_LEFT_SHIFT);
+                async_wait(async_interval);
+            }
+            break;
+        case ASYNC_STEP_DEAD_DOWN:
+            if (async_dead) {
+                async_register(KC_SPACE);
+                async_wait(TAP_CODE_DELAY);
+            }
+            break;
+        case ASYNC_STEP_DEAD_UP:
+            if (async_dead) {
+                async_unregister(KC_SPACE);
+                async_wait(async_interval);
+            }
+            // fall through
+        default:
+            async_step = ASYNC_STEP_NEXT;
+            break;
+    }
+}
+
+void send_string_async_task(void) {
+    uint16_t now = timer_read();
+    if (now != async_ms) {
+        async_ms            = now;
+        async_chars_this_ms = 0;
+    }
+
+    while (send_string_async_busy() && timer_expired(timer_read(), async_next_step)) {
+        if (async_step != ASYNC_STEP_NEXT) {
+            async_char_step();
+            continue;
+        }
+
+        if (!async_in_string) {
+            async_interval = async_pop();
+            for (uint8_t i = 0; i < sizeof(send_string_async_callback_t); i++) {
+                ((uint8_t *)&async_callback)[i] = async_pop();
+            }
+            async_in_string = true;
+        }
+
+        if (async_chars_this_ms >= SEND_STRING_ASYNC_CHARS_PER_MS) {
+            break;
+        }
+        if (async_next()) {
+            async_chars_this_ms++;
+        } else {
+            async_in_string = false;
+            if (async_callback) {
+                async_callback(true);
+            }
+        }
+    }
+}
+#endif
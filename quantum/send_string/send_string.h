@@ -24,6 +24,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -161,4 +162,95 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(SEND_STRING_ASYNC_BUFFER_SIZE) || defined(__DOXYGEN__)
+/**
+ * \brief Called once a queued string has been typed out, or with `completed` false if it was cancelled.
+ */
+typedef void (*send_string_async_callback_t)(bool completed);
+
+/**
+ * \brief Reads one byte of a string from wherever it is stored, eg. `eeprom_read_byte`.
+ */
+typedef uint8_t (*send_string_async_read_t)(const uint8_t *address);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop.
+ *
+ * Unlike send_string(), this returns straight away. The string is copied into a buffer of
+ * `SEND_STRING_ASYNC_BUFFER_SIZE` bytes, and typed out by send_string_async_task() without
+ * blocking the rest of the keyboard.
+ *
+ * \param string The string to type out.
+ *
+ * \return false if there is not enough room left in the buffer, in which case nothing is queued.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop, with a delay between each keystroke.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait between keystrokes.
+ * \param callback Called when the string has been typed out or cancelled, may be `NULL`.
+ *
+ * \return false if there is not enough room left in the buffer, in which case nothing is queued.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval, send_string_async_callback_t callback);
+
+/**
+ * \brief Queue a string stored outside of RAM, eg. in PROGMEM or EEPROM.
+ *
+ * \param string The address of the string to type out.
+ * \param read Function used to read each byte of the string.
+ * \param interval The amount of time, in milliseconds, to wait between keystrokes.
+ * \param callback Called when the string has been typed out or cancelled, may be `NULL`.
+ *
+ * \return false if there is not enough room left in the buffer, in which case nothing is queued.
+ */
+bool send_string_async_with_reader(const void *string, send_string_async_read_t read, uint8_t interval, send_string_async_callback_t callback);
+
+/**
+ * \brief Whether there are queued strings still being typed out.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Stop typing, release any keys held by queued strings and drop everything that is queued.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Types out queued strings, called from keyboard_task().
+ *
+ * At most `SEND_STRING_ASYNC_CHARS_PER_MS` characters are typed each millisecond.
+ */
+void send_string_async_task(void);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out from the main loop.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async(string).
+ *
+ * \param string The string to type out.
+ */
+bool send_string_async_P(const char *string);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out from the main loop, with a delay between each keystroke.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval, callback).
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval, send_string_async_callback_t callback);
+#    else
+#        define send_string_async_P(string) send_string_async(string)
+#        define send_string_async_with_delay_P(string, interval, callback) send_string_async_with_delay(string, interval, callback)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_P(PSTR(string)).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_P(PSTR(string))
+#endif
+
 /** \} */
@@ -266,3 +266,18 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0
     return true;
 }
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+// Everything is dirty at boot so the first batch carries the full state
+static uint8_t split_sync_dirty = SPLIT_SYNC_ALL;
+
+void split_sync_mark_dirty(uint8_t fields) {
+    split_sync_dirty |= fields;
+}
+
+uint8_t split_sync_take_dirty(void) {
+    uint8_t fields   = split_sync_dirty;
+    split_sync_dirty = 0;
+    return fields;
+}
+#endif // SPLIT_TRANSACTION_BATCHING
@@ -15,4 +15,19 @@ bool is_transport_connected(void);
 
 void split_watchdog_update(bool done);
 void split_watchdog_task(void);
-bool split_watchdog_check(void);
\ No newline at end of file
+bool split_watchdog_check(void);
+#ifdef SPLIT_TRANSACTION_BATCHING
+// Fields carried by the batched PUT_BATCH transaction
+enum split_sync_field {
+    SPLIT_SYNC_SYNC_TIMER          = (1 << 0),
+    SPLIT_SYNC_LAYER_STATE         = (1 << 1),
+    SPLIT_SYNC_DEFAULT_LAYER_STATE = (1 << 2),
+    SPLIT_SYNC_LED_STATE           = (1 << 3),
+    SPLIT_SYNC_MODS                = (1 << 4),
+    SPLIT_SYNC_WPM                 = (1 << 5),
+    SPLIT_SYNC_ALL                 = (1 << 6) - 1,
+};
+
+void    split_sync_mark_dirty(uint8_t fields);
+uint8_t split_sync_take_dirty(void);
+#endif // SPLIT_TRANSACTION_BATCHING
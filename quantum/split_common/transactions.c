@@ -294,7 +294,7 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 ////////////////////////////////////////////////////
 // Sync timer
 
-#ifndef DISABLE_SYNC_TIMER
+#if !defined(DISABLE_SYNC_TIMER) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -322,18 +322,18 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_SYNC_TIMER_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(sync_timer)
 #    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS [PUT_SYNC_TIMER] = trans_initiator2target_initializer(sync_timer),
 
-#else // DISABLE_SYNC_TIMER
+#else // !defined(DISABLE_SYNC_TIMER) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 #    define TRANSACTIONS_SYNC_TIMER_MASTER()
 #    define TRANSACTIONS_SYNC_TIMER_SLAVE()
 #    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
 
-#endif // DISABLE_SYNC_TIMER
+#endif // !defined(DISABLE_SYNC_TIMER) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 ////////////////////////////////////////////////////
 // Layer state
 
-#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_layer_state_update         = 0;
@@ -359,18 +359,18 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
     [PUT_DEFAULT_LAYER_STATE] = trans_initiator2target_initializer(layers.default_layer_state),
 // clang-format on
 
-#else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 #    define TRANSACTIONS_LAYER_STATE_MASTER()
 #    define TRANSACTIONS_LAYER_STATE_SLAVE()
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS
 
-#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 ////////////////////////////////////////////////////
 // LED state
 
-#ifdef SPLIT_LED_STATE_ENABLE
+#if defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 static bool led_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -387,18 +387,18 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_LED_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(led_state)
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS [PUT_LED_STATE] = trans_initiator2target_initializer(led_state),
 
-#else // SPLIT_LED_STATE_ENABLE
+#else // defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 #    define TRANSACTIONS_LED_STATE_MASTER()
 #    define TRANSACTIONS_LED_STATE_SLAVE()
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS
 
-#endif // SPLIT_LED_STATE_ENABLE
+#endif // defined(SPLIT_LED_STATE_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 ////////////////////////////////////////////////////
 // Mods
 
-#ifdef SPLIT_MODS_ENABLE
+#if defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
@@ -454,13 +454,161 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #    define TRANSACTIONS_MODS_SLAVE() TRANSACTION_HANDLER_SLAVE(mods)
 #    define TRANSACTIONS_MODS_REGISTRATIONS [PUT_MODS] = trans_initiator2target_initializer(mods),
 
-#else // SPLIT_MODS_ENABLE
+#else // defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 #    define TRANSACTIONS_MODS_MASTER()
 #    define TRANSACTIONS_MODS_SLAVE()
 #    define TRANSACTIONS_MODS_REGISTRATIONS
 
-#endif // SPLIT_MODS_ENABLE
+#endif // defined(SPLIT_MODS_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
+
+////////////////////////////////////////////////////
+// Batched master state
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+#    ifndef DISABLE_SYNC_TIMER
+#        define SPLIT_BATCH_SYNC_TIMER_FIELDS SPLIT_SYNC_SYNC_TIMER
+#    else
+#        define SPLIT_BATCH_SYNC_TIMER_FIELDS 0
+#    endif
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#        define SPLIT_BATCH_LAYER_STATE_FIELDS (SPLIT_SYNC_LAYER_STATE | SPLIT_SYNC_DEFAULT_LAYER_STATE)
+#    else
+#        define SPLIT_BATCH_LAYER_STATE_FIELDS 0
+#    endif
+#    ifdef SPLIT_LED_STATE_ENABLE
+#        define SPLIT_BATCH_LED_STATE_FIELDS SPLIT_SYNC_LED_STATE
+#    else
+#        define SPLIT_BATCH_LED_STATE_FIELDS 0
+#    endif
+#    ifdef SPLIT_MODS_ENABLE
+#        define SPLIT_BATCH_MODS_FIELDS SPLIT_SYNC_MODS
+#    else
+#        define SPLIT_BATCH_MODS_FIELDS 0
+#    endif
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#        define SPLIT_BATCH_WPM_FIELDS SPLIT_SYNC_WPM
+#    else
+#        define SPLIT_BATCH_WPM_FIELDS 0
+#    endif
+
+#    define SPLIT_BATCH_FIELDS (SPLIT_BATCH_SYNC_TIMER_FIELDS | SPLIT_BATCH_LAYER_STATE_FIELDS | SPLIT_BATCH_LED_STATE_FIELDS | SPLIT_BATCH_MODS_FIELDS | SPLIT_BATCH_WPM_FIELDS)
+// WPM moves on nearly every scan while typing and the sync timer is only
+// corrected periodically, neither is worth a frame of its own
+#    define SPLIT_BATCH_LAZY_FIELDS (SPLIT_SYNC_SYNC_TIMER | SPLIT_SYNC_WPM)
+
+static inline uint8_t batch_checksum(const split_batch_sync_t *batch) {
+    return crc8((const uint8_t *)batch + sizeof(batch->checksum), sizeof(split_batch_sync_t) - sizeof(batch->checksum));
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    static uint8_t  pending     = 0;
+    static uint8_t  sequence    = 0;
+
+    // Setters flag what changed, so there is nothing to compare against the
+    // last frame here; every field is resent periodically to recover from loss
+    pending |= split_sync_take_dirty();
+    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+        pending |= SPLIT_SYNC_ALL;
+    }
+    pending &= SPLIT_BATCH_FIELDS;
+    // Lazy fields ride along with the next frame rather than forcing one
+    if (!(pending & ~SPLIT_BATCH_LAZY_FIELDS)) {
+        return true;
+    }
+
+    // Zero is what the slave starts out with, so it is never sent
+    if (++sequence == 0) {
+        sequence = 1;
+    }
+
+    split_batch_sync_t batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.sequence = sequence;
+#    ifdef SPLIT_LED_STATE_ENABLE
+    batch.led_state = host_keyboard_leds();
+#    endif
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    batch.current_wpm = get_current_wpm();
+#    endif
+#    ifdef SPLIT_MODS_ENABLE
+    batch.mods.real_mods = get_mods();
+    batch.mods.weak_mods = get_weak_mods();
+#        ifndef NO_ACTION_ONESHOT
+    batch.mods.oneshot_mods        = get_oneshot_mods();
+    batch.mods.oneshot_locked_mods = get_oneshot_locked_mods();
+#        endif
+#    endif
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    batch.layers.layer_state         = layer_state;
+    batch.layers.default_layer_state = default_layer_state;
+#    endif
+#    ifndef DISABLE_SYNC_TIMER
+    batch.sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+#    endif
+    batch.checksum = batch_checksum(&batch);
+
+    bool okay = transport_write(PUT_BATCH, &batch, sizeof(batch));
+    if (okay) {
+        pending     = 0;
+        last_update = timer_read32();
+    }
+    return okay;
+}
+
+static void batch_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t last_sequence = 0;
+
+    split_shared_memory_lock();
+    split_batch_sync_t batch;
+    memcpy(&batch, &split_shmem->batch, sizeof(split_batch_sync_t));
+    split_shared_memory_unlock();
+
+    if (batch.sequence == last_sequence || batch.checksum != batch_checksum(&batch)) {
+        return;
+    }
+    last_sequence = batch.sequence;
+
+    // Every frame carries the current value of every field, so applying all
+    // of them from the latest frame loses nothing even if several frames
+    // arrived since the last time the slave got here
+#    ifndef DISABLE_SYNC_TIMER
+    sync_timer_update(batch.sync_timer);
+#    endif
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    layer_state         = batch.layers.layer_state;
+    default_layer_state = batch.layers.default_layer_state;
+#    endif
+#    ifdef SPLIT_LED_STATE_ENABLE
+    void set_split_host_keyboard_leds(uint8_t led_state);
+    set_split_host_keyboard_leds(batch.led_state);
+#    endif
+#    ifdef SPLIT_MODS_ENABLE
+    set_mods(batch.mods.real_mods);
+    set_weak_mods(batch.mods.weak_mods);
+#        ifndef NO_ACTION_ONESHOT
+    set_oneshot_mods(batch.mods.oneshot_mods);
+    set_oneshot_locked_mods(batch.mods.oneshot_locked_mods);
+#        endif
+#    endif
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    set_current_wpm(batch.current_wpm);
+#    endif
+}
+
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_SLAVE() TRANSACTION_HANDLER_SLAVE(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS [PUT_BATCH] = trans_initiator2target_initializer(batch),
+
+#else // SPLIT_TRANSACTION_BATCHING
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_SLAVE()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCHING
 
 ////////////////////////////////////////////////////
 // Backlight
@@ -606,7 +754,7 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 ////////////////////////////////////////////////////
 // WPM
 
-#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 static bool wpm_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t last_update = 0;
@@ -622,13 +770,13 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
 
-#else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 #    define TRANSACTIONS_WPM_MASTER()
 #    define TRANSACTIONS_WPM_SLAVE()
 #    define TRANSACTIONS_WPM_REGISTRATIONS
 
-#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 ////////////////////////////////////////////////////
 // OLED
@@ -929,6 +1077,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_LAYER_STATE_REGISTRATIONS
     TRANSACTIONS_LED_STATE_REGISTRATIONS
     TRANSACTIONS_MODS_REGISTRATIONS
@@ -959,6 +1108,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
     TRANSACTIONS_MODS_MASTER();
@@ -982,6 +1132,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
     TRANSACTIONS_ENCODERS_SLAVE();
     TRANSACTIONS_SYNC_TIMER_SLAVE();
+    TRANSACTIONS_BATCH_SLAVE();
     TRANSACTIONS_LAYER_STATE_SLAVE();
     TRANSACTIONS_LED_STATE_SLAVE();
     TRANSACTIONS_MODS_SLAVE();
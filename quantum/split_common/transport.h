@@ -106,6 +106,30 @@ typedef struct _split_mods_sync_t {
 } split_mods_sync_t;
 #endif // SPLIT_MODS_ENABLE
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+// All master-driven state in one fixed-layout frame; the slave applies every
+// field once for each new `sequence`
+typedef struct _split_batch_sync_t {
+    uint8_t checksum;
+    uint8_t sequence;
+#    ifdef SPLIT_LED_STATE_ENABLE
+    uint8_t led_state;
+#    endif // SPLIT_LED_STATE_ENABLE
+#    if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+    uint8_t current_wpm;
+#    endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#    ifdef SPLIT_MODS_ENABLE
+    split_mods_sync_t mods;
+#    endif // SPLIT_MODS_ENABLE
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+    split_layers_sync_t layers;
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifndef DISABLE_SYNC_TIMER
+    uint32_t sync_timer;
+#    endif // DISABLE_SYNC_TIMER
+} split_batch_sync_t;
+#endif // SPLIT_TRANSACTION_BATCHING
+
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
 typedef struct _split_slave_pointing_sync_t {
@@ -162,21 +186,27 @@ typedef struct _split_shared_memory_t {
     split_slave_encoder_sync_t encoders;
 #endif // ENCODER_ENABLE
 
-#ifndef DISABLE_SYNC_TIMER
+#ifdef SPLIT_TRANSACTION_BATCHING
+    split_batch_sync_t batch;
+#else // SPLIT_TRANSACTION_BATCHING
+
+#    ifndef DISABLE_SYNC_TIMER
     uint32_t sync_timer;
-#endif // DISABLE_SYNC_TIMER
+#    endif // DISABLE_SYNC_TIMER
 
-#if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
     split_layers_sync_t layers;
-#endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
-#ifdef SPLIT_LED_STATE_ENABLE
+#    ifdef SPLIT_LED_STATE_ENABLE
     uint8_t led_state;
-#endif // SPLIT_LED_STATE_ENABLE
+#    endif // SPLIT_LED_STATE_ENABLE
 
-#ifdef SPLIT_MODS_ENABLE
+#    ifdef SPLIT_MODS_ENABLE
     split_mods_sync_t mods;
-#endif // SPLIT_MODS_ENABLE
+#    endif // SPLIT_MODS_ENABLE
+
+#endif // SPLIT_TRANSACTION_BATCHING
 
 #ifdef BACKLIGHT_ENABLE
     uint8_t backlight_level;
@@ -194,9 +224,9 @@ typedef struct _split_shared_memory_t {
     rgb_matrix_sync_t rgb_matrix_sync;
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
-#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
     uint8_t current_wpm;
-#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
+#endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE) && !defined(SPLIT_TRANSACTION_BATCHING)
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
     uint8_t current_oled_state;
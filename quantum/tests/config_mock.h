@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 12
+#define MATRIX_COLS 4
+#define DIODE_DIRECTION COL2ROW
+#define MATRIX_ROW_PINS \
+    { MOCK_ROW_PIN(0), MOCK_ROW_PIN(1), MOCK_ROW_PIN(2), MOCK_ROW_PIN(3), MOCK_ROW_PIN(4), MOCK_ROW_PIN(5), MOCK_ROW_PIN(6), MOCK_ROW_PIN(7), MOCK_ROW_PIN(8), MOCK_ROW_PIN(9), MOCK_ROW_PIN(10), MOCK_ROW_PIN(11) }
+#define MATRIX_COL_PINS \
+    { MOCK_COL_PIN(0), MOCK_COL_PIN(1), MOCK_COL_PIN(2), MOCK_COL_PIN(3) }
+#define DEBOUNCE 5
+#define MATRIX_TRACK_CHANGED_ROWS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
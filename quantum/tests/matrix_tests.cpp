@@ -0,0 +1,62 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "matrix.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class MatrixChangedRows : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                mock_set_switch(row, col, false);
+            }
+        }
+        matrix_init();
+    }
+
+    /* Scans once a millisecond until debouncing lets a change through, and returns the rows it reported */
+    std::vector<uint8_t> scan_until_changed(void) {
+        for (int i = 0; i < 2 * DEBOUNCE; i++) {
+            advance_time(1);
+            if (matrix_scan()) {
+                const uint8_t *changed_rows = matrix_get_changed_rows();
+                return std::vector<uint8_t>(changed_rows, changed_rows + MATRIX_CHANGED_ROWS_SIZE);
+            }
+        }
+        ADD_FAILURE() << "matrix did not change";
+        return {};
+    }
+};
+
+TEST_F(MatrixChangedRows, OnlyDebouncedChangesAreReported) {
+    mock_set_switch(9, 2, true);
+    EXPECT_EQ(scan_until_changed(), (std::vector<uint8_t>{0x00, 0x02}));
+    EXPECT_EQ(matrix_get_row(9), 1 << 2);
+
+    /* A scan without a change clears the bitmap */
+    advance_time(1);
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(matrix_get_changed_rows()[0], 0);
+    EXPECT_EQ(matrix_get_changed_rows()[1], 0);
+
+    mock_set_switch(1, 0, true);
+    mock_set_switch(10, 3, true);
+    EXPECT_EQ(scan_until_changed(), (std::vector<uint8_t>{0x02, 0x04}));
+
+    /* Other keys held on a row don't matter, only whether the row changed */
+    mock_set_switch(9, 2, false);
+    EXPECT_EQ(scan_until_changed(), (std::vector<uint8_t>{0x00, 0x02}));
+    EXPECT_EQ(matrix_get_row(9), 0);
+    EXPECT_EQ(matrix_get_row(10), 1 << 3);
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock.h"
+
+static bool switches[MATRIX_ROWS][MATRIX_COLS] = {0};
+static int  selected_row                      = -1;
+
+void mock_set_pin_input_high(pin_t pin) {
+    if (pin == selected_row) {
+        selected_row = -1;
+    }
+}
+
+void mock_write_pin_low(pin_t pin) {
+    if (pin < MATRIX_ROWS) {
+        selected_row = pin;
+    }
+}
+
+bool mock_read_pin(pin_t pin) {
+    // Columns are pulled high, and pulled low through a pressed switch on the selected row
+    if (selected_row < 0 || pin < MOCK_COL_PIN(0) || pin >= MOCK_COL_PIN(MATRIX_COLS)) {
+        return true;
+    }
+    return !switches[selected_row][pin - MOCK_COL_PIN(0)];
+}
+
+void mock_set_switch(uint8_t row, uint8_t col, bool pressed) {
+    switches[row][col] = pressed;
+}
@@ -0,0 +1,25 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+#define MOCK_ROW_PIN(row) (row)
+#define MOCK_COL_PIN(col) (16 + (col))
+
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_set_pin_output(pin)
+#define gpio_write_pin_high(pin) mock_set_pin_input_high(pin)
+#define gpio_write_pin_low(pin) mock_write_pin_low(pin)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+void mock_set_pin_input_high(pin_t pin);
+void mock_write_pin_low(pin_t pin);
+bool mock_read_pin(pin_t pin);
+
+/* Switch state of the simulated key matrix, which the row and column pins are wired to */
+void mock_set_switch(uint8_t row, uint8_t col, bool pressed);
@@ -0,0 +1,11 @@
+matrix_changed_rows_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_changed_rows_CONFIG := $(QUANTUM_PATH)/tests/config_mock.h
+
+matrix_changed_rows_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/tests/mock.c \
+	$(QUANTUM_PATH)/tests/matrix_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/bitwise.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_g.c
@@ -0,0 +1 @@
+TEST_LIST += matrix_changed_rows
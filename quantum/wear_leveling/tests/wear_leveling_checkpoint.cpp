@@ -0,0 +1,162 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+#define LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8)
+#define CHECKPOINT_ADDRESS(index) (LOG_START + (index) * (WEAR_LEVELING_CHECKPOINT_INTERVAL))
+
+class WearLevelingCheckpoint : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        wear_leveling_init();
+    }
+
+    static wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    // Single byte writes produce the most log entries for the space they use
+    static wear_leveling_status_t churn_write(uint32_t index) {
+        uint8_t value = (uint8_t)(index % 251) + 1;
+        return test_write((index * 7) % (WEAR_LEVELING_LOGICAL_SIZE), &value, sizeof(value));
+    }
+
+    static void verify_after_init() {
+        wear_leveling_init();
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        wear_leveling_read(0, actual.data(), actual.size());
+        EXPECT_EQ(actual, verify_data) << "Data mismatch after init";
+    }
+
+    // Number of backing store words initialization would read if it replayed the entire write log
+    static uint32_t full_replay_reads() {
+        auto&    inst  = MockBackingStore::Instance();
+        uint32_t reads = LOG_START / BACKING_STORE_WRITE_SIZE;
+        for (auto it = inst.storage_begin() + LOG_START / BACKING_STORE_WRITE_SIZE; it != inst.storage_end(); ++it) {
+            reads++;
+            if (it->is_erased()) {
+                break;
+            }
+        }
+        return reads;
+    }
+
+    static inline std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+};
+
+/**
+ * This test verifies that data survives re-initialization as the write log grows through several checkpoints and consolidations.
+ */
+TEST_F(WearLevelingCheckpoint, DataSurvivesReinit) {
+    auto&    inst   = MockBackingStore::Instance();
+    uint32_t writes = 0;
+    while (inst.erasure_count() < 3) {
+        for (int i = 0; i < 37; i++) {
+            EXPECT_NE(churn_write(writes++), WEAR_LEVELING_FAILED);
+        }
+        verify_after_init();
+    }
+}
+
+/**
+ * This test verifies that checkpoints are written at their fixed locations.
+ */
+TEST_F(WearLevelingCheckpoint, CheckpointWrittenAtInterval) {
+    auto&    inst   = MockBackingStore::Instance();
+    uint32_t writes = 0;
+    while (inst.storage_begin()[(CHECKPOINT_ADDRESS(2) + (WEAR_LEVELING_CHECKPOINT_SIZE)-8) / BACKING_STORE_WRITE_SIZE].is_erased()) {
+        churn_write(writes++);
+        ASSERT_EQ(inst.erasure_count(), 0) << "Consolidated before the second checkpoint";
+    }
+
+    for (uint32_t index = 1; index <= 2; index++) {
+        backing_store_int_t header;
+        backing_store_read(CHECKPOINT_ADDRESS(index), &header);
+        write_log_entry_t log = {.raw64 = 0};
+        memcpy(&log, &header, sizeof(header));
+        EXPECT_EQ(LOG_ENTRY_GET_TYPE(log), LOG_ENTRY_TYPE_EXTENDED);
+        EXPECT_EQ(LOG_ENTRY_EXTENDED_GET_SUBTYPE(log), LOG_ENTRY_EXTENDED_CHECKPOINT);
+    }
+}
+
+/**
+ * This test verifies that initialization starts from the latest checkpoint and only plays back the entries after it.
+ */
+TEST_F(WearLevelingCheckpoint, InitUsesLatestCheckpoint) {
+    auto&    inst   = MockBackingStore::Instance();
+    uint32_t writes = 0;
+    while (inst.storage_begin()[(CHECKPOINT_ADDRESS(2) + (WEAR_LEVELING_CHECKPOINT_SIZE)-8) / BACKING_STORE_WRITE_SIZE].is_erased()) {
+        churn_write(writes++);
+    }
+    for (int i = 0; i < 10; i++) {
+        churn_write(writes++);
+    }
+
+    verify_after_init();
+    auto stats = wear_leveling_get_init_stats();
+    EXPECT_EQ(stats->checkpoint, CHECKPOINT_ADDRESS(2));
+    EXPECT_LE(stats->log_entries, 10 * 4);
+    EXPECT_LT(stats->backing_reads, full_replay_reads());
+}
+
+/**
+ * This test verifies that a checkpoint interrupted by power loss is ignored in favour of the one before it.
+ */
+TEST_F(WearLevelingCheckpoint, TornCheckpointFallsBack) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Lose power partway through writing the hash of the second checkpoint
+    const uint32_t torn_address = CHECKPOINT_ADDRESS(2) + (WEAR_LEVELING_CHECKPOINT_SIZE)-8;
+    inst.set_write_callback([torn_address](std::uint64_t, std::uint32_t address) { return address < torn_address; });
+
+    uint32_t                                             writes = 0;
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> committed;
+    while (true) {
+        committed = verify_data;
+        if (churn_write(writes++) == WEAR_LEVELING_FAILED) {
+            break;
+        }
+    }
+    EXPECT_FALSE(inst.storage_begin()[CHECKPOINT_ADDRESS(2) / BACKING_STORE_WRITE_SIZE].is_erased()) << "Checkpoint header was not written";
+
+    // The interrupted write never completed, so only the earlier ones are expected
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    verify_data = committed;
+    verify_after_init();
+    EXPECT_EQ(wear_leveling_get_init_stats()->checkpoint, CHECKPOINT_ADDRESS(1));
+    EXPECT_EQ(inst.erasure_count(), 1) << "Torn checkpoint did not force a consolidation";
+
+    // Everything carries on as normal afterwards
+    for (int i = 0; i < 100; i++) {
+        churn_write(writes++);
+    }
+    verify_after_init();
+}
+
+/**
+ * This test checks initialization with the write log filled to just before consolidation.
+ */
+TEST_F(WearLevelingCheckpoint, WorstCaseInitSkipsReplay) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Find out how many writes fit before consolidation
+    uint32_t writes = 0;
+    while (inst.erasure_count() == 0) {
+        churn_write(writes++);
+    }
+    SetUp();
+    for (uint32_t i = 0; i + 1 < writes; i++) {
+        churn_write(i);
+    }
+    ASSERT_EQ(inst.erasure_count(), 0);
+
+    wear_leveling_init();
+    auto stats = wear_leveling_get_init_stats();
+    EXPECT_LT(stats->backing_reads, full_replay_reads());
+    verify_after_init();
+}
@@ -153,7 +153,35 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Checkpoints:
+
+        If WEAR_LEVELING_CHECKPOINT_INTERVAL is defined, a copy of the logical
+        data is written into the write log every that many bytes, so that
+        initialization only needs to play back the entries after the latest
+        checkpoint instead of the whole log.
+
+        Checkpoints start at fixed offsets from the start of the write log,
+        which lets initialization find the latest one by probing those offsets
+        from the end rather than walking the log. When a log entry would cross
+        the next offset, the remainder of the log up to it is filled with
+        padding entries and the checkpoint is written first. Checkpoints which
+        would not fit before the end of the backing store are skipped, as
+        consolidation is imminent anyway.
+
+        ╔ Extended ══════╗
+        ║11XXXXXX........║
+        ║  └─┬──┘        ║
+        ║ Subtype        ║
+        ╚════════════════╝
+        Subtype 1: padding, a single backing store write.
+        Subtype 2: checkpoint, followed by the logical data and its FNV1a_64.
+
+        The FNV1a_64 is written last, so a checkpoint interrupted by power loss
+        fails verification and the previous checkpoint (or the consolidated
+        data) is used instead. Playback stops at such a checkpoint and forces
+        a consolidation. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -161,9 +189,30 @@
 static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
-    bool                                                           unlocked;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    uint32_t next_checkpoint;
+#endif
+    bool unlocked;
 } wear_leveling;
 
+/**
+ * Work done during initialization.
+ */
+static wear_leveling_init_stats_t init_stats;
+
+/**
+ * Counting wrappers for backing store reads, which only happen during initialization.
+ */
+static inline bool wear_leveling_backing_read(uint32_t address, backing_store_int_t *value) {
+    init_stats.backing_reads++;
+    return backing_store_read(address, value);
+}
+
+static inline bool wear_leveling_backing_read_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    init_stats.backing_reads += item_count;
+    return backing_store_read_bulk(address, values, item_count);
+}
+
 /**
  * Locking helper: status
  */
@@ -203,6 +252,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wear_leveling.next_checkpoint = wear_leveling.write_address + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+#endif
 }
 
 /**
@@ -213,7 +265,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     wl_dprintf("Reading consolidated data\n");
 
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!wear_leveling_backing_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -224,11 +276,11 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
 #if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+        wear_leveling_backing_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
 #elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+        wear_leveling_backing_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
 #elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
+        wear_leveling_backing_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
 #endif
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
@@ -317,6 +369,9 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wear_leveling.next_checkpoint = wear_leveling.write_address + (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+#endif
 
     return status;
 }
@@ -336,6 +391,150 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
     return WEAR_LEVELING_SUCCESS;
 }
 
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+/**
+ * Retrieves the first backing store write of a log entry.
+ */
+static inline backing_store_int_t wear_leveling_entry_head(write_log_entry_t log) {
+#    if BACKING_STORE_WRITE_SIZE == 2
+    return log.raw16[0];
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    return log.raw32[0];
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    return log.raw64;
+#    endif
+}
+
+/**
+ * Determines the first checkpoint location at or after the supplied write log address.
+ */
+static uint32_t wear_leveling_checkpoint_at_or_after(uint32_t address) {
+    const uint32_t log_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    uint32_t       index     = (address - log_start + (WEAR_LEVELING_CHECKPOINT_INTERVAL)-1) / (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+    if (index == 0) {
+        // The consolidated data serves as the checkpoint at the start of the log
+        index = 1;
+    }
+    return log_start + index * (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+}
+
+/**
+ * Pads the write log up to the next checkpoint location, then writes a copy of the cache there.
+ */
+static wear_leveling_status_t wear_leveling_write_checkpoint(void) {
+    wl_dprintf("Writing checkpoint at 0x%04X\n", (int)wear_leveling.next_checkpoint);
+
+    const backing_store_int_t padding = wear_leveling_entry_head(LOG_ENTRY_MAKE_EXTENDED(LOG_ENTRY_EXTENDED_PADDING));
+    while (wear_leveling.write_address < wear_leveling.next_checkpoint) {
+        if (!backing_store_write(wear_leveling.write_address, padding)) {
+            return WEAR_LEVELING_FAILED;
+        }
+        wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+    }
+
+    uint32_t address = wear_leveling.next_checkpoint;
+    if (!backing_store_write(address, wear_leveling_entry_head(LOG_ENTRY_MAKE_EXTENDED(LOG_ENTRY_EXTENDED_CHECKPOINT)))) {
+        return WEAR_LEVELING_FAILED;
+    }
+    address += (BACKING_STORE_WRITE_SIZE);
+
+    if (!backing_store_write_bulk(address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+        return WEAR_LEVELING_FAILED;
+    }
+    address += (WEAR_LEVELING_LOGICAL_SIZE);
+
+    // The checksum goes last, marking the checkpoint as complete
+    write_log_entry_t entry;
+    entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+#    if BACKING_STORE_WRITE_SIZE == 2
+    bool ok = backing_store_write_bulk(address, entry.raw16, 4);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    bool ok = backing_store_write_bulk(address, entry.raw32, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    bool ok = backing_store_write(address, entry.raw64);
+#    endif
+    if (!ok) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling.write_address = wear_leveling.next_checkpoint + (WEAR_LEVELING_CHECKPOINT_SIZE);
+    wear_leveling.next_checkpoint += (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Loads the latest valid checkpoint into the cache.
+ *
+ * @return the write log address to start playback from, or 0 if there is no valid checkpoint
+ */
+static uint32_t wear_leveling_read_checkpoint(void) {
+    const uint32_t log_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    if ((WEAR_LEVELING_BACKING_SIZE) < log_start + (WEAR_LEVELING_CHECKPOINT_INTERVAL) + (WEAR_LEVELING_CHECKPOINT_SIZE)) {
+        return 0;
+    }
+
+    for (uint32_t index = ((WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_CHECKPOINT_SIZE)-log_start) / (WEAR_LEVELING_CHECKPOINT_INTERVAL); index > 0; --index) {
+        const uint32_t    address = log_start + index * (WEAR_LEVELING_CHECKPOINT_INTERVAL);
+        write_log_entry_t log     = {.raw64 = 0};
+#    if BACKING_STORE_WRITE_SIZE == 2
+        bool ok = wear_leveling_backing_read(address, &log.raw16[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+        bool ok = wear_leveling_backing_read(address, &log.raw32[0]);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+        bool ok = wear_leveling_backing_read(address, &log.raw64);
+#    endif
+        if (!ok) {
+            return 0;
+        }
+        if (LOG_ENTRY_GET_TYPE(log) != LOG_ENTRY_TYPE_EXTENDED || LOG_ENTRY_EXTENDED_GET_SUBTYPE(log) != LOG_ENTRY_EXTENDED_CHECKPOINT) {
+            continue;
+        }
+
+        write_log_entry_t entry;
+        ok = wear_leveling_backing_read_bulk(address + (BACKING_STORE_WRITE_SIZE), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t));
+#    if BACKING_STORE_WRITE_SIZE == 2
+        ok = ok && wear_leveling_backing_read_bulk(address + (BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+        ok = ok && wear_leveling_backing_read_bulk(address + (BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+        ok = ok && wear_leveling_backing_read(address + (BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE), &entry.raw64);
+#    endif
+        if (!ok) {
+            return 0;
+        }
+        if (entry.raw64 == fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT)) {
+            wl_dprintf("Loaded checkpoint at 0x%04X\n", (int)address);
+            init_stats.checkpoint = address;
+            return address + (WEAR_LEVELING_CHECKPOINT_SIZE);
+        }
+
+        // Interrupted while being written, try the one before
+        wl_dprintf("Checkpoint at 0x%04X is incomplete\n", (int)address);
+    }
+
+    return 0;
+}
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
+/**
+ * Makes room for a write log entry of the supplied size, writing a checkpoint first if the entry would cross the next
+ * checkpoint location.
+ */
+static wear_leveling_status_t wear_leveling_reserve(size_t length) {
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    if (wear_leveling.write_address + length > wear_leveling.next_checkpoint) {
+        if (wear_leveling.next_checkpoint + (WEAR_LEVELING_CHECKPOINT_SIZE) + length <= (WEAR_LEVELING_BACKING_SIZE)) {
+            return wear_leveling_write_checkpoint();
+        }
+        // No room left for a checkpoint, consolidation will happen first
+        wear_leveling.next_checkpoint = UINT32_MAX;
+    }
+#else
+    (void)length;
+#endif
+    return WEAR_LEVELING_SUCCESS;
+}
+
 /**
  * Appends the supplied fixed-width entry to the write log, optionally consolidating if the log is full.
  *
@@ -366,6 +565,11 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
     wear_leveling_status_t status;
 #if BACKING_STORE_WRITE_SIZE == 2
+    status = wear_leveling_reserve((2 + (length > 1) + (length > 3)) * (BACKING_STORE_WRITE_SIZE));
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
     status = wear_leveling_append_raw(log.raw16[0]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
@@ -390,6 +594,11 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
         }
     }
 #elif BACKING_STORE_WRITE_SIZE == 4
+    status = wear_leveling_reserve((1 + (length > 1)) * (BACKING_STORE_WRITE_SIZE));
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
     status = wear_leveling_append_raw(log.raw32[0]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
@@ -402,6 +611,11 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
         }
     }
 #elif BACKING_STORE_WRITE_SIZE == 8
+    status = wear_leveling_reserve(BACKING_STORE_WRITE_SIZE);
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
     status = wear_leveling_append_raw(log.raw64);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
@@ -424,7 +638,10 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
             const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
             if (v == 0 || v == 1) {
                 const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
+                status                      = wear_leveling_reserve(BACKING_STORE_WRITE_SIZE);
+                if (status == WEAR_LEVELING_SUCCESS) {
+                    status = wear_leveling_append_raw(log.raw16[0]);
+                }
                 if (status != WEAR_LEVELING_SUCCESS) {
                     // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                     // If a failure occurred, pass it on.
@@ -441,7 +658,10 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         // Small-write optimizations - address<64:
         if (address < 64) {
             const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
+            status                      = wear_leveling_reserve(BACKING_STORE_WRITE_SIZE);
+            if (status == WEAR_LEVELING_SUCCESS) {
+                status = wear_leveling_append_raw(log.raw16[0]);
+            }
             if (status != WEAR_LEVELING_SUCCESS) {
                 // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                 // If a failure occurred, pass it on.
@@ -472,15 +692,14 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
-static wear_leveling_status_t wear_leveling_playback_log(void) {
+static wear_leveling_status_t wear_leveling_playback_log(uint32_t address) {
     wl_dprintf("Playback write log\n");
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_backing_read(address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -495,6 +714,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
         // If we got a nonzero value, then we need to increment the address to ensure next write occurs at next location
         address += (BACKING_STORE_WRITE_SIZE);
+        init_stats.log_entries++;
 
         // Read from the write log
         write_log_entry_t log;
@@ -509,7 +729,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_backing_read(address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -529,7 +749,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_backing_read(address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -539,7 +759,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_backing_read(address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -550,7 +770,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_backing_read(address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -590,6 +810,18 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+            case LOG_ENTRY_TYPE_EXTENDED: {
+                if (LOG_ENTRY_EXTENDED_GET_SUBTYPE(log) == LOG_ENTRY_EXTENDED_PADDING) {
+                    break;
+                }
+
+                // Any checkpoint reached here failed verification, so the log after it can't be trusted
+                wl_dprintf("Found incomplete checkpoint, skipping remainder of write log\n");
+                cancel_playback = true;
+                status          = WEAR_LEVELING_FAILED;
+            } break;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -599,6 +831,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     // We've reached the end of the log, so we're at the new write location
     wear_leveling.write_address = address;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    wear_leveling.next_checkpoint = wear_leveling_checkpoint_at_or_after(address);
+#endif
 
     if (status == WEAR_LEVELING_FAILED) {
         // If we had a failure during readback, assume we're corrupted -- force a consolidation with the data we already have
@@ -627,15 +862,26 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
-    // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
-    wear_leveling_status_t status = wear_leveling_read_consolidated();
-    if (status == WEAR_LEVELING_FAILED) {
-        // If it failed, clear the cache and return with failure
-        wear_leveling_clear_cache();
-        return status;
+    memset(&init_stats, 0, sizeof(init_stats));
+
+    // Start from the latest checkpoint if there is one, otherwise from the consolidated values
+    wear_leveling_status_t status         = WEAR_LEVELING_SUCCESS;
+    uint32_t               playback_start = 0;
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+    playback_start = wear_leveling_read_checkpoint();
+#endif
+    if (playback_start == 0) {
+        // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
+        status = wear_leveling_read_consolidated();
+        if (status == WEAR_LEVELING_FAILED) {
+            // If it failed, clear the cache and return with failure
+            wear_leveling_clear_cache();
+            return status;
+        }
+        playback_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
     }
 
-    status = wear_leveling_playback_log();
+    status = wear_leveling_playback_log(playback_start);
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
@@ -645,6 +891,13 @@ wear_leveling_status_t wear_leveling_init(void) {
     return status;
 }
 
+/**
+ * Retrieves the work done by the last wear-leveling initialization.
+ */
+const wear_leveling_init_stats_t *wear_leveling_get_init_stats(void) {
+    return &init_stats;
+}
+
 /**
  * Wear-leveling erase.
  * Post-condition: any reads from the backing store directly after an erase operation must come back as zero.
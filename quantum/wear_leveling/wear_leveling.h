@@ -13,6 +13,15 @@ typedef enum wear_leveling_status_t {
     WEAR_LEVELING_CONSOLIDATED //< Invocation succeeded, consolidation occurred
 } wear_leveling_status_t;
 
+/**
+ * @typedef Work done by the last call to wear_leveling_init(), used to measure boot time cost.
+ */
+typedef struct wear_leveling_init_stats_t {
+    uint32_t backing_reads; //< Number of backing store words read
+    uint32_t log_entries;   //< Number of write log entries played back
+    uint32_t checkpoint;    //< Backing store address of the checkpoint playback started from, 0 if none
+} wear_leveling_init_stats_t;
+
 /**
  * Wear-leveling initialization
  *
@@ -52,3 +61,10 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Retrieves the work done by the last wear-leveling initialization.
+ *
+ * @return Pointer to the statistics
+ */
+const wear_leveling_init_stats_t* wear_leveling_get_init_stats(void);
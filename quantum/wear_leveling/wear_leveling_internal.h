@@ -66,6 +66,13 @@ _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_CHECKPOINT_INTERVAL
+// A checkpoint is a header entry, a copy of the logical data, then the FNV1a_64 of that copy
+#    define WEAR_LEVELING_CHECKPOINT_SIZE ((BACKING_STORE_WRITE_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE) + 8)
+_Static_assert(WEAR_LEVELING_CHECKPOINT_INTERVAL % BACKING_STORE_WRITE_SIZE == 0, "Checkpoint interval must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_CHECKPOINT_INTERVAL >= WEAR_LEVELING_CHECKPOINT_SIZE + 8, "Checkpoint interval must leave room for log entries between checkpoints");
+#endif
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
@@ -101,6 +108,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Records which aren't logical data writes, such as checkpoints
+    LOG_ENTRY_TYPE_EXTENDED,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +159,24 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+/**
+ * Extended log entry subtypes, stored in the low 6 bits of the first byte.
+ */
+enum {
+    // Fills the log up to the next checkpoint location
+    LOG_ENTRY_EXTENDED_PADDING = 1,
+
+    // Followed by a copy of the logical data and its FNV1a_64
+    LOG_ENTRY_EXTENDED_CHECKPOINT,
+};
+
+#define LOG_ENTRY_EXTENDED_GET_SUBTYPE(entry) ((entry).raw8[0] & BITMASK_FOR_BITCOUNT(6))
+#define LOG_ENTRY_MAKE_EXTENDED(subtype)                                                              \
+    (write_log_entry_t) {                                                                             \
+        .raw8 = {                                                                                     \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_EXTENDED) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */   \
+                   | (((uint8_t)(subtype)) & BITMASK_FOR_BITCOUNT(6))                    /* subtype */ \
+                   ),                                                                                 \
+        }                                                                                             \
+    }
@@ -22,6 +22,10 @@
 #include "action_util.h"
 #include <math.h>
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+#    include "split_util.h"
+#endif
+
 // WPM Stuff
 static uint8_t  current_wpm = 0;
 static uint32_t wpm_timer   = 0;
@@ -60,6 +64,9 @@ static uint8_t  next_wpm        = 0;
 
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+    split_sync_mark_dirty(SPLIT_SYNC_WPM);
+#endif
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
@@ -122,6 +129,9 @@ void update_wpm(uint16_t keycode) {
 }
 
 void decay_wpm(void) {
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+    uint8_t last_wpm = current_wpm;
+#endif
     int32_t presses = period_presses[0];
     for (int i = 1; i <= periods; i++) {
         presses += period_presses[i];
@@ -175,4 +185,10 @@ void decay_wpm(void) {
 
     current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
 #endif
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_BATCHING)
+    if (current_wpm != last_wpm) {
+        split_sync_mark_dirty(SPLIT_SYNC_WPM);
+    }
+#endif
 }
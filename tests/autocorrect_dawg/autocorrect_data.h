@@ -0,0 +1,176 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (77 entries):
+//   :guage      -> gauge
+//   :the:the:   -> the
+//   :thier      -> their
+//   :ture       -> true
+//   accomodate  -> accommodate
+//   acommodate  -> accommodate
+//   aparent     -> apparent
+//   aparrent    -> apparent
+//   apparant    -> apparent
+//   apparrent   -> apparent
+//   aquire      -> acquire
+//   becuase     -> because
+//   cauhgt      -> caught
+//   cheif       -> chief
+//   choosen     -> chosen
+//   cieling     -> ceiling
+//   collegue    -> colleague
+//   concensus   -> consensus
+//   contians    -> contains
+//   cosnt       -> const
+//   dervied     -> derived
+//   fales       -> false
+//   fasle       -> false
+//   fitler      -> filter
+//   flase       -> false
+//   foward      -> forward
+//   frequecy    -> frequency
+//   gaurantee   -> guarantee
+//   guaratee    -> guarantee
+//   heigth      -> height
+//   heirarchy   -> hierarchy
+//   inclued     -> include
+//   interator   -> iterator
+//   intput      -> input
+//   invliad     -> invalid
+//   lenght      -> length
+//   liasion     -> liaison
+//   libary      -> library
+//   listner     -> listener
+//   looses:     -> loses
+//   looup       -> lookup
+//   manefist    -> manifest
+//   namesapce   -> namespace
+//   namespcae   -> namespace
+//   occassion   -> occasion
+//   occured     -> occurred
+//   ouptut      -> output
+//   ouput       -> output
+//   overide     -> override
+//   postion     -> position
+//   priviledge  -> privilege
+//   psuedo      -> pseudo
+//   recieve     -> receive
+//   refered     -> referred
+//   relevent    -> relevant
+//   repitition  -> repetition
+//   retrun      -> return
+//   retun       -> return
+//   reuslt      -> result
+//   reutrn      -> return
+//   saftey      -> safety
+//   seperate    -> separate
+//   singed      -> signed
+//   stirng      -> string
+//   strign      -> string
+//   swithc      -> switch
+//   swtich      -> switch
+//   thresold    -> threshold
+//   udpate      -> update
+//   widht       -> width
+//   acheived    -> achieved
+//   acheives    -> achieves
+//   acheiving   -> achieving
+//   acheivement -> achievement
+//   would'nt    -> wouldn't
+//   :throug:    -> through
+//   thsi:       -> this
+
+#define AUTOCORRECT_DAWG
+#define AUTOCORRECT_DAWG_LINK_BYTES 2
+#define AUTOCORRECT_DAWG_MAX_CHANGES 9
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 11 // "acheivement"
+#define DICTIONARY_SIZE 964
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x69, 0xFC, 0xE0, 0x0E, 0x20, 0x00, 0x2A, 0x00, 0x99, 0x00, 0x7F, 0x01, 0x88, 0x01, 0xA7, 0x01,
+    0xC0, 0x01, 0x2E, 0x02, 0x38, 0x02, 0x40, 0x02, 0x73, 0x02, 0xA1, 0x02, 0x60, 0x03, 0x94, 0x03,
+    0x07, 0x13, 0x08, 0x16, 0x12, 0x82, 0x04, 0x63, 0x68, 0x00, 0x44, 0x00, 0x04, 0x0B, 0x11, 0x37,
+    0x00, 0x42, 0x00, 0x87, 0x00, 0x91, 0x00, 0x08, 0x0B, 0x15, 0x0D, 0x08, 0x83, 0x03, 0x61, 0x6C,
+    0x69, 0x00, 0x60, 0x40, 0x01, 0x32, 0x50, 0x00, 0x58, 0x00, 0x61, 0x00, 0x74, 0x00, 0x7D, 0x00,
+    0x0D, 0x08, 0x12, 0x82, 0x02, 0x67, 0x6E, 0x00, 0x15, 0x11, 0x04, 0x03, 0x82, 0x03, 0x69, 0x76,
+    0x00, 0x42, 0x04, 0x14, 0x68, 0x00, 0x6F, 0x00, 0x05, 0x04, 0x11, 0x80, 0x05, 0x72, 0x00, 0x02,
+    0x02, 0x2E, 0x6B, 0x00, 0x0B, 0x02, 0x0D, 0x08, 0x82, 0x05, 0x64, 0x65, 0x00, 0x08, 0x04, 0x07,
+    0x02, 0x00, 0x82, 0x03, 0x69, 0x65, 0x00, 0x0E, 0x12, 0x04, 0x11, 0x07, 0x13, 0x80, 0x05, 0x68,
+    0x00, 0x00, 0x16, 0x0E, 0x05, 0x80, 0x02, 0x72, 0x00, 0x60, 0x5D, 0x08, 0x3E, 0xB3, 0x00, 0xBF,
+    0x00, 0xCB, 0x00, 0xD4, 0x00, 0xEE, 0x00, 0x07, 0x01, 0x0F, 0x01, 0x24, 0x01, 0x3A, 0x01, 0x6B,
+    0x01, 0x75, 0x01, 0x02, 0x0F, 0x12, 0x04, 0x0C, 0x00, 0x0D, 0x82, 0x06, 0x61, 0x63, 0x00, 0x0F,
+    0x00, 0x12, 0x04, 0x0C, 0x00, 0x0D, 0x82, 0x05, 0x70, 0x61, 0x00, 0x08, 0x11, 0x04, 0x15, 0x0E,
+    0x80, 0x04, 0x72, 0x00, 0x13, 0x42, 0x00, 0x0D, 0xDC, 0x00, 0xE4, 0x00, 0x11, 0x00, 0x14, 0x06,
+    0x80, 0x05, 0x6E, 0x00, 0x00, 0x11, 0x14, 0x00, 0x06, 0x82, 0x01, 0x75, 0x61, 0x00, 0x42, 0x00,
+    0x03, 0xF5, 0x00, 0xFD, 0x00, 0x14, 0x06, 0x1B, 0x82, 0x01, 0x61, 0x75, 0x00, 0x04, 0x0B, 0x08,
+    0x15, 0x08, 0x11, 0x0F, 0x81, 0x07, 0x00, 0x12, 0x00, 0x05, 0x82, 0x02, 0x6C, 0x73, 0x00, 0x42,
+    0x08, 0x14, 0x16, 0x01, 0x1D, 0x01, 0x14, 0x10, 0x00, 0x80, 0x01, 0x63, 0x00, 0x13, 0x1B, 0x82,
+    0x01, 0x72, 0x75, 0x00, 0x00, 0x42, 0x0B, 0x14, 0x2C, 0x01, 0x32, 0x01, 0x05, 0x82, 0x01, 0x61,
+    0x6C, 0x00, 0x02, 0x04, 0x01, 0x82, 0x03, 0x61, 0x75, 0x00, 0x00, 0x43, 0x03, 0x0F, 0x11, 0x45,
+    0x01, 0x5C, 0x01, 0x63, 0x01, 0x0E, 0x0C, 0x42, 0x0C, 0x0E, 0x4E, 0x01, 0x55, 0x01, 0x0E, 0x02,
+    0x00, 0x80, 0x02, 0x63, 0x00, 0x02, 0x02, 0x00, 0x80, 0x05, 0x6D, 0x00, 0x03, 0x14, 0x82, 0x01,
+    0x70, 0x64, 0x00, 0x04, 0x0F, 0x04, 0x12, 0x81, 0x03, 0x61, 0x00, 0x06, 0x04, 0x0B, 0x0B, 0x0E,
+    0x02, 0x80, 0x05, 0x61, 0x00, 0x04, 0x08, 0x02, 0x04, 0x11, 0x82, 0x03, 0x65, 0x69, 0x00, 0x08,
+    0x04, 0x07, 0x02, 0x82, 0x02, 0x69, 0x65, 0x00, 0x0D, 0x42, 0x08, 0x11, 0x90, 0x01, 0x9F, 0x01,
+    0x42, 0x0B, 0x15, 0x97, 0x01, 0x7D, 0x00, 0x04, 0x08, 0x02, 0x82, 0x01, 0x65, 0x69, 0x00, 0x08,
+    0x13, 0x12, 0x82, 0x02, 0x72, 0x69, 0x00, 0x42, 0x02, 0x13, 0xAE, 0x01, 0xB7, 0x01, 0x08, 0x13,
+    0x16, 0x12, 0x82, 0x02, 0x69, 0x74, 0x00, 0x06, 0x08, 0x04, 0x07, 0x82, 0x04, 0x68, 0x74, 0x00,
+    0x60, 0x50, 0x40, 0x12, 0xCE, 0x01, 0xD6, 0x01, 0xDF, 0x01, 0x12, 0x02, 0x1B, 0x02, 0x12, 0x0E,
+    0x0E, 0x07, 0x02, 0x81, 0x03, 0x00, 0x08, 0x11, 0x13, 0x12, 0x82, 0x04, 0x6E, 0x67, 0x00, 0x08,
+    0x42, 0x12, 0x13, 0xE7, 0x01, 0xFC, 0x01, 0x42, 0x00, 0x12, 0xEE, 0x01, 0xF5, 0x01, 0x08, 0x0B,
+    0x82, 0x03, 0x69, 0x73, 0x00, 0x00, 0x02, 0x02, 0x0E, 0x81, 0x05, 0x00, 0x42, 0x08, 0x12, 0x03,
+    0x02, 0x0C, 0x02, 0x13, 0x08, 0x0F, 0x04, 0x11, 0x81, 0x03, 0x65, 0x00, 0x0E, 0x0F, 0x80, 0x03,
+    0x69, 0x00, 0x13, 0x14, 0x04, 0x11, 0x82, 0x02, 0x74, 0x75, 0x00, 0x42, 0x11, 0x13, 0x22, 0x02,
+    0x2A, 0x02, 0x13, 0x04, 0x11, 0x82, 0x03, 0x75, 0x72, 0x00, 0x04, 0x31, 0xD0, 0x00, 0x03, 0x04,
+    0x14, 0x12, 0x0F, 0x82, 0x02, 0x65, 0x75, 0x00, 0x14, 0x0E, 0x0E, 0x0B, 0x80, 0x03, 0x6B, 0x00,
+    0x42, 0x04, 0x0E, 0x47, 0x02, 0x69, 0x02, 0x43, 0x08, 0x0B, 0x0D, 0x51, 0x02, 0x59, 0x02, 0x61,
+    0x02, 0x07, 0x13, 0x1B, 0x82, 0x02, 0x65, 0x69, 0x00, 0x13, 0x08, 0x05, 0x82, 0x02, 0x6C, 0x74,
+    0x00, 0x13, 0x12, 0x08, 0x0B, 0x80, 0x04, 0x65, 0x00, 0x13, 0x00, 0x11, 0x04, 0x13, 0x0D, 0x08,
+    0x81, 0x01, 0x00, 0x43, 0x04, 0x0D, 0x14, 0x7D, 0x02, 0x8B, 0x02, 0x96, 0x02, 0x42, 0x0B, 0x15,
+    0x84, 0x02, 0x7D, 0x00, 0x00, 0x05, 0x82, 0x03, 0x73, 0x65, 0x00, 0x00, 0x08, 0x13, 0x0D, 0x0E,
+    0x02, 0x82, 0x04, 0x61, 0x69, 0x00, 0x12, 0x0D, 0x04, 0x02, 0x0D, 0x0E, 0x02, 0x81, 0x03, 0x73,
+    0x00, 0x60, 0xC0, 0x28, 0x14, 0xB1, 0x02, 0xBA, 0x02, 0xD0, 0x02, 0xD9, 0x02, 0x34, 0x03, 0x40,
+    0x03, 0x07, 0x14, 0x00, 0x02, 0x82, 0x03, 0x67, 0x68, 0x00, 0x42, 0x03, 0x06, 0xC1, 0x02, 0xC8,
+    0x02, 0x08, 0x16, 0x82, 0x03, 0x74, 0x68, 0x00, 0x0D, 0x04, 0x0B, 0x82, 0x04, 0x74, 0x68, 0x00,
+    0x12, 0x14, 0x04, 0x11, 0x82, 0x02, 0x73, 0x75, 0x00, 0x44, 0x00, 0x04, 0x12, 0x1A, 0xE6, 0x02,
+    0xEF, 0x02, 0x23, 0x03, 0x2A, 0x03, 0x11, 0x00, 0x0F, 0x0F, 0x00, 0x81, 0x05, 0x65, 0x00, 0x43,
+    0x0C, 0x11, 0x15, 0xF9, 0x02, 0xFD, 0x02, 0x1B, 0x03, 0x04, 0x35, 0x7D, 0x00, 0x42, 0x00, 0x11,
+    0x04, 0x03, 0x0A, 0x03, 0x0F, 0x00, 0x80, 0x02, 0x70, 0x00, 0x00, 0x0F, 0x42, 0x00, 0x0F, 0x13,
+    0x03, 0x18, 0x03, 0x82, 0x02, 0x70, 0x61, 0x00, 0x20, 0xF9, 0x01, 0x04, 0x0B, 0x04, 0x11, 0x81,
+    0x05, 0x61, 0x00, 0x0E, 0x02, 0x82, 0x02, 0x6E, 0x73, 0x00, 0x03, 0x0B, 0x14, 0x0E, 0x16, 0x82,
+    0x05, 0x6E, 0x27, 0x00, 0x08, 0x05, 0x04, 0x0D, 0x00, 0x0C, 0x83, 0x03, 0x69, 0x66, 0x65, 0x00,
+    0x42, 0x0F, 0x13, 0x47, 0x03, 0x58, 0x03, 0x42, 0x13, 0x14, 0x4E, 0x03, 0x53, 0x03, 0x0D, 0x08,
+    0x81, 0x02, 0x00, 0x0E, 0x80, 0x02, 0x74, 0x00, 0x0F, 0x14, 0x0E, 0x82, 0x02, 0x74, 0x70, 0x00,
+    0x44, 0x02, 0x04, 0x07, 0x11, 0x6D, 0x03, 0x77, 0x03, 0x80, 0x03, 0x8C, 0x03, 0x04, 0x14, 0x10,
+    0x04, 0x11, 0x05, 0x80, 0x06, 0x6E, 0x00, 0x13, 0x05, 0x00, 0x12, 0x82, 0x03, 0x65, 0x74, 0x00,
+    0x02, 0x11, 0x00, 0x11, 0x08, 0x04, 0x07, 0x82, 0x01, 0x69, 0x65, 0x00, 0x00, 0x01, 0x08, 0x0B,
+    0x80, 0x03, 0x72, 0x00, 0x44, 0x04, 0x06, 0x08, 0x12, 0xA1, 0x03, 0xAB, 0x03, 0xB5, 0x03, 0xBD,
+    0x03, 0x07, 0x13, 0x1B, 0x04, 0x07, 0x13, 0x1B, 0x84, 0x03, 0x00, 0x14, 0x0E, 0x11, 0x07, 0x13,
+    0x1B, 0x80, 0x06, 0x68, 0x00, 0x12, 0x07, 0x13, 0x82, 0x02, 0x69, 0x73, 0x00, 0x04, 0x12, 0x0E,
+    0x0E, 0x2B, 0x50, 0x03
+};
@@ -0,0 +1,172 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_autocorrect.h"
+}
+
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+namespace {
+
+struct correction_t {
+    uint8_t     backspaces;
+    std::string str;
+};
+
+std::vector<correction_t> corrections;
+bool                      record_corrections = true;
+
+uint16_t char_to_keycode(char c) {
+    switch (c) {
+        case ' ':
+            return KC_SPC;
+        case '\'':
+            return KC_QUOT;
+        default:
+            return KC_A + (c - 'a');
+    }
+}
+
+bool press(uint16_t keycode) {
+    keyrecord_t record  = {};
+    record.event.pressed = true;
+    return process_autocorrect(keycode, &record);
+}
+
+// Replays text through autocorrect, returning what the host would end up with
+std::string type_text(const std::string &text, std::string host = "") {
+    for (char c : text) {
+        size_t before = corrections.size();
+        bool   sent   = press(char_to_keycode(c));
+        if (corrections.size() > before) {
+            host.erase(host.size() - std::min<size_t>(host.size(), corrections.back().backspaces));
+            host += corrections.back().str;
+        }
+        if (sent) {
+            host += c;
+        }
+    }
+    return host;
+}
+
+} // namespace
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    if (!record_corrections) {
+        return true;
+    }
+    corrections.push_back({backspaces, str});
+    return false;
+}
+
+class AutoCorrectDawg : public TestFixture {
+   public:
+    void SetUp() override {
+        // Start from an empty buffer each time
+        autocorrect_disable();
+        autocorrect_enable();
+        corrections.clear();
+        record_corrections = true;
+    }
+};
+
+TEST_F(AutoCorrectDawg, CorrectsTypos) {
+    const std::pair<const char *, const char *> cases[] = {
+        {"fitler", "filter"},
+        {"the fitler", "the filter"},
+        {"lenght", "length"},
+        {"fales", "false"},
+        {"accomodate", "accommodate"},
+        {" thier", " their"},         // leading word break
+        {"thsi ", "this "},           // trailing word break
+        {" throug ", " through "},    // correction extends the typo
+        {" the the ", " the "},       // word breaks within the typo
+        {"would'nt", "wouldn't"},     // apostrophes
+        {"xacheived", "xachieved"},   // typos without word breaks can be part of other words
+        {"acheived", "achieved"},     // these four share everything but their endings
+        {"acheives", "achieves"},
+        {"acheiving", "achieving"},
+        {"acheivement", "achievement"},
+    };
+    for (auto &c : cases) {
+        SetUp();
+        EXPECT_EQ(type_text(c.first), c.second) << "typing \"" << c.first << "\"";
+        EXPECT_EQ(corrections.size(), 1) << "typing \"" << c.first << "\"";
+    }
+}
+
+TEST_F(AutoCorrectDawg, LeavesCorrectWordsAlone) {
+    for (auto text : {"filter", "their", "false", "achieved", " cheived", "othier", "thsis", "the then", "wouldn't"}) {
+        SetUp();
+        EXPECT_EQ(type_text(text), text);
+        EXPECT_TRUE(corrections.empty()) << "typing \"" << text << "\"";
+    }
+}
+
+TEST_F(AutoCorrectDawg, BackspaceAndOtherKeys) {
+    // Backspacing over the end of a typo and retyping it still corrects
+    EXPECT_EQ(type_text("fitlr"), "fitlr");
+    press(KC_BSPC);
+    EXPECT_EQ(type_text("er", "fitl"), "filter");
+
+    // Anything other than letters or word breaks clears the buffer
+    SetUp();
+    EXPECT_EQ(type_text("fit"), "fit");
+    press(KC_LEFT);
+    EXPECT_EQ(type_text("ler", "fit"), "fitler");
+    EXPECT_TRUE(corrections.empty());
+}
+
+TEST_F(AutoCorrectDawg, SendsCorrection) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+    record_corrections = false;
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    for (auto key : {key_f, key_a, key_l, key_e, key_s}) {
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AutoCorrectDawg, CorrectsTyposInProse) {
+    // Prose with the occasional typo, the way autocorrect sees it
+    const std::string corpus = "the quick brown fox jumps over the lazy dog while their friends watch from the garden "
+                               "it was not the length of the walk but the fitler on the camera that made it memorable "
+                               "we would like to accomodate everyone who wants to join although space is limited "
+                               "she acheived everything she set out to do and then some because she never gave up ";
+    for (char c : corpus) {
+        press(char_to_keycode(c));
+    }
+
+    EXPECT_EQ(corrections.size(), 3);
+}
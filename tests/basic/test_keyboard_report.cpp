@@ -0,0 +1,139 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "action_util.h"
+#include "report.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+
+// The report as it was built before the key bitmap, scanning keys[] every time.
+// Kept out of line, like the functions it is compared with.
+struct ReferenceReport {
+    report_keyboard_t report = {};
+
+    __attribute__((noinline)) void add(uint8_t code) {
+        int8_t i     = 0;
+        int8_t empty = -1;
+        for (; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i] == code) {
+                break;
+            }
+            if (empty == -1 && report.keys[i] == 0) {
+                empty = i;
+            }
+        }
+        if (i == KEYBOARD_REPORT_KEYS) {
+            if (empty != -1) {
+                report.keys[empty] = code;
+            }
+        }
+    }
+
+    __attribute__((noinline)) void del(uint8_t code) {
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i] == code) {
+                report.keys[i] = 0;
+            }
+        }
+    }
+
+    __attribute__((noinline)) bool pressed(uint8_t code) {
+        if (code == KC_NO) {
+            return false;
+        }
+        for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i] == code) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    __attribute__((noinline)) uint8_t count(void) {
+        uint8_t cnt = 0;
+        for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            if (report.keys[i]) cnt++;
+        }
+        return cnt;
+    }
+};
+
+} // namespace
+
+class KeyboardReportBuilder : public TestFixture {};
+
+TEST_F(KeyboardReportBuilder, KeysMatchReferenceByteForByte) {
+    ReferenceReport reference;
+    std::mt19937    rng(42);
+
+    ::clear_keys();
+    for (int step = 0; step < 20000; step++) {
+        // Few enough keys that the report is often full
+        uint8_t code = KC_A + rng() % 10;
+        switch (rng() % 8) {
+            case 0 ... 3:
+                ::add_key(code);
+                reference.add(code);
+                break;
+            case 4 ... 6:
+                ::del_key(code);
+                reference.del(code);
+                break;
+            default:
+                if (rng() % 16 == 0) {
+                    ::clear_keys();
+                    memset(reference.report.keys, 0, sizeof(reference.report.keys));
+                }
+                break;
+        }
+        ASSERT_EQ(memcmp(keyboard_report->keys, reference.report.keys, KEYBOARD_REPORT_KEYS), 0) << "after step " << step;
+        ASSERT_EQ(has_anykey(), reference.count()) << "after step " << step;
+        ASSERT_EQ(is_key_pressed(code), reference.pressed(code)) << "after step " << step;
+    }
+    EXPECT_FALSE(is_key_pressed(KC_NO));
+    ::clear_keys();
+}
+
+TEST_F(KeyboardReportBuilder, UnchangedKeysAreNotSentAgain) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    ::add_key(KC_A);
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing changed, or a key came and went again */
+    EXPECT_NO_REPORT(driver);
+    send_keyboard_report();
+    ::add_key(KC_A);
+    send_keyboard_report();
+    ::add_key(KC_B);
+    ::del_key(KC_B);
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Modifiers are compared as well */
+    EXPECT_REPORT(driver, (KC_A, KC_LEFT_SHIFT));
+    add_mods(MOD_BIT(KC_LEFT_SHIFT));
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    clear_mods();
+    ::clear_keys();
+    send_keyboard_report();
+    VERIFY_AND_CLEAR(driver);
+}
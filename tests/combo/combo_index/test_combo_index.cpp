@@ -0,0 +1,134 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class ComboIndex : public TestFixture {};
+
+TEST_F(ComboIndex, letter_pair_combo_tapped) {
+    TestDriver driver;
+    KeymapKey  key_q(0, 0, 1, KC_Q);
+    KeymapKey  key_w(0, 0, 2, KC_W);
+    set_keymap({key_q, key_w});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_q, key_w});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, non_combo_key_passes_through) {
+    TestDriver driver;
+    KeymapKey  key_8(0, 0, 1, KC_8);
+    set_keymap({key_8});
+
+    EXPECT_REPORT(driver, (KC_8));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_8);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, single_combo_key_released_after_term) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a, COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, modtest_at_end_of_table_held_longer_than_tapping_term) {
+    TestDriver driver;
+    KeymapKey  key_1(0, 0, 1, KC_1);
+    KeymapKey  key_2(0, 0, 2, KC_2);
+    set_keymap({key_1, key_2});
+
+    EXPECT_REPORT(driver, (KC_RIGHT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_1, key_2}, TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, osmshift_at_end_of_table_tapped) {
+    TestDriver driver;
+    KeymapKey  key_3(0, 0, 1, KC_3);
+    KeymapKey  key_4(0, 0, 2, KC_4);
+    KeymapKey  key_i(0, 0, 3, KC_I);
+    set_keymap({key_3, key_4, key_i});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_3, key_4});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_I, KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_i, COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, overlapping_combos_prefer_the_longest) {
+    TestDriver driver;
+    KeymapKey  key_5(0, 0, 1, KC_5);
+    KeymapKey  key_6(0, 0, 2, KC_6);
+    KeymapKey  key_7(0, 0, 3, KC_7);
+    set_keymap({key_5, key_6, key_7});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_5, key_6, key_7});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_5, key_6});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combos_rebuilt_after_enable) {
+    TestDriver driver;
+    KeymapKey  key_q(0, 0, 1, KC_Q);
+    KeymapKey  key_w(0, 0, 2, KC_W);
+    set_keymap({key_q, key_w});
+
+    combo_disable();
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_REPORT(driver, (KC_Q, KC_W));
+    EXPECT_REPORT(driver, (KC_W));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_q, key_w});
+    VERIFY_AND_CLEAR(driver);
+
+    combo_enable();
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_q, key_w});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, key_outside_every_combo_passes_through) {
+    TestDriver  driver;
+    keyrecord_t record = {};
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    for (bool pressed : {true, false, true, false}) {
+        record.event.pressed = pressed;
+        EXPECT_TRUE(process_combo(KC_8, &record));
+    }
+    VERIFY_AND_CLEAR(driver);
+}
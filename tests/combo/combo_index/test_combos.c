@@ -0,0 +1,674 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* Every pair of letters is a combo, followed by a few combos exercising
+ * mod-taps, one-shots and overlapping combos at the end of a large table. */
+
+#define LETTER_PAIR(a, b) uint16_t const a##b##_combo[] = {KC_##a, KC_##b, COMBO_END};
+#define LETTER_PAIR_COMBO(a, b) COMBO(a##b##_combo, KC_ENTER)
+
+// clang-format off
+LETTER_PAIR(A, B)
+LETTER_PAIR(A, C)
+LETTER_PAIR(A, D)
+LETTER_PAIR(A, E)
+LETTER_PAIR(A, F)
+LETTER_PAIR(A, G)
+LETTER_PAIR(A, H)
+LETTER_PAIR(A, I)
+LETTER_PAIR(A, J)
+LETTER_PAIR(A, K)
+LETTER_PAIR(A, L)
+LETTER_PAIR(A, M)
+LETTER_PAIR(A, N)
+LETTER_PAIR(A, O)
+LETTER_PAIR(A, P)
+LETTER_PAIR(A, Q)
+LETTER_PAIR(A, R)
+LETTER_PAIR(A, S)
+LETTER_PAIR(A, T)
+LETTER_PAIR(A, U)
+LETTER_PAIR(A, V)
+LETTER_PAIR(A, W)
+LETTER_PAIR(A, X)
+LETTER_PAIR(A, Y)
+LETTER_PAIR(A, Z)
+LETTER_PAIR(B, C)
+LETTER_PAIR(B, D)
+LETTER_PAIR(B, E)
+LETTER_PAIR(B, F)
+LETTER_PAIR(B, G)
+LETTER_PAIR(B, H)
+LETTER_PAIR(B, I)
+LETTER_PAIR(B, J)
+LETTER_PAIR(B, K)
+LETTER_PAIR(B, L)
+LETTER_PAIR(B, M)
+LETTER_PAIR(B, N)
+LETTER_PAIR(B, O)
+LETTER_PAIR(B, P)
+LETTER_PAIR(B, Q)
+LETTER_PAIR(B, R)
+LETTER_PAIR(B, S)
+LETTER_PAIR(B, T)
+LETTER_PAIR(B, U)
+LETTER_PAIR(B, V)
+LETTER_PAIR(B, W)
+LETTER_PAIR(B, X)
+LETTER_PAIR(B, Y)
+LETTER_PAIR(B, Z)
+LETTER_PAIR(C, D)
+LETTER_PAIR(C, E)
+LETTER_PAIR(C, F)
+LETTER_PAIR(C, G)
+LETTER_PAIR(C, H)
+LETTER_PAIR(C, I)
+LETTER_PAIR(C, J)
+LETTER_PAIR(C, K)
+LETTER_PAIR(C, L)
+LETTER_PAIR(C, M)
+LETTER_PAIR(C, N)
+LETTER_PAIR(C, O)
+LETTER_PAIR(C, P)
+LETTER_PAIR(C, Q)
+LETTER_PAIR(C, R)
+LETTER_PAIR(C, S)
+LETTER_PAIR(C, T)
+LETTER_PAIR(C, U)
+LETTER_PAIR(C, V)
+LETTER_PAIR(C, W)
+LETTER_PAIR(C, X)
+LETTER_PAIR(C, Y)
+LETTER_PAIR(C, Z)
+LETTER_PAIR(D, E)
+LETTER_PAIR(D, F)
+LETTER_PAIR(D, G)
+LETTER_PAIR(D, H)
+LETTER_PAIR(D, I)
+LETTER_PAIR(D, J)
+LETTER_PAIR(D, K)
+LETTER_PAIR(D, L)
+LETTER_PAIR(D, M)
+LETTER_PAIR(D, N)
+LETTER_PAIR(D, O)
+LETTER_PAIR(D, P)
+LETTER_PAIR(D, Q)
+LETTER_PAIR(D, R)
+LETTER_PAIR(D, S)
+LETTER_PAIR(D, T)
+LETTER_PAIR(D, U)
+LETTER_PAIR(D, V)
+LETTER_PAIR(D, W)
+LETTER_PAIR(D, X)
+LETTER_PAIR(D, Y)
+LETTER_PAIR(D, Z)
+LETTER_PAIR(E, F)
+LETTER_PAIR(E, G)
+LETTER_PAIR(E, H)
+LETTER_PAIR(E, I)
+LETTER_PAIR(E, J)
+LETTER_PAIR(E, K)
+LETTER_PAIR(E, L)
+LETTER_PAIR(E, M)
+LETTER_PAIR(E, N)
+LETTER_PAIR(E, O)
+LETTER_PAIR(E, P)
+LETTER_PAIR(E, Q)
+LETTER_PAIR(E, R)
+LETTER_PAIR(E, S)
+LETTER_PAIR(E, T)
+LETTER_PAIR(E, U)
+LETTER_PAIR(E, V)
+LETTER_PAIR(E, W)
+LETTER_PAIR(E, X)
+LETTER_PAIR(E, Y)
+LETTER_PAIR(E, Z)
+LETTER_PAIR(F, G)
+LETTER_PAIR(F, H)
+LETTER_PAIR(F, I)
+LETTER_PAIR(F, J)
+LETTER_PAIR(F, K)
+LETTER_PAIR(F, L)
+LETTER_PAIR(F, M)
+LETTER_PAIR(F, N)
+LETTER_PAIR(F, O)
+LETTER_PAIR(F, P)
+LETTER_PAIR(F, Q)
+LETTER_PAIR(F, R)
+LETTER_PAIR(F, S)
+LETTER_PAIR(F, T)
+LETTER_PAIR(F, U)
+LETTER_PAIR(F, V)
+LETTER_PAIR(F, W)
+LETTER_PAIR(F, X)
+LETTER_PAIR(F, Y)
+LETTER_PAIR(F, Z)
+LETTER_PAIR(G, H)
+LETTER_PAIR(G, I)
+LETTER_PAIR(G, J)
+LETTER_PAIR(G, K)
+LETTER_PAIR(G, L)
+LETTER_PAIR(G, M)
+LETTER_PAIR(G, N)
+LETTER_PAIR(G, O)
+LETTER_PAIR(G, P)
+LETTER_PAIR(G, Q)
+LETTER_PAIR(G, R)
+LETTER_PAIR(G, S)
+LETTER_PAIR(G, T)
+LETTER_PAIR(G, U)
+LETTER_PAIR(G, V)
+LETTER_PAIR(G, W)
+LETTER_PAIR(G, X)
+LETTER_PAIR(G, Y)
+LETTER_PAIR(G, Z)
+LETTER_PAIR(H, I)
+LETTER_PAIR(H, J)
+LETTER_PAIR(H, K)
+LETTER_PAIR(H, L)
+LETTER_PAIR(H, M)
+LETTER_PAIR(H, N)
+LETTER_PAIR(H, O)
+LETTER_PAIR(H, P)
+LETTER_PAIR(H, Q)
+LETTER_PAIR(H, R)
+LETTER_PAIR(H, S)
+LETTER_PAIR(H, T)
+LETTER_PAIR(H, U)
+LETTER_PAIR(H, V)
+LETTER_PAIR(H, W)
+LETTER_PAIR(H, X)
+LETTER_PAIR(H, Y)
+LETTER_PAIR(H, Z)
+LETTER_PAIR(I, J)
+LETTER_PAIR(I, K)
+LETTER_PAIR(I, L)
+LETTER_PAIR(I, M)
+LETTER_PAIR(I, N)
+LETTER_PAIR(I, O)
+LETTER_PAIR(I, P)
+LETTER_PAIR(I, Q)
+LETTER_PAIR(I, R)
+LETTER_PAIR(I, S)
+LETTER_PAIR(I, T)
+LETTER_PAIR(I, U)
+LETTER_PAIR(I, V)
+LETTER_PAIR(I, W)
+LETTER_PAIR(I, X)
+LETTER_PAIR(I, Y)
+LETTER_PAIR(I, Z)
+LETTER_PAIR(J, K)
+LETTER_PAIR(J, L)
+LETTER_PAIR(J, M)
+LETTER_PAIR(J, N)
+LETTER_PAIR(J, O)
+LETTER_PAIR(J, P)
+LETTER_PAIR(J, Q)
+LETTER_PAIR(J, R)
+LETTER_PAIR(J, S)
+LETTER_PAIR(J, T)
+LETTER_PAIR(J, U)
+LETTER_PAIR(J, V)
+LETTER_PAIR(J, W)
+LETTER_PAIR(J, X)
+LETTER_PAIR(J, Y)
+LETTER_PAIR(J, Z)
+LETTER_PAIR(K, L)
+LETTER_PAIR(K, M)
+LETTER_PAIR(K, N)
+LETTER_PAIR(K, O)
+LETTER_PAIR(K, P)
+LETTER_PAIR(K, Q)
+LETTER_PAIR(K, R)
+LETTER_PAIR(K, S)
+LETTER_PAIR(K, T)
+LETTER_PAIR(K, U)
+LETTER_PAIR(K, V)
+LETTER_PAIR(K, W)
+LETTER_PAIR(K, X)
+LETTER_PAIR(K, Y)
+LETTER_PAIR(K, Z)
+LETTER_PAIR(L, M)
+LETTER_PAIR(L, N)
+LETTER_PAIR(L, O)
+LETTER_PAIR(L, P)
+LETTER_PAIR(L, Q)
+LETTER_PAIR(L, R)
+LETTER_PAIR(L, S)
+LETTER_PAIR(L, T)
+LETTER_PAIR(L, U)
+LETTER_PAIR(L, V)
+LETTER_PAIR(L, W)
+LETTER_PAIR(L, X)
+LETTER_PAIR(L, Y)
+LETTER_PAIR(L, Z)
+LETTER_PAIR(M, N)
+LETTER_PAIR(M, O)
+LETTER_PAIR(M, P)
+LETTER_PAIR(M, Q)
+LETTER_PAIR(M, R)
+LETTER_PAIR(M, S)
+LETTER_PAIR(M, T)
+LETTER_PAIR(M, U)
+LETTER_PAIR(M, V)
+LETTER_PAIR(M, W)
+LETTER_PAIR(M, X)
+LETTER_PAIR(M, Y)
+LETTER_PAIR(M, Z)
+LETTER_PAIR(N, O)
+LETTER_PAIR(N, P)
+LETTER_PAIR(N, Q)
+LETTER_PAIR(N, R)
+LETTER_PAIR(N, S)
+LETTER_PAIR(N, T)
+LETTER_PAIR(N, U)
+LETTER_PAIR(N, V)
+LETTER_PAIR(N, W)
+LETTER_PAIR(N, X)
+LETTER_PAIR(N, Y)
+LETTER_PAIR(N, Z)
+LETTER_PAIR(O, P)
+LETTER_PAIR(O, Q)
+LETTER_PAIR(O, R)
+LETTER_PAIR(O, S)
+LETTER_PAIR(O, T)
+LETTER_PAIR(O, U)
+LETTER_PAIR(O, V)
+LETTER_PAIR(O, W)
+LETTER_PAIR(O, X)
+LETTER_PAIR(O, Y)
+LETTER_PAIR(O, Z)
+LETTER_PAIR(P, Q)
+LETTER_PAIR(P, R)
+LETTER_PAIR(P, S)
+LETTER_PAIR(P, T)
+LETTER_PAIR(P, U)
+LETTER_PAIR(P, V)
+LETTER_PAIR(P, W)
+LETTER_PAIR(P, X)
+LETTER_PAIR(P, Y)
+LETTER_PAIR(P, Z)
+LETTER_PAIR(Q, R)
+LETTER_PAIR(Q, S)
+LETTER_PAIR(Q, T)
+LETTER_PAIR(Q, U)
+LETTER_PAIR(Q, V)
+LETTER_PAIR(Q, W)
+LETTER_PAIR(Q, X)
+LETTER_PAIR(Q, Y)
+LETTER_PAIR(Q, Z)
+LETTER_PAIR(R, S)
+LETTER_PAIR(R, T)
+LETTER_PAIR(R, U)
+LETTER_PAIR(R, V)
+LETTER_PAIR(R, W)
+LETTER_PAIR(R, X)
+LETTER_PAIR(R, Y)
+LETTER_PAIR(R, Z)
+LETTER_PAIR(S, T)
+LETTER_PAIR(S, U)
+LETTER_PAIR(S, V)
+LETTER_PAIR(S, W)
+LETTER_PAIR(S, X)
+LETTER_PAIR(S, Y)
+LETTER_PAIR(S, Z)
+LETTER_PAIR(T, U)
+LETTER_PAIR(T, V)
+LETTER_PAIR(T, W)
+LETTER_PAIR(T, X)
+LETTER_PAIR(T, Y)
+LETTER_PAIR(T, Z)
+LETTER_PAIR(U, V)
+LETTER_PAIR(U, W)
+LETTER_PAIR(U, X)
+LETTER_PAIR(U, Y)
+LETTER_PAIR(U, Z)
+LETTER_PAIR(V, W)
+LETTER_PAIR(V, X)
+LETTER_PAIR(V, Y)
+LETTER_PAIR(V, Z)
+LETTER_PAIR(W, X)
+LETTER_PAIR(W, Y)
+LETTER_PAIR(W, Z)
+LETTER_PAIR(X, Y)
+LETTER_PAIR(X, Z)
+LETTER_PAIR(Y, Z)
+
+uint16_t const modtest_combo[]  = {KC_1, KC_2, COMBO_END};
+uint16_t const osmshift_combo[] = {KC_3, KC_4, COMBO_END};
+uint16_t const short_combo[]    = {KC_5, KC_6, COMBO_END};
+uint16_t const long_combo[]     = {KC_5, KC_6, KC_7, COMBO_END};
+
+combo_t key_combos[] = {
+    LETTER_PAIR_COMBO(A, B),
+    LETTER_PAIR_COMBO(A, C),
+    LETTER_PAIR_COMBO(A, D),
+    LETTER_PAIR_COMBO(A, E),
+    LETTER_PAIR_COMBO(A, F),
+    LETTER_PAIR_COMBO(A, G),
+    LETTER_PAIR_COMBO(A, H),
+    LETTER_PAIR_COMBO(A, I),
+    LETTER_PAIR_COMBO(A, J),
+    LETTER_PAIR_COMBO(A, K),
+    LETTER_PAIR_COMBO(A, L),
+    LETTER_PAIR_COMBO(A, M),
+    LETTER_PAIR_COMBO(A, N),
+    LETTER_PAIR_COMBO(A, O),
+    LETTER_PAIR_COMBO(A, P),
+    LETTER_PAIR_COMBO(A, Q),
+    LETTER_PAIR_COMBO(A, R),
+    LETTER_PAIR_COMBO(A, S),
+    LETTER_PAIR_COMBO(A, T),
+    LETTER_PAIR_COMBO(A, U),
+    LETTER_PAIR_COMBO(A, V),
+    LETTER_PAIR_COMBO(A, W),
+    LETTER_PAIR_COMBO(A, X),
+    LETTER_PAIR_COMBO(A, Y),
+    LETTER_PAIR_COMBO(A, Z),
+    LETTER_PAIR_COMBO(B, C),
+    LETTER_PAIR_COMBO(B, D),
+    LETTER_PAIR_COMBO(B, E),
+    LETTER_PAIR_COMBO(B, F),
+    LETTER_PAIR_COMBO(B, G),
+    LETTER_PAIR_COMBO(B, H),
+    LETTER_PAIR_COMBO(B, I),
+    LETTER_PAIR_COMBO(B, J),
+    LETTER_PAIR_COMBO(B, K),
+    LETTER_PAIR_COMBO(B, L),
+    LETTER_PAIR_COMBO(B, M),
+    LETTER_PAIR_COMBO(B, N),
+    LETTER_PAIR_COMBO(B, O),
+    LETTER_PAIR_COMBO(B, P),
+    LETTER_PAIR_COMBO(B, Q),
+    LETTER_PAIR_COMBO(B, R),
+    LETTER_PAIR_COMBO(B, S),
+    LETTER_PAIR_COMBO(B, T),
+    LETTER_PAIR_COMBO(B, U),
+    LETTER_PAIR_COMBO(B, V),
+    LETTER_PAIR_COMBO(B, W),
+    LETTER_PAIR_COMBO(B, X),
+    LETTER_PAIR_COMBO(B, Y),
+    LETTER_PAIR_COMBO(B, Z),
+    LETTER_PAIR_COMBO(C, D),
+    LETTER_PAIR_COMBO(C, E),
+    LETTER_PAIR_COMBO(C, F),
+    LETTER_PAIR_COMBO(C, G),
+    LETTER_PAIR_COMBO(C, H),
+    LETTER_PAIR_COMBO(C, I),
+    LETTER_PAIR_COMBO(C, J),
+    LETTER_PAIR_COMBO(C, K),
+    LETTER_PAIR_COMBO(C, L),
+    LETTER_PAIR_COMBO(C, M),
+    LETTER_PAIR_COMBO(C, N),
+    LETTER_PAIR_COMBO(C, O),
+    LETTER_PAIR_COMBO(C, P),
+    LETTER_PAIR_COMBO(C, Q),
+    LETTER_PAIR_COMBO(C, R),
+    LETTER_PAIR_COMBO(C, S),
+    LETTER_PAIR_COMBO(C, T),
+    LETTER_PAIR_COMBO(C, U),
+    LETTER_PAIR_COMBO(C, V),
+    LETTER_PAIR_COMBO(C, W),
+    LETTER_PAIR_COMBO(C, X),
+    LETTER_PAIR_COMBO(C, Y),
+    LETTER_PAIR_COMBO(C, Z),
+    LETTER_PAIR_COMBO(D, E),
+    LETTER_PAIR_COMBO(D, F),
+    LETTER_PAIR_COMBO(D, G),
+    LETTER_PAIR_COMBO(D, H),
+    LETTER_PAIR_COMBO(D, I),
+    LETTER_PAIR_COMBO(D, J),
+    LETTER_PAIR_COMBO(D, K),
+    LETTER_PAIR_COMBO(D, L),
+    LETTER_PAIR_COMBO(D, M),
+    LETTER_PAIR_COMBO(D, N),
+    LETTER_PAIR_COMBO(D, O),
+    LETTER_PAIR_COMBO(D, P),
+    LETTER_PAIR_COMBO(D, Q),
+    LETTER_PAIR_COMBO(D, R),
+    LETTER_PAIR_COMBO(D, S),
+    LETTER_PAIR_COMBO(D, T),
+    LETTER_PAIR_COMBO(D, U),
+    LETTER_PAIR_COMBO(D, V),
+    LETTER_PAIR_COMBO(D, W),
+    LETTER_PAIR_COMBO(D, X),
+    LETTER_PAIR_COMBO(D, Y),
+    LETTER_PAIR_COMBO(D, Z),
+    LETTER_PAIR_COMBO(E, F),
+    LETTER_PAIR_COMBO(E, G),
+    LETTER_PAIR_COMBO(E, H),
+    LETTER_PAIR_COMBO(E, I),
+    LETTER_PAIR_COMBO(E, J),
+    LETTER_PAIR_COMBO(E, K),
+    LETTER_PAIR_COMBO(E, L),
+    LETTER_PAIR_COMBO(E, M),
+    LETTER_PAIR_COMBO(E, N),
+    LETTER_PAIR_COMBO(E, O),
+    LETTER_PAIR_COMBO(E, P),
+    LETTER_PAIR_COMBO(E, Q),
+    LETTER_PAIR_COMBO(E, R),
+    LETTER_PAIR_COMBO(E, S),
+    LETTER_PAIR_COMBO(E, T),
+    LETTER_PAIR_COMBO(E, U),
+    LETTER_PAIR_COMBO(E, V),
+    LETTER_PAIR_COMBO(E, W),
+    LETTER_PAIR_COMBO(E, X),
+    LETTER_PAIR_COMBO(E, Y),
+    LETTER_PAIR_COMBO(E, Z),
+    LETTER_PAIR_COMBO(F, G),
+    LETTER_PAIR_COMBO(F, H),
+    LETTER_PAIR_COMBO(F, I),
+    LETTER_PAIR_COMBO(F, J),
+    LETTER_PAIR_COMBO(F, K),
+    LETTER_PAIR_COMBO(F, L),
+    LETTER_PAIR_COMBO(F, M),
+    LETTER_PAIR_COMBO(F, N),
+    LETTER_PAIR_COMBO(F, O),
+    LETTER_PAIR_COMBO(F, P),
+    LETTER_PAIR_COMBO(F, Q),
+    LETTER_PAIR_COMBO(F, R),
+    LETTER_PAIR_COMBO(F, S),
+    LETTER_PAIR_COMBO(F, T),
+    LETTER_PAIR_COMBO(F, U),
+    LETTER_PAIR_COMBO(F, V),
+    LETTER_PAIR_COMBO(F, W),
+    LETTER_PAIR_COMBO(F, X),
+    LETTER_PAIR_COMBO(F, Y),
+    LETTER_PAIR_COMBO(F, Z),
+    LETTER_PAIR_COMBO(G, H),
+    LETTER_PAIR_COMBO(G, I),
+    LETTER_PAIR_COMBO(G, J),
+    LETTER_PAIR_COMBO(G, K),
+    LETTER_PAIR_COMBO(G, L),
+    LETTER_PAIR_COMBO(G, M),
+    LETTER_PAIR_COMBO(G, N),
+    LETTER_PAIR_COMBO(G, O),
+    LETTER_PAIR_COMBO(G, P),
+    LETTER_PAIR_COMBO(G, Q),
+    LETTER_PAIR_COMBO(G, R),
+    LETTER_PAIR_COMBO(G, S),
+    LETTER_PAIR_COMBO(G, T),
+    LETTER_PAIR_COMBO(G, U),
+    LETTER_PAIR_COMBO(G, V),
+    LETTER_PAIR_COMBO(G, W),
+    LETTER_PAIR_COMBO(G, X),
+    LETTER_PAIR_COMBO(G, Y),
+    LETTER_PAIR_COMBO(G, Z),
+    LETTER_PAIR_COMBO(H, I),
+    LETTER_PAIR_COMBO(H, J),
+    LETTER_PAIR_COMBO(H, K),
+    LETTER_PAIR_COMBO(H, L),
+    LETTER_PAIR_COMBO(H, M),
+    LETTER_PAIR_COMBO(H, N),
+    LETTER_PAIR_COMBO(H, O),
+    LETTER_PAIR_COMBO(H, P),
+    LETTER_PAIR_COMBO(H, Q),
+    LETTER_PAIR_COMBO(H, R),
+    LETTER_PAIR_COMBO(H, S),
+    LETTER_PAIR_COMBO(H, T),
+    LETTER_PAIR_COMBO(H, U),
+    LETTER_PAIR_COMBO(H, V),
+    LETTER_PAIR_COMBO(H, W),
+    LETTER_PAIR_COMBO(H, X),
+    LETTER_PAIR_COMBO(H, Y),
+    LETTER_PAIR_COMBO(H, Z),
+    LETTER_PAIR_COMBO(I, J),
+    LETTER_PAIR_COMBO(I, K),
+    LETTER_PAIR_COMBO(I, L),
+    LETTER_PAIR_COMBO(I, M),
+    LETTER_PAIR_COMBO(I, N),
+    LETTER_PAIR_COMBO(I, O),
+    LETTER_PAIR_COMBO(I, P),
+    LETTER_PAIR_COMBO(I, Q),
+    LETTER_PAIR_COMBO(I, R),
+    LETTER_PAIR_COMBO(I, S),
+    LETTER_PAIR_COMBO(I, T),
+    LETTER_PAIR_COMBO(I, U),
+    LETTER_PAIR_COMBO(I, V),
+    LETTER_PAIR_COMBO(I, W),
+    LETTER_PAIR_COMBO(I, X),
+    LETTER_PAIR_COMBO(I, Y),
+    LETTER_PAIR_COMBO(I, Z),
+    LETTER_PAIR_COMBO(J, K),
+    LETTER_PAIR_COMBO(J, L),
+    LETTER_PAIR_COMBO(J, M),
+    LETTER_PAIR_COMBO(J, N),
+    LETTER_PAIR_COMBO(J, O),
+    LETTER_PAIR_COMBO(J, P),
+    LETTER_PAIR_COMBO(J, Q),
+    LETTER_PAIR_COMBO(J, R),
+    LETTER_PAIR_COMBO(J, S),
+    LETTER_PAIR_COMBO(J, T),
+    LETTER_PAIR_COMBO(J, U),
+    LETTER_PAIR_COMBO(J, V),
+    LETTER_PAIR_COMBO(J, W),
+    LETTER_PAIR_COMBO(J, X),
+    LETTER_PAIR_COMBO(J, Y),
+    LETTER_PAIR_COMBO(J, Z),
+    LETTER_PAIR_COMBO(K, L),
+    LETTER_PAIR_COMBO(K, M),
+    LETTER_PAIR_COMBO(K, N),
+    LETTER_PAIR_COMBO(K, O),
+    LETTER_PAIR_COMBO(K, P),
+    LETTER_PAIR_COMBO(K, Q),
+    LETTER_PAIR_COMBO(K, R),
+    LETTER_PAIR_COMBO(K, S),
+    LETTER_PAIR_COMBO(K, T),
+    LETTER_PAIR_COMBO(K, U),
+    LETTER_PAIR_COMBO(K, V),
+    LETTER_PAIR_COMBO(K, W),
+    LETTER_PAIR_COMBO(K, X),
+    LETTER_PAIR_COMBO(K, Y),
+    LETTER_PAIR_COMBO(K, Z),
+    LETTER_PAIR_COMBO(L, M),
+    LETTER_PAIR_COMBO(L, N),
+    LETTER_PAIR_COMBO(L, O),
+    LETTER_PAIR_COMBO(L, P),
+    LETTER_PAIR_COMBO(L, Q),
+    LETTER_PAIR_COMBO(L, R),
+    LETTER_PAIR_COMBO(L, S),
+    LETTER_PAIR_COMBO(L, T),
+    LETTER_PAIR_COMBO(L, U),
+    LETTER_PAIR_COMBO(L, V),
+    LETTER_PAIR_COMBO(L, W),
+    LETTER_PAIR_COMBO(L, X),
+    LETTER_PAIR_COMBO(L, Y),
+    LETTER_PAIR_COMBO(L, Z),
+    LETTER_PAIR_COMBO(M, N),
+    LETTER_PAIR_COMBO(M, O),
+    LETTER_PAIR_COMBO(M, P),
+    LETTER_PAIR_COMBO(M, Q),
+    LETTER_PAIR_COMBO(M, R),
+    LETTER_PAIR_COMBO(M, S),
+    LETTER_PAIR_COMBO(M, T),
+    LETTER_PAIR_COMBO(M, U),
+    LETTER_PAIR_COMBO(M, V),
+    LETTER_PAIR_COMBO(M, W),
+    LETTER_PAIR_COMBO(M, X),
+    LETTER_PAIR_COMBO(M, Y),
+    LETTER_PAIR_COMBO(M, Z),
+    LETTER_PAIR_COMBO(N, O),
+    LETTER_PAIR_COMBO(N, P),
+    LETTER_PAIR_COMBO(N, Q),
+    LETTER_PAIR_COMBO(N, R),
+    LETTER_PAIR_COMBO(N, S),
+    LETTER_PAIR_COMBO(N, T),
+    LETTER_PAIR_COMBO(N, U),
+    LETTER_PAIR_COMBO(N, V),
+    LETTER_PAIR_COMBO(N, W),
+    LETTER_PAIR_COMBO(N, X),
+    LETTER_PAIR_COMBO(N, Y),
+    LETTER_PAIR_COMBO(N, Z),
+    LETTER_PAIR_COMBO(O, P),
+    LETTER_PAIR_COMBO(O, Q),
+    LETTER_PAIR_COMBO(O, R),
+    LETTER_PAIR_COMBO(O, S),
+    LETTER_PAIR_COMBO(O, T),
+    LETTER_PAIR_COMBO(O, U),
+    LETTER_PAIR_COMBO(O, V),
+    LETTER_PAIR_COMBO(O, W),
+    LETTER_PAIR_COMBO(O, X),
+    LETTER_PAIR_COMBO(O, Y),
+    LETTER_PAIR_COMBO(O, Z),
+    LETTER_PAIR_COMBO(P, Q),
+    LETTER_PAIR_COMBO(P, R),
+    LETTER_PAIR_COMBO(P, S),
+    LETTER_PAIR_COMBO(P, T),
+    LETTER_PAIR_COMBO(P, U),
+    LETTER_PAIR_COMBO(P, V),
+    LETTER_PAIR_COMBO(P, W),
+    LETTER_PAIR_COMBO(P, X),
+    LETTER_PAIR_COMBO(P, Y),
+    LETTER_PAIR_COMBO(P, Z),
+    LETTER_PAIR_COMBO(Q, R),
+    LETTER_PAIR_COMBO(Q, S),
+    LETTER_PAIR_COMBO(Q, T),
+    LETTER_PAIR_COMBO(Q, U),
+    LETTER_PAIR_COMBO(Q, V),
+    LETTER_PAIR_COMBO(Q, W),
+    LETTER_PAIR_COMBO(Q, X),
+    LETTER_PAIR_COMBO(Q, Y),
+    LETTER_PAIR_COMBO(Q, Z),
+    LETTER_PAIR_COMBO(R, S),
+    LETTER_PAIR_COMBO(R, T),
+    LETTER_PAIR_COMBO(R, U),
+    LETTER_PAIR_COMBO(R, V),
+    LETTER_PAIR_COMBO(R, W),
+    LETTER_PAIR_COMBO(R, X),
+    LETTER_PAIR_COMBO(R, Y),
+    LETTER_PAIR_COMBO(R, Z),
+    LETTER_PAIR_COMBO(S, T),
+    LETTER_PAIR_COMBO(S, U),
+    LETTER_PAIR_COMBO(S, V),
+    LETTER_PAIR_COMBO(S, W),
+    LETTER_PAIR_COMBO(S, X),
+    LETTER_PAIR_COMBO(S, Y),
+    LETTER_PAIR_COMBO(S, Z),
+    LETTER_PAIR_COMBO(T, U),
+    LETTER_PAIR_COMBO(T, V),
+    LETTER_PAIR_COMBO(T, W),
+    LETTER_PAIR_COMBO(T, X),
+    LETTER_PAIR_COMBO(T, Y),
+    LETTER_PAIR_COMBO(T, Z),
+    LETTER_PAIR_COMBO(U, V),
+    LETTER_PAIR_COMBO(U, W),
+    LETTER_PAIR_COMBO(U, X),
+    LETTER_PAIR_COMBO(U, Y),
+    LETTER_PAIR_COMBO(U, Z),
+    LETTER_PAIR_COMBO(V, W),
+    LETTER_PAIR_COMBO(V, X),
+    LETTER_PAIR_COMBO(V, Y),
+    LETTER_PAIR_COMBO(V, Z),
+    LETTER_PAIR_COMBO(W, X),
+    LETTER_PAIR_COMBO(W, Y),
+    LETTER_PAIR_COMBO(W, Z),
+    LETTER_PAIR_COMBO(X, Y),
+    LETTER_PAIR_COMBO(X, Z),
+    LETTER_PAIR_COMBO(Y, Z),
+    COMBO(modtest_combo, RSFT_T(KC_SPACE)),
+    COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    COMBO(short_combo, KC_TAB),
+    COMBO(long_combo, KC_ESCAPE)
+};
+// clang-format on
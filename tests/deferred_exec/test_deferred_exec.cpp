@@ -0,0 +1,226 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+struct callback_state {
+    uint32_t calls        = 0;
+    uint32_t last_trigger = 0;
+    uint32_t repeat_ms    = 0;
+};
+
+uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    auto state          = static_cast<callback_state *>(cb_arg);
+    state->last_trigger = trigger_time;
+    state->calls++;
+    return state->repeat_ms;
+}
+
+/* Executor throttling remembers the last run, so every test starts later than the previous one */
+uint32_t start_time(void) {
+    static uint32_t base = 0;
+    base += 100000;
+    set_time(base);
+    return base;
+}
+
+void run_for(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        advance_time(1);
+        deferred_exec_task();
+    }
+}
+} // namespace
+
+class DeferredExec : public TestFixture {};
+
+TEST_F(DeferredExec, ExecutesAfterDelay) {
+    callback_state state;
+    uint32_t       deadline;
+
+    uint32_t now = start_time();
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+
+    deferred_token token = defer_exec(50, record_callback, &state);
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, now + 50);
+
+    run_for(49);
+    EXPECT_EQ(state.calls, 0);
+    run_for(1);
+    EXPECT_EQ(state.calls, 1);
+    EXPECT_EQ(state.last_trigger, now + 50);
+
+    /* One-shot executors free their slot */
+    EXPECT_FALSE(cancel_deferred_exec(token));
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToTrigger) {
+    callback_state state;
+    state.repeat_ms = 10;
+    uint32_t deadline;
+
+    uint32_t       now   = start_time();
+    deferred_token token = defer_exec(10, record_callback, &state);
+    run_for(35);
+    EXPECT_EQ(state.calls, 3);
+    EXPECT_EQ(state.last_trigger, now + 30);
+    EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, now + 40);
+
+    /* Cancelling the last executor leaves nothing to wait for */
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+    run_for(20);
+    EXPECT_EQ(state.calls, 3);
+}
+
+TEST_F(DeferredExec, ExtendAndCancel) {
+    callback_state early, late;
+    uint32_t       deadline;
+
+    uint32_t       now         = start_time();
+    deferred_token late_token  = defer_exec(100, record_callback, &late);
+    deferred_token early_token = defer_exec(500, record_callback, &early);
+
+    /* Extending to an earlier point has to move the next deadline forward */
+    EXPECT_TRUE(extend_deferred_exec(early_token, 20));
+    EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, now + 20);
+
+    /* Cancelling the next one due moves the deadline back to the one after it */
+    callback_state cancelled;
+    EXPECT_TRUE(cancel_deferred_exec(defer_exec(10, record_callback, &cancelled)));
+    EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, now + 20);
+
+    run_for(20);
+    EXPECT_EQ(early.calls, 1);
+    EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, now + 100);
+
+    EXPECT_TRUE(extend_deferred_exec(late_token, 200));
+    run_for(100);
+    EXPECT_EQ(late.calls, 0);
+    run_for(100);
+    EXPECT_EQ(late.calls, 1);
+
+    EXPECT_FALSE(extend_deferred_exec(late_token, 10));
+    EXPECT_FALSE(cancel_deferred_exec(INVALID_DEFERRED_TOKEN));
+}
+
+TEST_F(DeferredExec, TableFull) {
+    std::vector<callback_state> states(MAX_DEFERRED_EXECUTORS + 1);
+    std::vector<deferred_token> tokens;
+
+    start_time();
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        deferred_token token = defer_exec(10 + i, record_callback, &states[i]);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        for (auto other : tokens) {
+            EXPECT_NE(token, other);
+        }
+        tokens.push_back(token);
+    }
+    EXPECT_EQ(defer_exec(10, record_callback, &states[MAX_DEFERRED_EXECUTORS]), INVALID_DEFERRED_TOKEN);
+
+    /* A freed slot hands out a different token, so the stale one stays invalid */
+    EXPECT_TRUE(cancel_deferred_exec(tokens[3]));
+    deferred_token reused = defer_exec(10, record_callback, &states[MAX_DEFERRED_EXECUTORS]);
+    EXPECT_NE(reused, INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(reused, tokens[3]);
+    EXPECT_FALSE(cancel_deferred_exec(tokens[3]));
+    EXPECT_TRUE(cancel_deferred_exec(reused));
+
+    for (auto token : tokens) {
+        cancel_deferred_exec(token);
+    }
+}
+
+TEST_F(DeferredExec, StaleTokenAfterSlotReuse) {
+    callback_state stale_state, state;
+
+    start_time();
+    deferred_token stale = defer_exec(10, record_callback, &stale_state);
+    EXPECT_TRUE(cancel_deferred_exec(stale));
+
+    /* The freed slot is reused straight away, but never under the stale token */
+    for (int i = 0; i < UINT8_MAX - 1; i++) {
+        deferred_token token = defer_exec(10, record_callback, &state);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        EXPECT_NE(token, stale);
+        EXPECT_FALSE(cancel_deferred_exec(stale));
+        EXPECT_FALSE(extend_deferred_exec(stale, 100));
+        if (i < UINT8_MAX - 2) {
+            EXPECT_TRUE(cancel_deferred_exec(token));
+        }
+    }
+
+    /* The last executor is unaffected by the stale token */
+    run_for(10);
+    EXPECT_EQ(stale_state.calls, 0);
+    EXPECT_EQ(state.calls, 1);
+}
+
+TEST_F(DeferredExec, AdvancedTableLargerThanTokenSpace) {
+    static const size_t         table_count = 300;
+    static deferred_executor_t  table[table_count];
+    std::vector<callback_state> states(table_count);
+    std::vector<deferred_token> tokens;
+    uint32_t                    last_execution = start_time();
+
+    /* Every token in use is unique, so the table runs out of tokens before it runs out of slots */
+    for (size_t i = 0; i < table_count; i++) {
+        deferred_token token = defer_exec_advanced(table, table_count, 10, record_callback, &states[i]);
+        if (token == INVALID_DEFERRED_TOKEN) {
+            break;
+        }
+        tokens.push_back(token);
+    }
+    EXPECT_EQ(tokens.size(), UINT8_MAX);
+    std::sort(tokens.begin(), tokens.end());
+    EXPECT_EQ(std::unique(tokens.begin(), tokens.end()), tokens.end());
+
+    for (int i = 0; i < 10; i++) {
+        advance_time(1);
+        deferred_exec_advanced_task(table, table_count, &last_execution);
+    }
+    for (size_t i = 0; i < tokens.size(); i++) {
+        EXPECT_EQ(states[i].calls, 1);
+    }
+    uint32_t deadline;
+    EXPECT_FALSE(deferred_exec_advanced_next_deadline(table, table_count, &deadline));
+}
+
+TEST_F(DeferredExec, CallbackQueuesAnother) {
+    static callback_state chained;
+    callback_state        first;
+    uint32_t              deadline;
+
+    auto chain = [](uint32_t trigger_time, void *cb_arg) -> uint32_t {
+        defer_exec(25, record_callback, &chained);
+        return record_callback(trigger_time, cb_arg);
+    };
+
+    uint32_t now = start_time();
+    defer_exec(5, chain, &first);
+    run_for(5);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, now + 30);
+    run_for(25);
+    EXPECT_EQ(chained.calls, 1);
+}
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define NUM_ENCODERS 2
+#define ENCODER_MAP_KEY_DELAY 10
+#define ENCODER_MAP_COALESCE
@@ -0,0 +1,8 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+ENCODER_ENABLE = yes
+ENCODER_DRIVER = custom
+ENCODER_MAP_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_encoders.c
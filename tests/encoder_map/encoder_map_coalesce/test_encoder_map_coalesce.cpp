@@ -0,0 +1,60 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../encoder_map_fixture.hpp"
+
+class EncoderMapCoalesce : public EncoderMapFixture {};
+
+namespace {
+uint16_t coalesced_detents = 0;
+} // namespace
+
+extern "C" uint8_t encoder_map_coalesce_user(uint8_t index, bool clockwise, uint8_t detents) {
+    coalesced_detents += detents;
+    // The second encoder scrolls one step per burst, however fast it is turned
+    return index == 1 ? 1 : detents;
+}
+
+TEST_F(EncoderMapCoalesce, FastSpinTapsEveryDetent) {
+    TestDriver driver;
+    record_reports(driver);
+    coalesced_detents = 0;
+
+    // A detent every 2ms, much faster than the taps can be sent
+    constexpr uint16_t detents = 50;
+    spin(0, true, detents, 2, 2000);
+
+    auto keys = taps();
+    EXPECT_EQ(keys, std::vector<uint8_t>(detents, KC_B)) << "detents were dropped";
+    EXPECT_EQ(coalesced_detents, detents);
+    EXPECT_EQ(longest_task, 0) << "a scan loop waited for the taps";
+}
+
+TEST_F(EncoderMapCoalesce, VelocityScaledTaps) {
+    TestDriver driver;
+    record_reports(driver);
+    coalesced_detents = 0;
+
+    // A burst of detents, all queued before the first tap is sent
+    constexpr uint16_t detents = 3;
+    for (uint16_t i = 0; i < detents; i++) {
+        encoder_queue_event(1, true);
+    }
+    spin(1, true, 0, 1, 200);
+
+    EXPECT_EQ(taps(), std::vector<uint8_t>{KC_D});
+    EXPECT_EQ(coalesced_detents, detents);
+}
+
+TEST_F(EncoderMapCoalesce, DirectionChangesAreNotCoalesced) {
+    TestDriver driver;
+    record_reports(driver);
+
+    encoder_queue_event(0, true);
+    encoder_queue_event(0, true);
+    encoder_queue_event(0, false);
+    spin(0, true, 0, 1, 200);
+
+    EXPECT_EQ(taps(), (std::vector<uint8_t>{KC_B, KC_B, KC_A}));
+    EXPECT_EQ(longest_task, 0);
+}
@@ -0,0 +1,63 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "encoder.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::Invoke;
+
+class EncoderMapFixture : public TestFixture {
+   protected:
+    struct Report {
+        uint32_t time;
+        uint8_t  key; // KC_NO once released
+    };
+
+    std::vector<Report> reports;
+    uint32_t            longest_task = 0;
+
+    void record_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([this](report_keyboard_t &report) { reports.push_back({timer_read32(), report.keys[0]}); }));
+    }
+
+    /* Runs the keyboard for `time` ms, queueing a detent every `every` ms until `detents` have been turned. */
+    void spin(uint8_t index, bool clockwise, uint16_t detents, uint16_t every, uint32_t time) {
+        for (uint32_t ms = 0; ms < time; ms++) {
+            if (detents && ms % every == 0) {
+                encoder_queue_event(index, clockwise);
+                detents--;
+            }
+            uint32_t start = timer_read32();
+            keyboard_task();
+            longest_task = std::max(longest_task, timer_read32() - start);
+            advance_time(1);
+        }
+    }
+
+    /* Checks that presses and releases alternate, ENCODER_MAP_KEY_DELAY apart, and returns the keys tapped. */
+    std::vector<uint8_t> taps(void) {
+        std::vector<uint8_t> keys;
+        for (size_t i = 0; i < reports.size(); i++) {
+            EXPECT_EQ(reports[i].key == KC_NO, i % 2 == 1) << "report " << i;
+            if (i > 0) {
+                EXPECT_GE(reports[i].time - reports[i - 1].time, ENCODER_MAP_KEY_DELAY) << "report " << i;
+            }
+            if (reports[i].key != KC_NO) {
+                keys.push_back(reports[i].key);
+            }
+        }
+        return keys;
+    }
+};
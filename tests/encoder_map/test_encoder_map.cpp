@@ -0,0 +1,46 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "encoder_map_fixture.hpp"
+
+class EncoderMap : public EncoderMapFixture {};
+
+TEST_F(EncoderMap, DetentIsTappedWithDelay) {
+    TestDriver driver;
+    record_reports(driver);
+
+    spin(0, true, 1, 1, 50);
+
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_EQ(reports[0].key, KC_B);
+    EXPECT_EQ(reports[1].key, KC_NO);
+    EXPECT_EQ(reports[1].time - reports[0].time, ENCODER_MAP_KEY_DELAY);
+    EXPECT_EQ(longest_task, 0);
+}
+
+TEST_F(EncoderMap, DirectionsAndEncodersKeepTheirOrder) {
+    TestDriver driver;
+    record_reports(driver);
+
+    encoder_queue_event(0, false);
+    encoder_queue_event(1, true);
+    encoder_queue_event(0, true);
+    spin(0, false, 0, 1, 100);
+
+    EXPECT_EQ(taps(), (std::vector<uint8_t>{KC_A, KC_D, KC_B}));
+    EXPECT_EQ(longest_task, 0);
+}
+
+TEST_F(EncoderMap, FastSpinDoesNotBlockScanning) {
+    TestDriver driver;
+    record_reports(driver);
+
+    // A detent every 2ms, much faster than the taps can be sent
+    constexpr uint16_t detents = 50;
+    spin(0, true, detents, 2, 1000);
+
+    auto keys = taps();
+    EXPECT_FALSE(keys.empty());
+    EXPECT_LE(keys.size(), detents);
+    EXPECT_EQ(longest_task, 0) << "a scan loop waited for the taps";
+}
@@ -0,0 +1,191 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+using testing::Invoke;
+
+class HostReportQueue : public TestFixture {
+   protected:
+    void SetUp() override {
+        host_report_queue_stats_reset();
+    }
+
+    static report_mouse_t mouse(uint8_t buttons, int8_t x, int8_t y) {
+        report_mouse_t report = {};
+        report.buttons        = buttons;
+        report.x              = x;
+        report.y              = y;
+        return report;
+    }
+};
+
+TEST_F(HostReportQueue, KeyReportsKeepTheirOrderAndDrainOnePerFrame) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    tap_code(KC_A);
+    tap_code(KC_B);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_KEYBOARD), 3);
+
+    // The rest of the queue waits for the next frame.
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_KEYBOARD), 0);
+    EXPECT_EQ(host_report_queue_stats(HOST_REPORT_KEYBOARD).sent, 4);
+    EXPECT_EQ(host_report_queue_stats(HOST_REPORT_KEYBOARD).max_depth, 3);
+}
+
+TEST_F(HostReportQueue, FullQueueSendsOldestReportImmediately) {
+    TestDriver driver;
+    InSequence s;
+
+    // One report goes out straight away and four fill the queue, the last
+    // one pushes the oldest queued report out early.
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_code(KC_A);
+    tap_code(KC_B);
+    tap_code(KC_C);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(host_report_queue_stats(HOST_REPORT_KEYBOARD).overflows, 1);
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_KEYBOARD), 4);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportQueue, DuplicateKeyReportIsDropped) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_code(KC_A);
+    report_keyboard_t empty = {};
+    host_keyboard_send(&empty);
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(host_report_queue_stats(HOST_REPORT_KEYBOARD).coalesced, 1);
+}
+
+TEST_F(HostReportQueue, MouseMotionIsMergedUntilButtonsChange) {
+    TestDriver                  driver;
+    std::vector<report_mouse_t> sent;
+    EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([&](report_mouse_t& report) { sent.push_back(report); }));
+
+    report_mouse_t report;
+    report = mouse(0, 1, 0);
+    host_mouse_send(&report);
+    report = mouse(0, 2, -1);
+    host_mouse_send(&report);
+    report = mouse(0, 3, -2);
+    host_mouse_send(&report);
+    report = mouse(1, 0, 0);
+    host_mouse_send(&report);
+    report = mouse(1, 100, 0);
+    host_mouse_send(&report);
+    report = mouse(1, 100, 0);
+    host_mouse_send(&report);
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(sent.size(), 4);
+    EXPECT_EQ(sent[0].buttons, 0);
+    EXPECT_EQ(sent[0].x, 1);
+    EXPECT_EQ(sent[1].buttons, 0);
+    EXPECT_EQ(sent[1].x, 5);
+    EXPECT_EQ(sent[1].y, -3);
+    // The button press is merged with the motion after it, but the sum of
+    // the last two would not fit in a report.
+    EXPECT_EQ(sent[2].buttons, 1);
+    EXPECT_EQ(sent[2].x, 100);
+    EXPECT_EQ(sent[3].buttons, 1);
+    EXPECT_EQ(sent[3].x, 100);
+    EXPECT_EQ(host_report_queue_stats(HOST_REPORT_MOUSE).coalesced, 2);
+}
+
+TEST_F(HostReportQueue, ConsumerTapsAreNotMerged) {
+    TestDriver                  driver;
+    std::vector<report_extra_t> sent;
+    EXPECT_CALL(driver, send_extra_mock(_)).WillRepeatedly(Invoke([&](report_extra_t& report) { sent.push_back(report); }));
+
+    host_consumer_send(AUDIO_VOL_UP);
+    host_consumer_send(0);
+    host_consumer_send(AUDIO_VOL_UP);
+    host_consumer_send(0);
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_EXTRA), 3);
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(sent.size(), 4);
+    EXPECT_EQ(sent[0].usage, AUDIO_VOL_UP);
+    EXPECT_EQ(sent[1].usage, 0);
+    EXPECT_EQ(sent[2].usage, AUDIO_VOL_UP);
+    EXPECT_EQ(sent[3].usage, 0);
+}
+
+TEST_F(HostReportQueue, FlushSendsEverything) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_code(KC_A);
+    host_report_queue_flush();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_KEYBOARD), 0);
+}
+
+TEST_F(HostReportQueue, ReportsKeepTheirOrderAcrossEndpoints) {
+    TestDriver driver;
+    InSequence s;
+
+    // The mouse endpoint is free, but the click has to wait behind the
+    // queued key release.
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    register_code(KC_LEFT_SHIFT);
+    unregister_code(KC_LEFT_SHIFT);
+    report_mouse_t report = mouse(1, 0, 0);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_MOUSE), 1);
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_CALL(driver, send_mouse_mock(_));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(host_report_queue_depth(HOST_REPORT_MOUSE), 0);
+}
@@ -0,0 +1,126 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookupCache : public TestFixture {};
+
+TEST_F(LayerLookupCache, ResolvesThroughTransparentLayers) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(2, 0, 0, KC_B);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_TRNS), key_b});
+    layer_lookup_cache_invalidate();
+
+    layer_on(1);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Turning on a higher layer has to drop the entry resolved to layer 0 */
+    layer_on(2);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Toggling a layer below the resolved one keeps the entry */
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 2);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_off(2);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, FollowsDefaultLayerChanges) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 1, 1, KC_A);
+    auto       key_b = KeymapKey(3, 1, 1, KC_B);
+
+    set_keymap({key_a, key_b});
+    layer_lookup_cache_invalidate();
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    default_layer_set((layer_state_t)1 << 3);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 3);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    default_layer_set((layer_state_t)1 << 0);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, InvalidateKey) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 2, KC_A);
+
+    set_keymap({key_a, KeymapKey(1, 2, 2, KC_TRNS)});
+    layer_lookup_cache_invalidate();
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    /* Simulate a keymap edit of layer 1 at the same position */
+    set_keymap({key_a, KeymapKey(1, 2, 2, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    layer_lookup_cache_invalidate_key(key_a.position);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_off(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+class LayerLookupCacheLayers : public LayerLookupCache, public testing::WithParamInterface<uint8_t> {};
+
+/* Worst case for the top-down scan: every active layer above 0 is transparent. */
+TEST_P(LayerLookupCacheLayers, ResolvesThroughTransparentStack) {
+    TestDriver    driver;
+    const uint8_t layers = GetParam();
+
+    keymap.clear();
+    for (uint8_t layer = 0; layer < layers; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(layer, col, row, layer == 0 ? KC_A : KC_TRNS));
+            }
+        }
+    }
+    layer_lookup_cache_invalidate();
+    layer_state_set((layer_state_t)((1ULL << layers) - 1));
+
+    for (bool cached : {false, true}) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keypos_t key = {.col = col, .row = row};
+                if (!cached) {
+                    layer_lookup_cache_invalidate_key(key);
+                }
+                EXPECT_EQ(layer_switch_get_layer(key), 0);
+            }
+        }
+    }
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
+
+INSTANTIATE_TEST_CASE_P(Layers, LayerLookupCacheLayers, testing::Values(8, 16, 32));
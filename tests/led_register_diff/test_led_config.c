@@ -0,0 +1,38 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+#define LED_X(col) ((col)*224 / (MATRIX_COLS - 1))
+#define LED_Y(row) ((row)*64 / (MATRIX_ROWS - 1))
+
+// clang-format off
+#define LED_ROW(row) \
+    {LED_X(0), LED_Y(row)}, {LED_X(1), LED_Y(row)}, {LED_X(2), LED_Y(row)}, {LED_X(3), LED_Y(row)}, {LED_X(4), LED_Y(row)}, \
+    {LED_X(5), LED_Y(row)}, {LED_X(6), LED_Y(row)}, {LED_X(7), LED_Y(row)}, {LED_X(8), LED_Y(row)}, {LED_X(9), LED_Y(row)}
+
+led_config_t g_led_config = {
+    {
+        { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9},
+        {10, 11, 12, 13, 14, 15, 16, 17, 18, 19},
+        {20, 21, 22, 23, 24, 25, 26, 27, 28, 29},
+        {30, 31, 32, 33, 34, 35, 36, 37, 38, 39}
+    }, {
+        LED_ROW(0), LED_ROW(1), LED_ROW(2), LED_ROW(3)
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+    }
+};
+
+// One row of keys per three SW lines, the usual wiring for RGB keys
+#define LED(row, col) {0, SW1_CS1 + (row)*0x30 + (col), SW2_CS1 + (row)*0x30 + (col), SW3_CS1 + (row)*0x30 + (col)}
+#define LED_DRIVER_ROW(row) \
+    LED(row, 0), LED(row, 1), LED(row, 2), LED(row, 3), LED(row, 4), LED(row, 5), LED(row, 6), LED(row, 7), LED(row, 8), LED(row, 9)
+
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    LED_DRIVER_ROW(0), LED_DRIVER_ROW(1), LED_DRIVER_ROW(2), LED_DRIVER_ROW(3)
+};
+// clang-format on
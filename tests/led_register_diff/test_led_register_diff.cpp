@@ -0,0 +1,207 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "is31fl3733.h"
+#include "i2c_master.h"
+#include "led/register_diff.h"
+
+void advance_time(uint32_t ms);
+}
+
+namespace {
+
+constexpr uint8_t  address          = IS31FL3733_I2C_ADDRESS_1;
+constexpr uint16_t pwm_registers    = 192;
+constexpr uint32_t page_select_cost = 2 * (2 + 1);
+// What a flush cost before: 12 transfers of 16 PWM registers
+constexpr uint32_t full_flush_cost = page_select_cost + 12 * (2 + 16);
+
+std::vector<register_diff_span_t> spans(uint8_t *dirty, uint16_t count, uint16_t max_length) {
+    std::vector<register_diff_span_t> found;
+    register_diff_span_t              span = {0};
+    while (register_diff_next_span(dirty, count, max_length, &span)) {
+        found.push_back(span);
+        register_diff_clear_span(dirty, &span);
+    }
+    return found;
+}
+
+std::vector<register_diff_span_t> spans_of(std::initializer_list<uint16_t> regs, uint16_t count = 192, uint16_t max_length = 16) {
+    std::vector<uint8_t> dirty(REGISTER_DIFF_SIZE(count));
+    for (uint16_t reg : regs) {
+        register_diff_mark(dirty.data(), reg);
+    }
+    auto found = spans(dirty.data(), count, max_length);
+    for (uint8_t bits : dirty) {
+        EXPECT_EQ(bits, 0) << "dirty bits left after the last span";
+    }
+    return found;
+}
+
+MATCHER_P2(Span, start, length, "") {
+    return arg.start == start && arg.length == length;
+}
+
+} // namespace
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+TEST(RegisterDiffSpans, NothingDirty) {
+    EXPECT_THAT(spans_of({}), IsEmpty());
+}
+
+TEST(RegisterDiffSpans, SmallGapsAreMerged) {
+    EXPECT_THAT(spans_of({5}), ElementsAre(Span(5, 1)));
+    EXPECT_THAT(spans_of({5, 6, 7}), ElementsAre(Span(5, 3)));
+    EXPECT_THAT(spans_of({5, 8}), ElementsAre(Span(5, 4)));
+    EXPECT_THAT(spans_of({5, 9}), ElementsAre(Span(5, 1), Span(9, 1)));
+    EXPECT_THAT(spans_of({0, 16, 32, 33, 35}), ElementsAre(Span(0, 1), Span(16, 1), Span(32, 4)));
+}
+
+TEST(RegisterDiffSpans, SpansAreLimitedInLength) {
+    EXPECT_THAT(spans_of({0, 1, 2, 3, 4, 5, 6}, 192, 4), ElementsAre(Span(0, 4), Span(4, 3)));
+    EXPECT_THAT(spans_of({0, 3, 6}, 192, 4), ElementsAre(Span(0, 4), Span(6, 1)));
+}
+
+TEST(RegisterDiffSpans, LastRegister) {
+    EXPECT_THAT(spans_of({142}, 143, 13), ElementsAre(Span(142, 1)));
+    EXPECT_THAT(spans_of({139, 142}, 143, 13), ElementsAre(Span(139, 4)));
+
+    // Marking everything sends the whole buffer, however many bits the last byte has spare
+    std::vector<uint8_t> dirty(REGISTER_DIFF_SIZE(171));
+    register_diff_mark_all(dirty.data(), 171);
+    auto found = spans(dirty.data(), 171, 19);
+    ASSERT_EQ(found.size(), 9);
+    EXPECT_THAT(found.back(), Span(152, 19));
+}
+
+class LedRegisterDiff : public testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(HSV_PURPLE);
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        i2c_mock_reset();
+    }
+
+    /* Runs the sync, start, render and flush steps of a single frame. */
+    void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (uint8_t step = 0; step < 4; step++) {
+            rgb_matrix_task();
+        }
+    }
+
+    /* Checks that the frames that sent anything sent less than the full buffer on average. */
+    void expect_less_than_full_flush(const char *name, uint8_t mode, uint16_t frames, uint16_t hit_every = 0) {
+        rgb_matrix_mode_noeeprom(mode);
+        render_frame();
+        i2c_mock_reset();
+
+        uint32_t flushes = 0;
+        for (uint16_t frame = 0; frame < frames; frame++) {
+            if (hit_every && frame % hit_every == 0) {
+                uint8_t led = (frame / hit_every * 7) % RGB_MATRIX_LED_COUNT;
+                rgb_matrix_handle_key_event(led / MATRIX_COLS, led % MATRIX_COLS, true);
+                rgb_matrix_handle_key_event(led / MATRIX_COLS, led % MATRIX_COLS, false);
+            }
+            uint32_t before = i2c_mock_stats.bytes;
+            render_frame();
+            flushes += i2c_mock_stats.bytes != before;
+        }
+
+        ASSERT_GT(flushes, 0) << name;
+        uint32_t bytes = i2c_mock_stats.bytes / flushes;
+        EXPECT_LT(bytes, full_flush_cost) << name;
+    }
+};
+
+TEST_F(LedRegisterDiff, UnchangedColorsSendNothing) {
+    is31fl3733_set_color_all(0, 0, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_mock_stats.transfers, 0);
+
+    is31fl3733_set_color(12, 1, 2, 3);
+    is31fl3733_flush();
+    // Selecting the page, then one transfer per channel, as their registers are 16 apart
+    EXPECT_EQ(i2c_mock_stats.transfers, 2 + 3);
+    EXPECT_EQ(i2c_mock_stats.bytes, page_select_cost + 3 * (2 + 1));
+
+    i2c_mock_reset();
+    is31fl3733_set_color(12, 1, 2, 3);
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_mock_stats.transfers, 0);
+}
+
+TEST_F(LedRegisterDiff, FailedTransfersAreRetried) {
+    is31fl3733_led_t led = g_is31fl3733_leds[12];
+    is31fl3733_set_color(12, 1, 2, 3);
+    i2c_mock_failing_writes = UINT16_MAX;
+    is31fl3733_flush();
+    i2c_mock_failing_writes = 0;
+    EXPECT_EQ(i2c_mock_registers[address][led.r], 0);
+
+    // Nothing changed since, but the registers that failed are sent again
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_mock_registers[address][led.r], 1);
+    EXPECT_EQ(i2c_mock_registers[address][led.g], 2);
+    EXPECT_EQ(i2c_mock_registers[address][led.b], 3);
+
+    i2c_mock_reset();
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_mock_stats.transfers, 0);
+}
+
+TEST_F(LedRegisterDiff, ReinitSendsWholeBuffer) {
+    is31fl3733_led_t led = g_is31fl3733_leds[12];
+    is31fl3733_set_color(12, 1, 2, 3);
+    is31fl3733_flush();
+
+    // Reinitialising clears the PWM registers of the chip, but not the buffer
+    is31fl3733_init(0);
+    EXPECT_EQ(i2c_mock_registers[address][led.r], 0);
+
+    i2c_mock_reset();
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_mock_stats.bytes, full_flush_cost);
+    EXPECT_EQ(i2c_mock_registers[address][led.r], 1);
+    EXPECT_EQ(i2c_mock_registers[address][led.g], 2);
+    EXPECT_EQ(i2c_mock_registers[address][led.b], 3);
+}
+
+TEST_F(LedRegisterDiff, RegistersMatchAfterRandomUpdates) {
+    std::mt19937 rng(1234);
+    uint8_t      expected[pwm_registers] = {0};
+
+    for (int round = 0; round < 200; round++) {
+        int changes = 1 + rng() % 12;
+        for (int n = 0; n < changes; n++) {
+            int     led = rng() % RGB_MATRIX_LED_COUNT;
+            uint8_t r = rng() % 4 ? rng() : 0, g = rng() % 4 ? rng() : 0, b = rng() % 4 ? rng() : 0;
+            is31fl3733_set_color(led, r, g, b);
+            expected[g_is31fl3733_leds[led].r] = r;
+            expected[g_is31fl3733_leds[led].g] = g;
+            expected[g_is31fl3733_leds[led].b] = b;
+        }
+        is31fl3733_flush();
+        ASSERT_EQ(memcmp(i2c_mock_registers[address], expected, pwm_registers), 0) << "after round " << round;
+    }
+    EXPECT_LT(i2c_mock_stats.bytes, 200 * full_flush_cost / 4);
+}
+
+TEST_F(LedRegisterDiff, EffectsSendLessThanFullBuffer) {
+    expect_less_than_full_flush("breathing", RGB_MATRIX_BREATHING, 200);
+    expect_less_than_full_flush("cycle left right", RGB_MATRIX_CYCLE_LEFT_RIGHT, 200);
+    expect_less_than_full_flush("solid reactive simple", RGB_MATRIX_SOLID_REACTIVE_SIMPLE, 200, 20);
+}
@@ -0,0 +1,139 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+class MatrixScanRate : public TestFixture {};
+
+TEST_F(MatrixScanRate, ChangedRowsAreProcessed) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 5, 3, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing changed, so nothing may be processed */
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScanRate, ScanPeriod) {
+    TestDriver          driver;
+    matrix_scan_stats_t stats;
+
+    /* Settle on a full measurement window of one scan per millisecond */
+    idle_for(2500);
+    get_matrix_scan_stats(&stats);
+    EXPECT_EQ(stats.scan_rate, 1000);
+    EXPECT_EQ(get_matrix_scan_rate(), 1000);
+    EXPECT_EQ(stats.period_avg_us, 1000);
+    EXPECT_EQ(stats.period_min, 1);
+    EXPECT_EQ(stats.period_max, 1);
+
+    /* A stalled main loop shows up as the longest period of the next window */
+    advance_time(20);
+    idle_for(1000);
+    get_matrix_scan_stats(&stats);
+    EXPECT_EQ(stats.period_min, 1);
+    EXPECT_EQ(stats.period_max, 21);
+    EXPECT_LT(stats.scan_rate, 1000);
+    EXPECT_GT(stats.period_avg_us, 1000);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScanRate, KeyChangeLatency) {
+    TestDriver          driver;
+    InSequence          s;
+    matrix_scan_stats_t stats;
+    auto                key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+    clear_matrix_scan_latency();
+
+    /* Key change seen 5ms before the next scan */
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    advance_time(5);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Key change seen right before the next scan */
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    get_matrix_scan_stats(&stats);
+    EXPECT_EQ(stats.latency_count, 2);
+    EXPECT_EQ(stats.latency_min, 0);
+    EXPECT_EQ(stats.latency_max, 5);
+    EXPECT_EQ(stats.latency_avg, 2);
+    EXPECT_EQ(stats.latency_histogram[0], 1);
+    EXPECT_EQ(stats.latency_histogram[3], 1);
+
+    clear_matrix_scan_latency();
+    get_matrix_scan_stats(&stats);
+    EXPECT_EQ(stats.latency_count, 0);
+    EXPECT_EQ(stats.latency_histogram[3], 0);
+}
+
+TEST_F(MatrixScanRate, FilteredGlitchIsNotCounted) {
+    TestDriver          driver;
+    InSequence          s;
+    matrix_scan_stats_t stats;
+    auto                key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+    clear_matrix_scan_latency();
+
+    /* A raw change that debouncing filters out, leaving the matrix as it was */
+    EXPECT_NO_REPORT(driver);
+    matrix_scan_perf_raw_change();
+    run_one_scan_loop();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The next key change is measured from its own raw change, not from the glitch */
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    get_matrix_scan_stats(&stats);
+    EXPECT_EQ(stats.latency_count, 1);
+    EXPECT_EQ(stats.latency_max, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
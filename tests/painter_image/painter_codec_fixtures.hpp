@@ -0,0 +1,586 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Test data encoded by compress_bytes_qmk_rle() and compress_bytes_qmk_lz() in lib/python/qmk/painter.py, so that the
+// decoders are checked against the encoders that actually produce QGF and QFF files. lib/python/qmk/tests/test_qmk_painter.py
+// checks that the encoders still produce exactly these bytes, regenerate this file if they change on purpose.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Noise and repetition at every distance the LZ window allows, and beyond
+const std::vector<uint8_t> fixture_mixed_raw = {
+    0x0A, 0x05, 0x03, 0x00, 0x0F, 0x10, 0x0F, 0x02, 0x09, 0x0A, 0x06, 0x0F, 0x01, 0x0F, 0x06, 0x14,
+    0x0D, 0x08, 0x0B, 0x13, 0x00, 0x0F, 0x01, 0x00, 0x06, 0x04, 0x09, 0x10, 0x0C, 0x14, 0x04, 0x0A,
+    0x0E, 0x0F, 0x03, 0x0E, 0x14, 0x05, 0x01, 0x02, 0x0A, 0x0C, 0x0A, 0x00, 0x11, 0x0B, 0x0A, 0x08,
+    0x0A, 0x0C, 0x0E, 0x0D, 0x01, 0x03, 0x00, 0x01, 0x07, 0x08, 0x04, 0x05, 0x11, 0x0A, 0x0F, 0x14,
+    0x08, 0x00, 0x03, 0x0F, 0x00, 0x03, 0x11, 0x13, 0x0C, 0x09, 0x0D, 0x0D, 0x0A, 0x14, 0x0D, 0x11,
+    0x14, 0x07, 0x11, 0x07, 0x13, 0x10, 0x13, 0x08, 0x12, 0x13, 0x13, 0x11, 0x04, 0x0A, 0x12, 0x0D,
+    0x05, 0x14, 0x08, 0x07, 0x0F, 0x13, 0x01, 0x0B, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x00, 0x01,
+    0x04, 0x00, 0x05, 0x07, 0x06, 0x01, 0x07, 0x03, 0x02, 0x06, 0x02, 0x01, 0x06, 0x03, 0x01, 0x04,
+    0x04, 0x04, 0x01, 0x01, 0x01, 0x05, 0x06, 0x04, 0x00, 0x01, 0x04, 0x01, 0x07, 0x05, 0x06, 0x03,
+    0x00, 0x05, 0x01, 0x07, 0x00, 0x04, 0x01, 0x01, 0x03, 0x07, 0x01, 0x05, 0x04, 0x02, 0x06, 0x06,
+    0x00, 0x01, 0x05, 0x01, 0x03, 0x07, 0x07, 0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x04, 0x03, 0x05,
+    0x04, 0x01, 0x04, 0x07, 0x02, 0x07, 0x02, 0x07, 0x03, 0x00, 0x01, 0x00, 0x02, 0x01, 0x04, 0x00,
+    0x05, 0x06, 0x00, 0x01, 0x05, 0x02, 0x01, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x03, 0x01, 0x07,
+    0x01, 0x06, 0x00, 0x07, 0x05, 0x02, 0x03, 0x05, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x01, 0x02,
+    0x01, 0x03, 0x03, 0x01, 0x00, 0x05, 0x02, 0x06, 0x02, 0x02, 0x06, 0x22, 0x25, 0x19, 0x38, 0x23,
+    0x18, 0x0F, 0x0B, 0x23, 0x2F, 0x27, 0x1B, 0x23, 0x13, 0x34, 0x21, 0x27, 0x2B, 0x15, 0x25, 0x33,
+    0x17, 0x2F, 0x0B, 0x25, 0x16, 0x27, 0x32, 0x0A, 0x35, 0x10, 0x32, 0x2C, 0x00, 0x31, 0x0E, 0x03,
+    0x1C, 0x03, 0x15, 0x20, 0x33, 0x21, 0x0C, 0x04, 0x16, 0x19, 0x23, 0x34, 0x34, 0x1F, 0x10, 0x19,
+    0x0F, 0x34, 0x0B, 0x12, 0x2D, 0x06, 0x1D, 0x04, 0x36, 0x18, 0x1F, 0x0D, 0x19, 0x38, 0x0A, 0x05,
+    0x2B, 0x33, 0x10, 0x17, 0x1E, 0x13, 0x14, 0x19, 0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31,
+    0x1B, 0x13, 0x19, 0x01, 0x2A, 0x05, 0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16,
+    0x0C, 0x2A, 0x03, 0x0C, 0x02, 0x2C, 0x18, 0x04, 0x22, 0x02, 0x02, 0x15, 0x30, 0x01, 0x14, 0x05,
+    0x05, 0x0C, 0x1A, 0x16, 0x0C, 0x0D, 0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x18, 0x18, 0x11,
+    0x08, 0x1A, 0x18, 0x01, 0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01,
+    0x04, 0x0F, 0x04, 0x0F, 0x0D, 0x0B, 0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B,
+    0x01, 0x6D, 0x1E, 0x13, 0x14, 0x19, 0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31, 0x1B, 0x13,
+    0x19, 0x01, 0x2A, 0x05, 0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A,
+    0x03, 0x0C, 0x02, 0x2C, 0x18, 0x04, 0x22, 0x02, 0x02, 0x15, 0x30, 0x01, 0x14, 0x05, 0x05, 0x0C,
+    0x1A, 0x16, 0x0C, 0x0D, 0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x18, 0x18, 0x11, 0x08, 0x1A,
+    0x18, 0x01, 0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F,
+    0x04, 0x0F, 0x0D, 0x0B, 0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B, 0x01, 0x6D,
+    0x1E, 0x13, 0x14, 0x19, 0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31, 0x1B, 0x13, 0x19, 0x01,
+    0x2A, 0x05, 0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03, 0x0C,
+    0x02, 0x2C, 0x18, 0x04, 0x22, 0x02, 0x02, 0x15, 0x30, 0x01, 0x14, 0x05, 0x05, 0x0C, 0x1A, 0x16,
+    0x0C, 0x0D, 0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x18, 0x18, 0x11, 0x08, 0x1A, 0x18, 0x01,
+    0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F, 0x04, 0x05,
+    0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03, 0x0C, 0x02, 0x2C,
+    0x18, 0x04, 0x22, 0x02, 0x02, 0x15, 0x30, 0x01, 0x14, 0x05, 0x05, 0x0C, 0x1A, 0x16, 0x0C, 0x0D,
+    0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x18, 0x18, 0x11, 0x08, 0x1A, 0x18, 0x01, 0x05, 0x15,
+    0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F, 0x04, 0x0F, 0x0D, 0x0B,
+    0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B, 0x01, 0x6D, 0x1E, 0x13, 0x14, 0x19,
+    0x0D, 0x0E, 0x06, 0x02, 0x09, 0x0C, 0x01, 0x06, 0x03, 0x08, 0x03, 0x06, 0x0C, 0x0F, 0x08, 0x0F,
+    0x0E, 0x0D, 0x0E, 0x0D, 0x06, 0x0E, 0x0F, 0x0C, 0x0F, 0x0D, 0x08, 0x07, 0x07, 0x08, 0x05, 0x0B,
+    0x08, 0x08, 0x01, 0x04, 0x0F, 0x0C, 0x0A, 0x0D, 0x07, 0x0F, 0x04, 0x71, 0x63, 0x5E, 0xC4, 0x55,
+    0x0A, 0xA0, 0xD2, 0x78, 0x8F, 0x9F, 0x44, 0xEB, 0x40, 0x29, 0x80, 0xEA, 0xB6, 0x58, 0x97, 0x74,
+    0x8D, 0xC1, 0x55, 0x6E, 0x5D, 0x43, 0x85, 0x24, 0x2D, 0xAC, 0xAC, 0x02, 0x26, 0x66, 0x66, 0x8C,
+    0xC8, 0x8E, 0x2F, 0xDD, 0xBE, 0xC7, 0x3E, 0x36, 0xEE, 0x5E, 0x14, 0xB3, 0xCE, 0x60, 0x39, 0x3B,
+    0x72, 0x4E, 0x75, 0x93, 0x28, 0x5B, 0xCB, 0x7B, 0x9E, 0x41, 0xB8, 0xD7, 0x71, 0x5A, 0xB4, 0xB7,
+    0xDD, 0x37, 0x1B, 0xA2, 0x32, 0x9F, 0xC5, 0x79, 0x6F, 0x90, 0x0D, 0x83, 0xDD, 0x23, 0xAC, 0xE6,
+    0x20, 0x10, 0x35, 0x44, 0x2F, 0xC7, 0xA2, 0xAA, 0x1C, 0x93, 0x81, 0x70, 0x25, 0xED, 0x8B, 0x6D,
+    0x03, 0xC5, 0x77, 0xA3, 0x71, 0xA3, 0x9F, 0xF0, 0xA8, 0x3A, 0x01, 0x70, 0x80, 0xE3, 0x96, 0x91,
+    0x39, 0xE2, 0x66, 0x39, 0x97, 0xB7, 0x60, 0xED, 0xB9, 0x15, 0x41, 0x81, 0x8C, 0x8D, 0xDD, 0xEC,
+    0xD0, 0x47, 0x28, 0x23, 0x50, 0xC7, 0x15, 0x92, 0x6A, 0x14, 0x75, 0xDD, 0x5C, 0x18, 0x04, 0x19,
+    0x01, 0x32, 0x2C, 0x29, 0x01, 0x3B, 0x18, 0x05, 0x28, 0x0C, 0x22, 0x31, 0x31, 0x16, 0x05, 0x2D,
+    0x1B, 0x1C, 0x11, 0x2E, 0x08, 0x0A, 0x16, 0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38, 0x17, 0x28, 0x23,
+    0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06, 0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13,
+    0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x1A, 0x0D, 0x2D, 0x25, 0x39, 0x20, 0x10, 0x28, 0x12, 0x2B,
+    0x25, 0x3A, 0x00, 0x12, 0x32, 0x11, 0x2E, 0x08, 0x0A, 0x16, 0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38,
+    0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06, 0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22,
+    0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x1A, 0x0D, 0x2D, 0x25, 0x39, 0x20, 0x10,
+    0x28, 0x12, 0x2B, 0x25, 0x3A, 0x00, 0x12, 0x32, 0x11, 0x2E, 0x08, 0x0A, 0x16, 0x27, 0x3A, 0x14,
+    0x23, 0x0F, 0x38, 0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06, 0x01, 0x36, 0x1A,
+    0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x1A, 0x0D, 0x2D, 0x25,
+    0x39, 0x20, 0x10, 0x28, 0x12, 0x2B, 0x25, 0x3A, 0x00, 0x12, 0x32, 0x11, 0x2E, 0x08, 0x0A, 0x16,
+    0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38, 0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06,
+    0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x5D,
+    0x70, 0x1F, 0x42, 0x27, 0x71, 0x3E, 0x69, 0x23, 0x61, 0x7A, 0x5A, 0x42, 0x00, 0x35, 0x53, 0x1D,
+    0x1C, 0x5B, 0x25, 0x06, 0x7C, 0x1B, 0x4D, 0x17, 0x33, 0x4A, 0x02, 0x43, 0x35, 0x10, 0x4F, 0x0C,
+    0x28, 0x23, 0x62, 0x10, 0x29, 0x16, 0x6B, 0x75, 0x2D, 0x1B, 0x2A, 0x6B, 0x7A, 0x71, 0x05, 0x68,
+    0x3F, 0x23, 0x3E, 0x78, 0x12, 0x4F, 0x2B, 0x6B, 0x66, 0x4A, 0x2F, 0x51, 0x10, 0x64, 0x1F, 0x6B,
+    0x59, 0x0A, 0x4B, 0x1C, 0x10, 0x4D, 0x6C, 0x3B, 0x0A, 0x68, 0x50, 0x23, 0x1E, 0x2E, 0x60, 0x36,
+    0x67, 0x60, 0x05, 0x68, 0x08, 0x18, 0x2E, 0x76, 0x7C, 0x0A, 0x77, 0x79, 0x5E, 0x1E, 0x52, 0x61,
+    0x7B, 0x0D, 0x67, 0x60, 0x56, 0x67, 0x00, 0x26, 0x3A, 0x0B, 0x15, 0x19, 0x27, 0x0E, 0x04, 0x4D,
+    0x63, 0x4D, 0x72, 0x3A, 0x2A, 0x71, 0x7C, 0x7A, 0x49, 0x7C, 0x0C, 0x64, 0x3A, 0x63, 0x3F, 0x0F,
+    0x5E, 0x00, 0x67, 0x3D, 0x76, 0x62, 0x5C, 0x73, 0x6F, 0x47, 0x74, 0x64, 0x46, 0x61, 0x2F, 0x71,
+    0x06, 0x30, 0x58, 0x51, 0x79, 0x1D, 0x27, 0x3A, 0x31, 0x2A, 0x15, 0x0C, 0x19, 0x1F, 0x03, 0x3F,
+    0x37, 0x03, 0x11, 0x09, 0x06, 0x37, 0x20, 0x1F, 0x00, 0x14, 0x18, 0x3A, 0x36, 0x30, 0x26, 0x01,
+    0x34, 0x1E, 0x2B, 0x10, 0x13, 0x2A, 0x1D, 0x13, 0x21, 0x1C, 0x29, 0x27, 0x26, 0x05, 0x06, 0x16,
+    0x0F, 0x18, 0x20, 0x33, 0x2E, 0x07, 0x33, 0x13, 0x40, 0x2D, 0x2F, 0x31, 0x20, 0x2B, 0x17, 0x09,
+    0x14, 0x20, 0x29, 0x21, 0x32, 0x11, 0x32, 0x2B, 0x00, 0x2E, 0x1A, 0x1B, 0x15, 0x3F, 0x00, 0x17,
+    0x3C, 0x0C, 0x33, 0x34, 0x30, 0x32, 0x2E, 0x1A, 0x0E, 0x40, 0x3B, 0x16, 0x00, 0x02, 0x16, 0x11,
+    0x3D, 0x25, 0x38, 0x32, 0x3E, 0x07, 0x35, 0x35, 0x0E, 0x08, 0x34, 0x21, 0x20, 0x39, 0x11, 0x01,
+    0x27, 0x23, 0x0C, 0x36, 0x0B, 0x00, 0x3C, 0x2B, 0x37, 0x11, 0x14, 0x0F, 0x03, 0x07, 0x3D, 0x0E,
+    0x13, 0x39, 0x38, 0x0C, 0x39, 0x28, 0x39, 0x2B, 0x1E, 0x0A, 0x03, 0x2B, 0x05, 0x02, 0x0A, 0x3F,
+    0x37, 0x31, 0x29, 0x1E, 0x25, 0x40, 0x32, 0x05, 0x34, 0x36, 0x38, 0x1A, 0x3A, 0x08, 0x2E, 0x3F,
+    0x19, 0x38, 0x06, 0x10, 0x28, 0x0D, 0x18, 0x33, 0x34, 0x21, 0x2F, 0x23, 0x27, 0x0D, 0x08, 0x22,
+    0x25, 0x3C, 0x25, 0x2A, 0x03, 0x3C, 0x35, 0x33, 0x18, 0x13, 0x3C, 0x2E, 0x17, 0x17, 0x1F, 0x08,
+    0x40, 0x11, 0x1C, 0x37, 0x37, 0x18, 0x1F, 0x18, 0x0E, 0x09, 0x3C, 0x0B, 0x2C, 0x1C, 0x07, 0x0D,
+    0x13, 0x30, 0x0F, 0x07, 0x10, 0x0E, 0x07, 0x1E, 0x3E, 0x21, 0x2F, 0x31, 0x09, 0x3B, 0x13, 0x0C,
+    0x13, 0x11, 0x1A, 0x12, 0x35, 0x15, 0x2C, 0x0C, 0x21, 0x2E, 0x19, 0x32, 0x28, 0x0C, 0x22, 0x24,
+    0x16, 0x12, 0x36, 0x15, 0x07, 0x30, 0x01, 0x1D, 0x31, 0x18, 0x18, 0x15, 0x27, 0x26, 0x05, 0x10,
+    0x07, 0x04, 0x22, 0x0E, 0x06, 0x33, 0x21, 0x0A, 0x0B, 0x10, 0x0D, 0x34, 0x3A, 0x3A, 0x29, 0x3B,
+    0x0F, 0x2B, 0x1A, 0x3C, 0x28, 0x13, 0x14, 0x31, 0x05, 0x21, 0x26, 0x24, 0x29, 0x23, 0x18, 0x34,
+    0x32, 0x0F, 0x13, 0x12, 0x36, 0x11, 0x28, 0x05, 0x0F, 0x22, 0x14, 0x3D,
+};
+const std::vector<uint8_t> fixture_mixed_rle = {
+    0xC9, 0x0A, 0x05, 0x03, 0x00, 0x0F, 0x10, 0x0F, 0x02, 0x09, 0x0A, 0x06, 0x0F, 0x01, 0x0F, 0x06,
+    0x14, 0x0D, 0x08, 0x0B, 0x13, 0x00, 0x0F, 0x01, 0x00, 0x06, 0x04, 0x09, 0x10, 0x0C, 0x14, 0x04,
+    0x0A, 0x0E, 0x0F, 0x03, 0x0E, 0x14, 0x05, 0x01, 0x02, 0x0A, 0x0C, 0x0A, 0x00, 0x11, 0x0B, 0x0A,
+    0x08, 0x0A, 0x0C, 0x0E, 0x0D, 0x01, 0x03, 0x00, 0x01, 0x07, 0x08, 0x04, 0x05, 0x11, 0x0A, 0x0F,
+    0x14, 0x08, 0x00, 0x03, 0x0F, 0x00, 0x03, 0x11, 0x13, 0x0C, 0x09, 0x02, 0x0D, 0x8C, 0x0A, 0x14,
+    0x0D, 0x11, 0x14, 0x07, 0x11, 0x07, 0x13, 0x10, 0x13, 0x08, 0x12, 0x02, 0x13, 0xA3, 0x11, 0x04,
+    0x0A, 0x12, 0x0D, 0x05, 0x14, 0x08, 0x07, 0x0F, 0x13, 0x01, 0x0B, 0x02, 0x03, 0x04, 0x05, 0x00,
+    0x06, 0x00, 0x01, 0x04, 0x00, 0x05, 0x07, 0x06, 0x01, 0x07, 0x03, 0x02, 0x06, 0x02, 0x01, 0x06,
+    0x03, 0x01, 0x03, 0x04, 0x03, 0x01, 0x90, 0x05, 0x06, 0x04, 0x00, 0x01, 0x04, 0x01, 0x07, 0x05,
+    0x06, 0x03, 0x00, 0x05, 0x01, 0x07, 0x00, 0x04, 0x02, 0x01, 0x85, 0x03, 0x07, 0x01, 0x05, 0x04,
+    0x02, 0x02, 0x06, 0x84, 0x00, 0x01, 0x05, 0x01, 0x03, 0x02, 0x07, 0xB9, 0x02, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x04, 0x03, 0x05, 0x04, 0x01, 0x04, 0x07, 0x02, 0x07, 0x02, 0x07, 0x03, 0x00, 0x01,
+    0x00, 0x02, 0x01, 0x04, 0x00, 0x05, 0x06, 0x00, 0x01, 0x05, 0x02, 0x01, 0x00, 0x01, 0x03, 0x02,
+    0x00, 0x04, 0x03, 0x01, 0x07, 0x01, 0x06, 0x00, 0x07, 0x05, 0x02, 0x03, 0x05, 0x03, 0x01, 0x00,
+    0x04, 0x01, 0x00, 0x01, 0x02, 0x01, 0x02, 0x03, 0x84, 0x01, 0x00, 0x05, 0x02, 0x06, 0x02, 0x02,
+    0xB0, 0x06, 0x22, 0x25, 0x19, 0x38, 0x23, 0x18, 0x0F, 0x0B, 0x23, 0x2F, 0x27, 0x1B, 0x23, 0x13,
+    0x34, 0x21, 0x27, 0x2B, 0x15, 0x25, 0x33, 0x17, 0x2F, 0x0B, 0x25, 0x16, 0x27, 0x32, 0x0A, 0x35,
+    0x10, 0x32, 0x2C, 0x00, 0x31, 0x0E, 0x03, 0x1C, 0x03, 0x15, 0x20, 0x33, 0x21, 0x0C, 0x04, 0x16,
+    0x19, 0x23, 0x02, 0x34, 0xBB, 0x1F, 0x10, 0x19, 0x0F, 0x34, 0x0B, 0x12, 0x2D, 0x06, 0x1D, 0x04,
+    0x36, 0x18, 0x1F, 0x0D, 0x19, 0x38, 0x0A, 0x05, 0x2B, 0x33, 0x10, 0x17, 0x1E, 0x13, 0x14, 0x19,
+    0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31, 0x1B, 0x13, 0x19, 0x01, 0x2A, 0x05, 0x21, 0x09,
+    0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03, 0x0C, 0x02, 0x2C, 0x18, 0x04,
+    0x22, 0x02, 0x02, 0x83, 0x15, 0x30, 0x01, 0x14, 0x02, 0x05, 0x8B, 0x0C, 0x1A, 0x16, 0x0C, 0x0D,
+    0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x02, 0x18, 0xC7, 0x11, 0x08, 0x1A, 0x18, 0x01, 0x05,
+    0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F, 0x04, 0x0F, 0x0D,
+    0x0B, 0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B, 0x01, 0x6D, 0x1E, 0x13, 0x14,
+    0x19, 0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31, 0x1B, 0x13, 0x19, 0x01, 0x2A, 0x05, 0x21,
+    0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03, 0x0C, 0x02, 0x2C, 0x18,
+    0x04, 0x22, 0x02, 0x02, 0x83, 0x15, 0x30, 0x01, 0x14, 0x02, 0x05, 0x8B, 0x0C, 0x1A, 0x16, 0x0C,
+    0x0D, 0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x02, 0x18, 0xC7, 0x11, 0x08, 0x1A, 0x18, 0x01,
+    0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F, 0x04, 0x0F,
+    0x0D, 0x0B, 0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B, 0x01, 0x6D, 0x1E, 0x13,
+    0x14, 0x19, 0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31, 0x1B, 0x13, 0x19, 0x01, 0x2A, 0x05,
+    0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03, 0x0C, 0x02, 0x2C,
+    0x18, 0x04, 0x22, 0x02, 0x02, 0x83, 0x15, 0x30, 0x01, 0x14, 0x02, 0x05, 0x8B, 0x0C, 0x1A, 0x16,
+    0x0C, 0x0D, 0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x02, 0x18, 0xA7, 0x11, 0x08, 0x1A, 0x18,
+    0x01, 0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F, 0x04,
+    0x05, 0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03, 0x0C, 0x02,
+    0x2C, 0x18, 0x04, 0x22, 0x02, 0x02, 0x83, 0x15, 0x30, 0x01, 0x14, 0x02, 0x05, 0x8B, 0x0C, 0x1A,
+    0x16, 0x0C, 0x0D, 0x08, 0x10, 0x0B, 0x0F, 0x09, 0x0D, 0x14, 0x02, 0x18, 0xC1, 0x11, 0x08, 0x1A,
+    0x18, 0x01, 0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F,
+    0x04, 0x0F, 0x0D, 0x0B, 0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B, 0x01, 0x6D,
+    0x1E, 0x13, 0x14, 0x19, 0x0D, 0x0E, 0x06, 0x02, 0x09, 0x0C, 0x01, 0x06, 0x03, 0x08, 0x03, 0x06,
+    0x0C, 0x0F, 0x08, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D, 0x06, 0x0E, 0x0F, 0x0C, 0x0F, 0x0D, 0x08, 0x02,
+    0x07, 0x82, 0x08, 0x05, 0x0B, 0x02, 0x08, 0xA6, 0x01, 0x04, 0x0F, 0x0C, 0x0A, 0x0D, 0x07, 0x0F,
+    0x04, 0x71, 0x63, 0x5E, 0xC4, 0x55, 0x0A, 0xA0, 0xD2, 0x78, 0x8F, 0x9F, 0x44, 0xEB, 0x40, 0x29,
+    0x80, 0xEA, 0xB6, 0x58, 0x97, 0x74, 0x8D, 0xC1, 0x55, 0x6E, 0x5D, 0x43, 0x85, 0x24, 0x2D, 0x02,
+    0xAC, 0x81, 0x02, 0x26, 0x02, 0x66, 0xFB, 0x8C, 0xC8, 0x8E, 0x2F, 0xDD, 0xBE, 0xC7, 0x3E, 0x36,
+    0xEE, 0x5E, 0x14, 0xB3, 0xCE, 0x60, 0x39, 0x3B, 0x72, 0x4E, 0x75, 0x93, 0x28, 0x5B, 0xCB, 0x7B,
+    0x9E, 0x41, 0xB8, 0xD7, 0x71, 0x5A, 0xB4, 0xB7, 0xDD, 0x37, 0x1B, 0xA2, 0x32, 0x9F, 0xC5, 0x79,
+    0x6F, 0x90, 0x0D, 0x83, 0xDD, 0x23, 0xAC, 0xE6, 0x20, 0x10, 0x35, 0x44, 0x2F, 0xC7, 0xA2, 0xAA,
+    0x1C, 0x93, 0x81, 0x70, 0x25, 0xED, 0x8B, 0x6D, 0x03, 0xC5, 0x77, 0xA3, 0x71, 0xA3, 0x9F, 0xF0,
+    0xA8, 0x3A, 0x01, 0x70, 0x80, 0xE3, 0x96, 0x91, 0x39, 0xE2, 0x66, 0x39, 0x97, 0xB7, 0x60, 0xED,
+    0xB9, 0x15, 0x41, 0x81, 0x8C, 0x8D, 0xDD, 0xEC, 0xD0, 0x47, 0x28, 0x23, 0x50, 0xC7, 0x15, 0x92,
+    0x6A, 0x14, 0x75, 0xDD, 0x5C, 0x18, 0x04, 0x19, 0x01, 0x32, 0x2C, 0x29, 0x01, 0x3B, 0x18, 0x05,
+    0x28, 0x0C, 0x22, 0x02, 0x31, 0xFF, 0x16, 0x05, 0x2D, 0x1B, 0x1C, 0x11, 0x2E, 0x08, 0x0A, 0x16,
+    0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38, 0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06,
+    0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x1A,
+    0x0D, 0x2D, 0x25, 0x39, 0x20, 0x10, 0x28, 0x12, 0x2B, 0x25, 0x3A, 0x00, 0x12, 0x32, 0x11, 0x2E,
+    0x08, 0x0A, 0x16, 0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38, 0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32,
+    0x11, 0x0A, 0x06, 0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D,
+    0x24, 0x22, 0x1A, 0x0D, 0x2D, 0x25, 0x39, 0x20, 0x10, 0x28, 0x12, 0x2B, 0x25, 0x3A, 0x00, 0x12,
+    0x32, 0x11, 0x2E, 0x08, 0x0A, 0x16, 0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38, 0x17, 0x28, 0x23, 0x3C,
+    0x19, 0x17, 0x32, 0x11, 0x0A, 0x06, 0xFF, 0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13,
+    0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x1A, 0x0D, 0x2D, 0x25, 0x39, 0x20, 0x10, 0x28, 0x12, 0x2B,
+    0x25, 0x3A, 0x00, 0x12, 0x32, 0x11, 0x2E, 0x08, 0x0A, 0x16, 0x27, 0x3A, 0x14, 0x23, 0x0F, 0x38,
+    0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06, 0x01, 0x36, 0x1A, 0x0C, 0x20, 0x22,
+    0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x5D, 0x70, 0x1F, 0x42, 0x27, 0x71, 0x3E,
+    0x69, 0x23, 0x61, 0x7A, 0x5A, 0x42, 0x00, 0x35, 0x53, 0x1D, 0x1C, 0x5B, 0x25, 0x06, 0x7C, 0x1B,
+    0x4D, 0x17, 0x33, 0x4A, 0x02, 0x43, 0x35, 0x10, 0x4F, 0x0C, 0x28, 0x23, 0x62, 0x10, 0x29, 0x16,
+    0x6B, 0x75, 0x2D, 0x1B, 0x2A, 0x6B, 0x7A, 0x71, 0x05, 0x68, 0x3F, 0x23, 0x3E, 0x78, 0x12, 0x4F,
+    0x2B, 0x6B, 0x66, 0x4A, 0x2F, 0x51, 0x10, 0xFF, 0x64, 0x1F, 0x6B, 0x59, 0x0A, 0x4B, 0x1C, 0x10,
+    0x4D, 0x6C, 0x3B, 0x0A, 0x68, 0x50, 0x23, 0x1E, 0x2E, 0x60, 0x36, 0x67, 0x60, 0x05, 0x68, 0x08,
+    0x18, 0x2E, 0x76, 0x7C, 0x0A, 0x77, 0x79, 0x5E, 0x1E, 0x52, 0x61, 0x7B, 0x0D, 0x67, 0x60, 0x56,
+    0x67, 0x00, 0x26, 0x3A, 0x0B, 0x15, 0x19, 0x27, 0x0E, 0x04, 0x4D, 0x63, 0x4D, 0x72, 0x3A, 0x2A,
+    0x71, 0x7C, 0x7A, 0x49, 0x7C, 0x0C, 0x64, 0x3A, 0x63, 0x3F, 0x0F, 0x5E, 0x00, 0x67, 0x3D, 0x76,
+    0x62, 0x5C, 0x73, 0x6F, 0x47, 0x74, 0x64, 0x46, 0x61, 0x2F, 0x71, 0x06, 0x30, 0x58, 0x51, 0x79,
+    0x1D, 0x27, 0x3A, 0x31, 0x2A, 0x15, 0x0C, 0x19, 0x1F, 0x03, 0x3F, 0x37, 0x03, 0x11, 0x09, 0x06,
+    0x37, 0x20, 0x1F, 0x00, 0x14, 0x18, 0x3A, 0x36, 0x30, 0x26, 0x01, 0x34, 0x1E, 0x2B, 0x10, 0x13,
+    0x2A, 0x1D, 0x13, 0x21, 0x1C, 0x29, 0x27, 0x26, 0xB8, 0x05, 0x06, 0x16, 0x0F, 0x18, 0x20, 0x33,
+    0x2E, 0x07, 0x33, 0x13, 0x40, 0x2D, 0x2F, 0x31, 0x20, 0x2B, 0x17, 0x09, 0x14, 0x20, 0x29, 0x21,
+    0x32, 0x11, 0x32, 0x2B, 0x00, 0x2E, 0x1A, 0x1B, 0x15, 0x3F, 0x00, 0x17, 0x3C, 0x0C, 0x33, 0x34,
+    0x30, 0x32, 0x2E, 0x1A, 0x0E, 0x40, 0x3B, 0x16, 0x00, 0x02, 0x16, 0x11, 0x3D, 0x25, 0x38, 0x32,
+    0x3E, 0x07, 0x02, 0x35, 0xD3, 0x0E, 0x08, 0x34, 0x21, 0x20, 0x39, 0x11, 0x01, 0x27, 0x23, 0x0C,
+    0x36, 0x0B, 0x00, 0x3C, 0x2B, 0x37, 0x11, 0x14, 0x0F, 0x03, 0x07, 0x3D, 0x0E, 0x13, 0x39, 0x38,
+    0x0C, 0x39, 0x28, 0x39, 0x2B, 0x1E, 0x0A, 0x03, 0x2B, 0x05, 0x02, 0x0A, 0x3F, 0x37, 0x31, 0x29,
+    0x1E, 0x25, 0x40, 0x32, 0x05, 0x34, 0x36, 0x38, 0x1A, 0x3A, 0x08, 0x2E, 0x3F, 0x19, 0x38, 0x06,
+    0x10, 0x28, 0x0D, 0x18, 0x33, 0x34, 0x21, 0x2F, 0x23, 0x27, 0x0D, 0x08, 0x22, 0x25, 0x3C, 0x25,
+    0x2A, 0x03, 0x3C, 0x35, 0x33, 0x18, 0x13, 0x3C, 0x2E, 0x02, 0x17, 0x84, 0x1F, 0x08, 0x40, 0x11,
+    0x1C, 0x02, 0x37, 0xB3, 0x18, 0x1F, 0x18, 0x0E, 0x09, 0x3C, 0x0B, 0x2C, 0x1C, 0x07, 0x0D, 0x13,
+    0x30, 0x0F, 0x07, 0x10, 0x0E, 0x07, 0x1E, 0x3E, 0x21, 0x2F, 0x31, 0x09, 0x3B, 0x13, 0x0C, 0x13,
+    0x11, 0x1A, 0x12, 0x35, 0x15, 0x2C, 0x0C, 0x21, 0x2E, 0x19, 0x32, 0x28, 0x0C, 0x22, 0x24, 0x16,
+    0x12, 0x36, 0x15, 0x07, 0x30, 0x01, 0x1D, 0x31, 0x02, 0x18, 0x90, 0x15, 0x27, 0x26, 0x05, 0x10,
+    0x07, 0x04, 0x22, 0x0E, 0x06, 0x33, 0x21, 0x0A, 0x0B, 0x10, 0x0D, 0x34, 0x02, 0x3A, 0x9D, 0x29,
+    0x3B, 0x0F, 0x2B, 0x1A, 0x3C, 0x28, 0x13, 0x14, 0x31, 0x05, 0x21, 0x26, 0x24, 0x29, 0x23, 0x18,
+    0x34, 0x32, 0x0F, 0x13, 0x12, 0x36, 0x11, 0x28, 0x05, 0x0F, 0x22, 0x14, 0x3D,
+};
+const std::vector<uint8_t> fixture_mixed_lz = {
+    0x7F, 0x0A, 0x05, 0x03, 0x00, 0x0F, 0x10, 0x0F, 0x02, 0x09, 0x0A, 0x06, 0x0F, 0x01, 0x0F, 0x06,
+    0x14, 0x0D, 0x08, 0x0B, 0x13, 0x00, 0x0F, 0x01, 0x00, 0x06, 0x04, 0x09, 0x10, 0x0C, 0x14, 0x04,
+    0x0A, 0x0E, 0x0F, 0x03, 0x0E, 0x14, 0x05, 0x01, 0x02, 0x0A, 0x0C, 0x0A, 0x00, 0x11, 0x0B, 0x0A,
+    0x08, 0x0A, 0x0C, 0x0E, 0x0D, 0x01, 0x03, 0x00, 0x01, 0x07, 0x08, 0x04, 0x05, 0x11, 0x0A, 0x0F,
+    0x14, 0x08, 0x00, 0x03, 0x0F, 0x00, 0x03, 0x11, 0x13, 0x0C, 0x09, 0x0D, 0x0D, 0x0A, 0x14, 0x0D,
+    0x11, 0x14, 0x07, 0x11, 0x07, 0x13, 0x10, 0x13, 0x08, 0x12, 0x13, 0x13, 0x11, 0x04, 0x0A, 0x12,
+    0x0D, 0x05, 0x14, 0x08, 0x07, 0x0F, 0x13, 0x01, 0x0B, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x00,
+    0x01, 0x04, 0x00, 0x05, 0x07, 0x06, 0x01, 0x07, 0x03, 0x02, 0x06, 0x02, 0x01, 0x06, 0x03, 0x01,
+    0x04, 0x07, 0x04, 0x04, 0x01, 0x01, 0x01, 0x05, 0x06, 0x04, 0x80, 0x19, 0x09, 0x01, 0x07, 0x05,
+    0x06, 0x03, 0x00, 0x05, 0x01, 0x07, 0x00, 0x80, 0x13, 0x06, 0x03, 0x07, 0x01, 0x05, 0x04, 0x02,
+    0x06, 0x80, 0x31, 0x00, 0x05, 0x80, 0x0B, 0x02, 0x07, 0x02, 0x01, 0x81, 0x40, 0x07, 0x04, 0x03,
+    0x05, 0x04, 0x01, 0x04, 0x07, 0x02, 0x80, 0x01, 0x80, 0x82, 0x01, 0x00, 0x02, 0x81, 0x4D, 0x81,
+    0x21, 0x14, 0x02, 0x01, 0x00, 0x01, 0x03, 0x02, 0x00, 0x04, 0x03, 0x01, 0x07, 0x01, 0x06, 0x00,
+    0x07, 0x05, 0x02, 0x03, 0x05, 0x03, 0x01, 0x80, 0x45, 0x04, 0x00, 0x01, 0x02, 0x01, 0x03, 0x80,
+    0x09, 0x00, 0x05, 0x80, 0x6D, 0x7F, 0x02, 0x06, 0x22, 0x25, 0x19, 0x38, 0x23, 0x18, 0x0F, 0x0B,
+    0x23, 0x2F, 0x27, 0x1B, 0x23, 0x13, 0x34, 0x21, 0x27, 0x2B, 0x15, 0x25, 0x33, 0x17, 0x2F, 0x0B,
+    0x25, 0x16, 0x27, 0x32, 0x0A, 0x35, 0x10, 0x32, 0x2C, 0x00, 0x31, 0x0E, 0x03, 0x1C, 0x03, 0x15,
+    0x20, 0x33, 0x21, 0x0C, 0x04, 0x16, 0x19, 0x23, 0x34, 0x34, 0x1F, 0x10, 0x19, 0x0F, 0x34, 0x0B,
+    0x12, 0x2D, 0x06, 0x1D, 0x04, 0x36, 0x18, 0x1F, 0x0D, 0x19, 0x38, 0x0A, 0x05, 0x2B, 0x33, 0x10,
+    0x17, 0x1E, 0x13, 0x14, 0x19, 0x0D, 0x00, 0x32, 0x11, 0x1C, 0x06, 0x16, 0x31, 0x1B, 0x13, 0x19,
+    0x01, 0x2A, 0x05, 0x21, 0x09, 0x13, 0x28, 0x21, 0x23, 0x00, 0x14, 0x0C, 0x16, 0x0C, 0x2A, 0x03,
+    0x0C, 0x02, 0x2C, 0x18, 0x04, 0x22, 0x02, 0x02, 0x15, 0x30, 0x01, 0x14, 0x05, 0x05, 0x0C, 0x1A,
+    0x16, 0x0C, 0x0D, 0x08, 0x10, 0x0B, 0x28, 0x0F, 0x09, 0x0D, 0x14, 0x18, 0x18, 0x11, 0x08, 0x1A,
+    0x18, 0x01, 0x05, 0x15, 0x0A, 0x19, 0x08, 0x07, 0x11, 0x14, 0x17, 0x06, 0x10, 0x01, 0x04, 0x0F,
+    0x04, 0x0F, 0x0D, 0x0B, 0x08, 0x12, 0x3E, 0x1F, 0x0B, 0x19, 0x6E, 0x80, 0x44, 0x5B, 0x01, 0x6D,
+    0xFF, 0x5D, 0xA8, 0x5D, 0xCF, 0x9B, 0x20, 0x0E, 0x06, 0x02, 0x09, 0x0C, 0x01, 0x06, 0x03, 0x08,
+    0x03, 0x06, 0x0C, 0x0F, 0x08, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D, 0x06, 0x0E, 0x0F, 0x0C, 0x0F, 0x0D,
+    0x08, 0x07, 0x07, 0x08, 0x05, 0x0B, 0x08, 0x08, 0x80, 0x38, 0x7F, 0x0C, 0x0A, 0x0D, 0x07, 0x0F,
+    0x04, 0x71, 0x63, 0x5E, 0xC4, 0x55, 0x0A, 0xA0, 0xD2, 0x78, 0x8F, 0x9F, 0x44, 0xEB, 0x40, 0x29,
+    0x80, 0xEA, 0xB6, 0x58, 0x97, 0x74, 0x8D, 0xC1, 0x55, 0x6E, 0x5D, 0x43, 0x85, 0x24, 0x2D, 0xAC,
+    0xAC, 0x02, 0x26, 0x66, 0x66, 0x8C, 0xC8, 0x8E, 0x2F, 0xDD, 0xBE, 0xC7, 0x3E, 0x36, 0xEE, 0x5E,
+    0x14, 0xB3, 0xCE, 0x60, 0x39, 0x3B, 0x72, 0x4E, 0x75, 0x93, 0x28, 0x5B, 0xCB, 0x7B, 0x9E, 0x41,
+    0xB8, 0xD7, 0x71, 0x5A, 0xB4, 0xB7, 0xDD, 0x37, 0x1B, 0xA2, 0x32, 0x9F, 0xC5, 0x79, 0x6F, 0x90,
+    0x0D, 0x83, 0xDD, 0x23, 0xAC, 0xE6, 0x20, 0x10, 0x35, 0x44, 0x2F, 0xC7, 0xA2, 0xAA, 0x1C, 0x93,
+    0x81, 0x70, 0x25, 0xED, 0x8B, 0x6D, 0x03, 0xC5, 0x77, 0xA3, 0x71, 0xA3, 0x9F, 0xF0, 0xA8, 0x3A,
+    0x01, 0x70, 0x80, 0xE3, 0x96, 0x91, 0x39, 0xE2, 0x66, 0x39, 0x97, 0x5F, 0xB7, 0x60, 0xED, 0xB9,
+    0x15, 0x41, 0x81, 0x8C, 0x8D, 0xDD, 0xEC, 0xD0, 0x47, 0x28, 0x23, 0x50, 0xC7, 0x15, 0x92, 0x6A,
+    0x14, 0x75, 0xDD, 0x5C, 0x18, 0x04, 0x19, 0x01, 0x32, 0x2C, 0x29, 0x01, 0x3B, 0x18, 0x05, 0x28,
+    0x0C, 0x22, 0x31, 0x31, 0x16, 0x05, 0x2D, 0x1B, 0x1C, 0x11, 0x2E, 0x08, 0x0A, 0x16, 0x27, 0x3A,
+    0x14, 0x23, 0x0F, 0x38, 0x17, 0x28, 0x23, 0x3C, 0x19, 0x17, 0x32, 0x11, 0x0A, 0x06, 0x01, 0x36,
+    0x1A, 0x0C, 0x20, 0x22, 0x3B, 0x22, 0x13, 0x12, 0x33, 0x2C, 0x0D, 0x24, 0x22, 0x1A, 0x0D, 0x2D,
+    0x25, 0x39, 0x20, 0x10, 0x28, 0x12, 0x2B, 0x25, 0x3A, 0x00, 0x12, 0x32, 0xFF, 0x32, 0x85, 0x32,
+    0x7F, 0x5D, 0x70, 0x1F, 0x42, 0x27, 0x71, 0x3E, 0x69, 0x23, 0x61, 0x7A, 0x5A, 0x42, 0x00, 0x35,
+    0x53, 0x1D, 0x1C, 0x5B, 0x25, 0x06, 0x7C, 0x1B, 0x4D, 0x17, 0x33, 0x4A, 0x02, 0x43, 0x35, 0x10,
+    0x4F, 0x0C, 0x28, 0x23, 0x62, 0x10, 0x29, 0x16, 0x6B, 0x75, 0x2D, 0x1B, 0x2A, 0x6B, 0x7A, 0x71,
+    0x05, 0x68, 0x3F, 0x23, 0x3E, 0x78, 0x12, 0x4F, 0x2B, 0x6B, 0x66, 0x4A, 0x2F, 0x51, 0x10, 0x64,
+    0x1F, 0x6B, 0x59, 0x0A, 0x4B, 0x1C, 0x10, 0x4D, 0x6C, 0x3B, 0x0A, 0x68, 0x50, 0x23, 0x1E, 0x2E,
+    0x60, 0x36, 0x67, 0x60, 0x05, 0x68, 0x08, 0x18, 0x2E, 0x76, 0x7C, 0x0A, 0x77, 0x79, 0x5E, 0x1E,
+    0x52, 0x61, 0x7B, 0x0D, 0x67, 0x60, 0x56, 0x67, 0x00, 0x26, 0x3A, 0x0B, 0x15, 0x19, 0x27, 0x0E,
+    0x04, 0x4D, 0x63, 0x4D, 0x72, 0x3A, 0x2A, 0x71, 0x7C, 0x7A, 0x49, 0x7C, 0x0C, 0x64, 0x3A, 0x63,
+    0x3F, 0x7F, 0x0F, 0x5E, 0x00, 0x67, 0x3D, 0x76, 0x62, 0x5C, 0x73, 0x6F, 0x47, 0x74, 0x64, 0x46,
+    0x61, 0x2F, 0x71, 0x06, 0x30, 0x58, 0x51, 0x79, 0x1D, 0x27, 0x3A, 0x31, 0x2A, 0x15, 0x0C, 0x19,
+    0x1F, 0x03, 0x3F, 0x37, 0x03, 0x11, 0x09, 0x06, 0x37, 0x20, 0x1F, 0x00, 0x14, 0x18, 0x3A, 0x36,
+    0x30, 0x26, 0x01, 0x34, 0x1E, 0x2B, 0x10, 0x13, 0x2A, 0x1D, 0x13, 0x21, 0x1C, 0x29, 0x27, 0x26,
+    0x05, 0x06, 0x16, 0x0F, 0x18, 0x20, 0x33, 0x2E, 0x07, 0x33, 0x13, 0x40, 0x2D, 0x2F, 0x31, 0x20,
+    0x2B, 0x17, 0x09, 0x14, 0x20, 0x29, 0x21, 0x32, 0x11, 0x32, 0x2B, 0x00, 0x2E, 0x1A, 0x1B, 0x15,
+    0x3F, 0x00, 0x17, 0x3C, 0x0C, 0x33, 0x34, 0x30, 0x32, 0x2E, 0x1A, 0x0E, 0x40, 0x3B, 0x16, 0x00,
+    0x02, 0x16, 0x11, 0x3D, 0x25, 0x38, 0x32, 0x3E, 0x07, 0x35, 0x35, 0x0E, 0x08, 0x34, 0x21, 0x20,
+    0x39, 0x11, 0x7F, 0x01, 0x27, 0x23, 0x0C, 0x36, 0x0B, 0x00, 0x3C, 0x2B, 0x37, 0x11, 0x14, 0x0F,
+    0x03, 0x07, 0x3D, 0x0E, 0x13, 0x39, 0x38, 0x0C, 0x39, 0x28, 0x39, 0x2B, 0x1E, 0x0A, 0x03, 0x2B,
+    0x05, 0x02, 0x0A, 0x3F, 0x37, 0x31, 0x29, 0x1E, 0x25, 0x40, 0x32, 0x05, 0x34, 0x36, 0x38, 0x1A,
+    0x3A, 0x08, 0x2E, 0x3F, 0x19, 0x38, 0x06, 0x10, 0x28, 0x0D, 0x18, 0x33, 0x34, 0x21, 0x2F, 0x23,
+    0x27, 0x0D, 0x08, 0x22, 0x25, 0x3C, 0x25, 0x2A, 0x03, 0x3C, 0x35, 0x33, 0x18, 0x13, 0x3C, 0x2E,
+    0x17, 0x17, 0x1F, 0x08, 0x40, 0x11, 0x1C, 0x37, 0x37, 0x18, 0x1F, 0x18, 0x0E, 0x09, 0x3C, 0x0B,
+    0x2C, 0x1C, 0x07, 0x0D, 0x13, 0x30, 0x0F, 0x07, 0x10, 0x0E, 0x07, 0x1E, 0x3E, 0x21, 0x2F, 0x31,
+    0x09, 0x3B, 0x13, 0x0C, 0x13, 0x11, 0x1A, 0x12, 0x35, 0x15, 0x2C, 0x0C, 0x21, 0x2E, 0x19, 0x32,
+    0x28, 0x0C, 0x22, 0x0C, 0x24, 0x16, 0x12, 0x36, 0x15, 0x07, 0x30, 0x01, 0x1D, 0x31, 0x18, 0x18,
+    0x15, 0x80, 0xD0, 0x2C, 0x10, 0x07, 0x04, 0x22, 0x0E, 0x06, 0x33, 0x21, 0x0A, 0x0B, 0x10, 0x0D,
+    0x34, 0x3A, 0x3A, 0x29, 0x3B, 0x0F, 0x2B, 0x1A, 0x3C, 0x28, 0x13, 0x14, 0x31, 0x05, 0x21, 0x26,
+    0x24, 0x29, 0x23, 0x18, 0x34, 0x32, 0x0F, 0x13, 0x12, 0x36, 0x11, 0x28, 0x05, 0x0F, 0x22, 0x14,
+    0x3D,
+};
+
+// 4bpp status screen: a row of repeated icons, a progress bar, and a little noise, packed two pixels per byte
+const std::vector<uint8_t> fixture_pal16_40x32_raw = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x11,
+    0x11, 0x11, 0x22, 0x22, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x33, 0x33, 0x22, 0x22, 0x22, 0x33,
+    0x00, 0x00, 0x10, 0x11, 0x21, 0x22, 0x32, 0x33, 0x11, 0x11, 0x21, 0x22, 0x32, 0x33, 0x43, 0x44,
+    0x22, 0x22, 0x32, 0x33, 0x00, 0x00, 0x11, 0x21, 0x22, 0x32, 0x33, 0x44, 0x11, 0x11, 0x22, 0x32,
+    0x33, 0x43, 0x44, 0x55, 0x22, 0x22, 0x33, 0x43, 0x00, 0x10, 0x11, 0x22, 0x32, 0x33, 0x44, 0x54,
+    0x11, 0x21, 0x22, 0x33, 0x43, 0x44, 0x55, 0x65, 0x22, 0x32, 0x33, 0x44, 0x00, 0x10, 0x21, 0x22,
+    0x33, 0x44, 0x54, 0x65, 0x11, 0x21, 0x32, 0x33, 0x44, 0x55, 0x65, 0x76, 0x22, 0x32, 0x43, 0x44,
+    0x00, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x11, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87,
+    0x22, 0x32, 0x43, 0x54, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x11, 0x22, 0x33, 0x44,
+    0x55, 0x66, 0x77, 0x88, 0x22, 0x33, 0x44, 0x55, 0x00, 0x11, 0x22, 0x43, 0x54, 0x65, 0x77, 0x88,
+    0x11, 0x22, 0x33, 0x54, 0x65, 0x76, 0x88, 0x99, 0x22, 0x33, 0x44, 0x65, 0x00, 0x11, 0x32, 0x43,
+    0x55, 0x76, 0x87, 0x99, 0x11, 0x22, 0x43, 0x54, 0x66, 0x87, 0x98, 0xAA, 0x22, 0x33, 0x54, 0x65,
+    0x00, 0x21, 0x32, 0x44, 0x65, 0x77, 0x98, 0xA9, 0x11, 0x32, 0x43, 0x55, 0x76, 0x88, 0xA9, 0xBA,
+    0x22, 0x43, 0x54, 0x66, 0x00, 0x21, 0x33, 0x54, 0x66, 0x87, 0x99, 0xBA, 0x11, 0x32, 0x44, 0x65,
+    0x77, 0x98, 0xAA, 0xCB, 0x22, 0x43, 0x55, 0x76, 0x00, 0x21, 0x43, 0x54, 0x76, 0x98, 0xA9, 0xCB,
+    0x11, 0x32, 0x54, 0x65, 0x87, 0xA9, 0xBA, 0xDC, 0x22, 0x43, 0x65, 0x76, 0x00, 0x21, 0x43, 0x65,
+    0x77, 0x98, 0xBA, 0xDC, 0x11, 0x32, 0x54, 0x76, 0x88, 0xA9, 0xCB, 0xED, 0x22, 0x43, 0x65, 0x87,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x81, 0x2E, 0xCA, 0x1D, 0x7D, 0x3B, 0x56, 0x76, 0x10, 0x78, 0x89, 0x0D, 0x6B, 0xE3, 0x73, 0xD4,
+    0x6C, 0x8D, 0x14, 0xCA, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66,
+    0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44,
+    0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77,
+    0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55,
+    0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33,
+    0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66,
+    0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44,
+    0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77,
+    0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55,
+};
+const std::vector<uint8_t> fixture_pal16_40x32_rle = {
+    0x08, 0x00, 0x08, 0x11, 0x04, 0x22, 0x08, 0x00, 0x08, 0x11, 0x04, 0x22, 0x04, 0x00, 0x80, 0x10,
+    0x07, 0x11, 0x80, 0x21, 0x07, 0x22, 0x03, 0x00, 0x03, 0x11, 0x02, 0x22, 0x03, 0x11, 0x03, 0x22,
+    0x02, 0x33, 0x03, 0x22, 0x80, 0x33, 0x02, 0x00, 0x85, 0x10, 0x11, 0x21, 0x22, 0x32, 0x33, 0x02,
+    0x11, 0x85, 0x21, 0x22, 0x32, 0x33, 0x43, 0x44, 0x02, 0x22, 0x81, 0x32, 0x33, 0x02, 0x00, 0x85,
+    0x11, 0x21, 0x22, 0x32, 0x33, 0x44, 0x02, 0x11, 0x85, 0x22, 0x32, 0x33, 0x43, 0x44, 0x55, 0x02,
+    0x22, 0xFF, 0x33, 0x43, 0x00, 0x10, 0x11, 0x22, 0x32, 0x33, 0x44, 0x54, 0x11, 0x21, 0x22, 0x33,
+    0x43, 0x44, 0x55, 0x65, 0x22, 0x32, 0x33, 0x44, 0x00, 0x10, 0x21, 0x22, 0x33, 0x44, 0x54, 0x65,
+    0x11, 0x21, 0x32, 0x33, 0x44, 0x55, 0x65, 0x76, 0x22, 0x32, 0x43, 0x44, 0x00, 0x10, 0x21, 0x32,
+    0x43, 0x54, 0x65, 0x76, 0x11, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87, 0x22, 0x32, 0x43, 0x54,
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
+    0x22, 0x33, 0x44, 0x55, 0x00, 0x11, 0x22, 0x43, 0x54, 0x65, 0x77, 0x88, 0x11, 0x22, 0x33, 0x54,
+    0x65, 0x76, 0x88, 0x99, 0x22, 0x33, 0x44, 0x65, 0x00, 0x11, 0x32, 0x43, 0x55, 0x76, 0x87, 0x99,
+    0x11, 0x22, 0x43, 0x54, 0x66, 0x87, 0x98, 0xAA, 0x22, 0x33, 0x54, 0x65, 0x00, 0x21, 0x32, 0x44,
+    0x65, 0x77, 0xC9, 0x98, 0xA9, 0x11, 0x32, 0x43, 0x55, 0x76, 0x88, 0xA9, 0xBA, 0x22, 0x43, 0x54,
+    0x66, 0x00, 0x21, 0x33, 0x54, 0x66, 0x87, 0x99, 0xBA, 0x11, 0x32, 0x44, 0x65, 0x77, 0x98, 0xAA,
+    0xCB, 0x22, 0x43, 0x55, 0x76, 0x00, 0x21, 0x43, 0x54, 0x76, 0x98, 0xA9, 0xCB, 0x11, 0x32, 0x54,
+    0x65, 0x87, 0xA9, 0xBA, 0xDC, 0x22, 0x43, 0x65, 0x76, 0x00, 0x21, 0x43, 0x65, 0x77, 0x98, 0xBA,
+    0xDC, 0x11, 0x32, 0x54, 0x76, 0x88, 0xA9, 0xCB, 0xED, 0x22, 0x43, 0x65, 0x87, 0x0D, 0x99, 0x07,
+    0x11, 0x0D, 0x99, 0x07, 0x11, 0x0D, 0x99, 0x07, 0x11, 0x0D, 0x99, 0x07, 0x11, 0x0D, 0x99, 0x07,
+    0x11, 0x0D, 0x99, 0x07, 0x11, 0x0D, 0x99, 0x07, 0x11, 0x0D, 0x99, 0x07, 0x11, 0x93, 0x81, 0x2E,
+    0xCA, 0x1D, 0x7D, 0x3B, 0x56, 0x76, 0x10, 0x78, 0x89, 0x0D, 0x6B, 0xE3, 0x73, 0xD4, 0x6C, 0x8D,
+    0x14, 0xCA, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77,
+    0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55,
+    0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33,
+    0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66,
+    0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44,
+    0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77,
+    0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55,
+    0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33,
+    0x02, 0x44, 0x02, 0x55, 0x02, 0x66, 0x02, 0x77, 0x02, 0x33, 0x02, 0x44, 0x02, 0x55,
+};
+const std::vector<uint8_t> fixture_pal16_40x32_lz = {
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x11, 0x84, 0x00, 0x00, 0x22, 0x80, 0x00, 0x95, 0x13, 0x00, 0x10,
+    0x84, 0x0F, 0x00, 0x21, 0x81, 0x10, 0x83, 0x13, 0x82, 0x1D, 0x83, 0x22, 0x01, 0x33, 0x33, 0x81,
+    0x04, 0x81, 0x25, 0x03, 0x21, 0x22, 0x32, 0x33, 0x81, 0x25, 0x04, 0x32, 0x33, 0x43, 0x44, 0x22,
+    0x80, 0x05, 0x80, 0x26, 0x81, 0x0C, 0x00, 0x44, 0x80, 0x26, 0x81, 0x12, 0x00, 0x55, 0x80, 0x26,
+    0x00, 0x43, 0x80, 0x26, 0x81, 0x12, 0x00, 0x54, 0x80, 0x19, 0x81, 0x12, 0x00, 0x65, 0x81, 0x0C,
+    0x01, 0x00, 0x10, 0x80, 0x0C, 0x04, 0x44, 0x54, 0x65, 0x11, 0x21, 0x80, 0x0C, 0x05, 0x55, 0x65,
+    0x76, 0x22, 0x32, 0x43, 0x81, 0x13, 0x04, 0x32, 0x43, 0x54, 0x65, 0x76, 0x80, 0x13, 0x81, 0x06,
+    0x00, 0x87, 0x80, 0x13, 0x02, 0x54, 0x00, 0x11, 0x80, 0x26, 0x02, 0x55, 0x66, 0x77, 0x84, 0x06,
+    0x00, 0x88, 0x81, 0x06, 0x80, 0x13, 0x80, 0x1F, 0x01, 0x77, 0x88, 0x80, 0x13, 0x80, 0x26, 0x01,
+    0x88, 0x99, 0x80, 0x13, 0x08, 0x65, 0x00, 0x11, 0x32, 0x43, 0x55, 0x76, 0x87, 0x99, 0x81, 0x1A,
+    0x03, 0x66, 0x87, 0x98, 0xAA, 0x81, 0x1A, 0x07, 0x00, 0x21, 0x32, 0x44, 0x65, 0x77, 0x98, 0xA9,
+    0x82, 0x1A, 0x02, 0x88, 0xA9, 0xBA, 0x81, 0x1A, 0x02, 0x00, 0x21, 0x33, 0x80, 0x1F, 0x02, 0x99,
+    0xBA, 0x11, 0x82, 0x1A, 0x02, 0xAA, 0xCB, 0x22, 0x80, 0x1A, 0x12, 0x00, 0x21, 0x43, 0x54, 0x76,
+    0x98, 0xA9, 0xCB, 0x11, 0x32, 0x54, 0x65, 0x87, 0xA9, 0xBA, 0xDC, 0x22, 0x43, 0x65, 0x81, 0x13,
+    0x80, 0x1F, 0x01, 0xBA, 0xDC, 0x80, 0x13, 0x80, 0x3A, 0x01, 0xCB, 0xED, 0x80, 0x13, 0x01, 0x87,
+    0x99, 0x89, 0x00, 0x00, 0x11, 0x83, 0x00, 0xFF, 0x13, 0x87, 0x13, 0x1D, 0x81, 0x2E, 0xCA, 0x1D,
+    0x7D, 0x3B, 0x56, 0x76, 0x10, 0x78, 0x89, 0x0D, 0x6B, 0xE3, 0x73, 0xD4, 0x6C, 0x8D, 0x14, 0xCA,
+    0x66, 0x66, 0x77, 0x77, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0xFF, 0x09,
+};
+
+// The same at an odd pixel count, leaving half a byte unused
+const std::vector<uint8_t> fixture_pal16_33x17_raw = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x22, 0x22,
+    0x22, 0x02, 0x00, 0x00, 0x10, 0x11, 0x11, 0x21, 0x22, 0x12, 0x11, 0x11, 0x21, 0x22, 0x22, 0x32,
+    0x33, 0x23, 0x00, 0x00, 0x10, 0x11, 0x21, 0x22, 0x32, 0x33, 0x11, 0x11, 0x21, 0x22, 0x32, 0x33,
+    0x43, 0x44, 0x02, 0x00, 0x10, 0x11, 0x22, 0x22, 0x33, 0x43, 0x14, 0x11, 0x21, 0x22, 0x33, 0x33,
+    0x44, 0x54, 0x25, 0x00, 0x10, 0x11, 0x22, 0x32, 0x33, 0x44, 0x54, 0x11, 0x21, 0x22, 0x33, 0x43,
+    0x44, 0x55, 0x65, 0x02, 0x00, 0x11, 0x22, 0x32, 0x43, 0x44, 0x55, 0x16, 0x11, 0x22, 0x33, 0x43,
+    0x54, 0x55, 0x66, 0x27, 0x00, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x11, 0x21, 0x32, 0x43,
+    0x54, 0x65, 0x76, 0x87, 0x02, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x17, 0x21, 0x32, 0x43,
+    0x54, 0x65, 0x76, 0x87, 0x28, 0x00, 0x11, 0x22, 0x43, 0x54, 0x65, 0x77, 0x88, 0x11, 0x22, 0x33,
+    0x54, 0x65, 0x76, 0x88, 0x99, 0x02, 0x10, 0x21, 0x33, 0x54, 0x65, 0x77, 0x98, 0x19, 0x21, 0x32,
+    0x44, 0x65, 0x76, 0x88, 0xA9, 0x2A, 0x00, 0x21, 0x32, 0x44, 0x65, 0x77, 0x98, 0xA9, 0x11, 0x32,
+    0x43, 0x55, 0x76, 0x88, 0xA9, 0xBA, 0x02, 0x10, 0x32, 0x43, 0x65, 0x76, 0x98, 0xA9, 0x1B, 0x21,
+    0x43, 0x54, 0x76, 0x87, 0xA9, 0xBA, 0x2C, 0x00, 0x21, 0x43, 0x54, 0x76, 0x98, 0xA9, 0xCB, 0x11,
+    0x32, 0x54, 0x65, 0x87, 0xA9, 0xBA, 0xDC, 0x02, 0x10, 0x32, 0x54, 0x76, 0x87, 0xA9, 0xCB, 0x1D,
+    0x21, 0x43, 0x65, 0x87, 0x98, 0xBA, 0xDC, 0x2E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01,
+};
+const std::vector<uint8_t> fixture_pal16_33x17_rle = {
+    0x08, 0x00, 0x08, 0x11, 0x80, 0x02, 0x07, 0x00, 0x80, 0x10, 0x07, 0x11, 0x80, 0x21, 0x04, 0x00,
+    0x80, 0x10, 0x07, 0x11, 0x80, 0x21, 0x03, 0x22, 0x80, 0x02, 0x02, 0x00, 0x80, 0x10, 0x02, 0x11,
+    0x82, 0x21, 0x22, 0x12, 0x02, 0x11, 0x80, 0x21, 0x02, 0x22, 0x82, 0x32, 0x33, 0x23, 0x02, 0x00,
+    0x85, 0x10, 0x11, 0x21, 0x22, 0x32, 0x33, 0x02, 0x11, 0x89, 0x21, 0x22, 0x32, 0x33, 0x43, 0x44,
+    0x02, 0x00, 0x10, 0x11, 0x02, 0x22, 0x85, 0x33, 0x43, 0x14, 0x11, 0x21, 0x22, 0x02, 0x33, 0xFF,
+    0x44, 0x54, 0x25, 0x00, 0x10, 0x11, 0x22, 0x32, 0x33, 0x44, 0x54, 0x11, 0x21, 0x22, 0x33, 0x43,
+    0x44, 0x55, 0x65, 0x02, 0x00, 0x11, 0x22, 0x32, 0x43, 0x44, 0x55, 0x16, 0x11, 0x22, 0x33, 0x43,
+    0x54, 0x55, 0x66, 0x27, 0x00, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x11, 0x21, 0x32, 0x43,
+    0x54, 0x65, 0x76, 0x87, 0x02, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x17, 0x21, 0x32, 0x43,
+    0x54, 0x65, 0x76, 0x87, 0x28, 0x00, 0x11, 0x22, 0x43, 0x54, 0x65, 0x77, 0x88, 0x11, 0x22, 0x33,
+    0x54, 0x65, 0x76, 0x88, 0x99, 0x02, 0x10, 0x21, 0x33, 0x54, 0x65, 0x77, 0x98, 0x19, 0x21, 0x32,
+    0x44, 0x65, 0x76, 0x88, 0xA9, 0x2A, 0x00, 0x21, 0x32, 0x44, 0x65, 0x77, 0x98, 0xA9, 0x11, 0x32,
+    0x43, 0x55, 0x76, 0x88, 0xA9, 0xBA, 0x02, 0x10, 0x32, 0x43, 0x65, 0x76, 0x98, 0xA9, 0x1B, 0x21,
+    0xA7, 0x43, 0x54, 0x76, 0x87, 0xA9, 0xBA, 0x2C, 0x00, 0x21, 0x43, 0x54, 0x76, 0x98, 0xA9, 0xCB,
+    0x11, 0x32, 0x54, 0x65, 0x87, 0xA9, 0xBA, 0xDC, 0x02, 0x10, 0x32, 0x54, 0x76, 0x87, 0xA9, 0xCB,
+    0x1D, 0x21, 0x43, 0x65, 0x87, 0x98, 0xBA, 0xDC, 0x2E, 0x0B, 0x99, 0x05, 0x11, 0x80, 0x01,
+};
+const std::vector<uint8_t> fixture_pal16_33x17_lz = {
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x11, 0x84, 0x00, 0x00, 0x02, 0x84, 0x0F, 0x00, 0x10, 0x84, 0x0F,
+    0x00, 0x21, 0x8A, 0x0C, 0x02, 0x22, 0x22, 0x22, 0x80, 0x20, 0x80, 0x0E, 0x02, 0x21, 0x22, 0x12,
+    0x82, 0x0E, 0x02, 0x32, 0x33, 0x23, 0x81, 0x0F, 0x00, 0x21, 0x80, 0x08, 0x81, 0x0F, 0x04, 0x32,
+    0x33, 0x43, 0x44, 0x02, 0x80, 0x0F, 0x04, 0x22, 0x22, 0x33, 0x43, 0x14, 0x80, 0x0F, 0x04, 0x33,
+    0x33, 0x44, 0x54, 0x25, 0x81, 0x0F, 0x00, 0x32, 0x80, 0x08, 0x81, 0x0F, 0x05, 0x43, 0x44, 0x55,
+    0x65, 0x02, 0x00, 0x80, 0x0F, 0x80, 0x08, 0x01, 0x16, 0x11, 0x80, 0x0F, 0x0C, 0x54, 0x55, 0x66,
+    0x27, 0x00, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x11, 0x83, 0x06, 0x01, 0x87, 0x02, 0x84,
+    0x0F, 0x00, 0x17, 0x84, 0x0F, 0x00, 0x28, 0x80, 0x30, 0x80, 0x08, 0x01, 0x77, 0x88, 0x80, 0x30,
+    0x80, 0x0F, 0x01, 0x88, 0x99, 0x80, 0x20, 0x80, 0x08, 0x05, 0x77, 0x98, 0x19, 0x21, 0x32, 0x44,
+    0x80, 0x0F, 0x02, 0xA9, 0x2A, 0x00, 0x81, 0x08, 0x06, 0x77, 0x98, 0xA9, 0x11, 0x32, 0x43, 0x55,
+    0x80, 0x0F, 0x12, 0xBA, 0x02, 0x10, 0x32, 0x43, 0x65, 0x76, 0x98, 0xA9, 0x1B, 0x21, 0x43, 0x54,
+    0x76, 0x87, 0xA9, 0xBA, 0x2C, 0x00, 0x81, 0x08, 0x06, 0x98, 0xA9, 0xCB, 0x11, 0x32, 0x54, 0x65,
+    0x80, 0x0F, 0x00, 0xDC, 0x80, 0x20, 0x81, 0x18, 0x0A, 0xCB, 0x1D, 0x21, 0x43, 0x65, 0x87, 0x98,
+    0xBA, 0xDC, 0x2E, 0x99, 0x87, 0x00, 0x82, 0xEA, 0x00, 0x01,
+};
+
+// Native RGB565 gradients, the repetition between rows only visible some distance back
+const std::vector<uint8_t> fixture_rgb565_24x16_raw = {
+    0x00, 0x00, 0x08, 0x01, 0x10, 0x02, 0x18, 0x03, 0x28, 0x04, 0x30, 0x05, 0x38, 0x06, 0x48, 0x00,
+    0x50, 0x01, 0x58, 0x02, 0x60, 0x03, 0x70, 0x04, 0x78, 0x05, 0x80, 0x06, 0x90, 0x00, 0x98, 0x01,
+    0xA0, 0x02, 0xA8, 0x03, 0xB8, 0x04, 0xC0, 0x05, 0xC8, 0x06, 0xD8, 0x00, 0xE0, 0x01, 0xE8, 0x02,
+    0x00, 0x01, 0x08, 0x02, 0x10, 0x03, 0x18, 0x04, 0x28, 0x05, 0x30, 0x06, 0x38, 0x00, 0x48, 0x01,
+    0x50, 0x02, 0x58, 0x03, 0x60, 0x04, 0x70, 0x05, 0x78, 0x06, 0x80, 0x00, 0x90, 0x01, 0x98, 0x02,
+    0xA0, 0x03, 0xA8, 0x04, 0xB8, 0x05, 0xC0, 0x06, 0xC8, 0x00, 0xD8, 0x01, 0xE0, 0x02, 0xE8, 0x03,
+    0x00, 0x02, 0x08, 0x03, 0x10, 0x04, 0x18, 0x05, 0x28, 0x06, 0x30, 0x00, 0x38, 0x01, 0x48, 0x02,
+    0x50, 0x03, 0x58, 0x04, 0x60, 0x05, 0x70, 0x06, 0x78, 0x00, 0x80, 0x01, 0x90, 0x02, 0x98, 0x03,
+    0xA0, 0x04, 0xA8, 0x05, 0xB8, 0x06, 0xC0, 0x00, 0xC8, 0x01, 0xD8, 0x02, 0xE0, 0x03, 0xE8, 0x04,
+    0x00, 0x03, 0x08, 0x04, 0x10, 0x05, 0x18, 0x06, 0x28, 0x00, 0x30, 0x01, 0x38, 0x02, 0x48, 0x03,
+    0x50, 0x04, 0x58, 0x05, 0x60, 0x06, 0x70, 0x00, 0x78, 0x01, 0x80, 0x02, 0x90, 0x03, 0x98, 0x04,
+    0xA0, 0x05, 0xA8, 0x06, 0xB8, 0x00, 0xC0, 0x01, 0xC8, 0x02, 0xD8, 0x03, 0xE0, 0x04, 0xE8, 0x05,
+    0x00, 0x64, 0x08, 0x65, 0x10, 0x66, 0x18, 0x60, 0x28, 0x61, 0x30, 0x62, 0x38, 0x63, 0x48, 0x64,
+    0x50, 0x65, 0x58, 0x66, 0x60, 0x60, 0x70, 0x61, 0x78, 0x62, 0x80, 0x63, 0x90, 0x64, 0x98, 0x65,
+    0xA0, 0x66, 0xA8, 0x60, 0xB8, 0x61, 0xC0, 0x62, 0xC8, 0x63, 0xD8, 0x64, 0xE0, 0x65, 0xE8, 0x66,
+    0x00, 0x65, 0x08, 0x66, 0x10, 0x60, 0x18, 0x61, 0x28, 0x62, 0x30, 0x63, 0x38, 0x64, 0x48, 0x65,
+    0x50, 0x66, 0x58, 0x60, 0x60, 0x61, 0x70, 0x62, 0x78, 0x63, 0x80, 0x64, 0x90, 0x65, 0x98, 0x66,
+    0xA0, 0x60, 0xA8, 0x61, 0xB8, 0x62, 0xC0, 0x63, 0xC8, 0x64, 0xD8, 0x65, 0xE0, 0x66, 0xE8, 0x60,
+    0x00, 0x66, 0x08, 0x60, 0x10, 0x61, 0x18, 0x62, 0x28, 0x63, 0x30, 0x64, 0x38, 0x65, 0x48, 0x66,
+    0x50, 0x60, 0x58, 0x61, 0x60, 0x62, 0x70, 0x63, 0x78, 0x64, 0x80, 0x65, 0x90, 0x66, 0x98, 0x60,
+    0xA0, 0x61, 0xA8, 0x62, 0xB8, 0x63, 0xC0, 0x64, 0xC8, 0x65, 0xD8, 0x66, 0xE0, 0x60, 0xE8, 0x61,
+    0x00, 0x60, 0x08, 0x61, 0x10, 0x62, 0x18, 0x63, 0x28, 0x64, 0x30, 0x65, 0x38, 0x66, 0x48, 0x60,
+    0x50, 0x61, 0x58, 0x62, 0x60, 0x63, 0x70, 0x64, 0x78, 0x65, 0x80, 0x66, 0x90, 0x60, 0x98, 0x61,
+    0xA0, 0x62, 0xA8, 0x63, 0xB8, 0x64, 0xC0, 0x65, 0xC8, 0x66, 0xD8, 0x60, 0xE0, 0x61, 0xE8, 0x62,
+    0x00, 0xE1, 0x08, 0xE2, 0x10, 0xE3, 0x18, 0xE4, 0x28, 0xE5, 0x30, 0xE6, 0x38, 0xE0, 0x48, 0xE1,
+    0x50, 0xE2, 0x58, 0xE3, 0x60, 0xE4, 0x70, 0xE5, 0x78, 0xE6, 0x80, 0xE0, 0x90, 0xE1, 0x98, 0xE2,
+    0xA0, 0xE3, 0xA8, 0xE4, 0xB8, 0xE5, 0xC0, 0xE6, 0xC8, 0xE0, 0xD8, 0xE1, 0xE0, 0xE2, 0xE8, 0xE3,
+    0x00, 0xE2, 0x08, 0xE3, 0x10, 0xE4, 0x18, 0xE5, 0x28, 0xE6, 0x30, 0xE0, 0x38, 0xE1, 0x48, 0xE2,
+    0x50, 0xE3, 0x58, 0xE4, 0x60, 0xE5, 0x70, 0xE6, 0x78, 0xE0, 0x80, 0xE1, 0x90, 0xE2, 0x98, 0xE3,
+    0xA0, 0xE4, 0xA8, 0xE5, 0xB8, 0xE6, 0xC0, 0xE0, 0xC8, 0xE1, 0xD8, 0xE2, 0xE0, 0xE3, 0xE8, 0xE4,
+    0x00, 0xE3, 0x08, 0xE4, 0x10, 0xE5, 0x18, 0xE6, 0x28, 0xE0, 0x30, 0xE1, 0x38, 0xE2, 0x48, 0xE3,
+    0x50, 0xE4, 0x58, 0xE5, 0x60, 0xE6, 0x70, 0xE0, 0x78, 0xE1, 0x80, 0xE2, 0x90, 0xE3, 0x98, 0xE4,
+    0xA0, 0xE5, 0xA8, 0xE6, 0xB8, 0xE0, 0xC0, 0xE1, 0xC8, 0xE2, 0xD8, 0xE3, 0xE0, 0xE4, 0xE8, 0xE5,
+    0x00, 0xE4, 0x08, 0xE5, 0x10, 0xE6, 0x18, 0xE0, 0x28, 0xE1, 0x30, 0xE2, 0x38, 0xE3, 0x48, 0xE4,
+    0x50, 0xE5, 0x58, 0xE6, 0x60, 0xE0, 0x70, 0xE1, 0x78, 0xE2, 0x80, 0xE3, 0x90, 0xE4, 0x98, 0xE5,
+    0xA0, 0xE6, 0xA8, 0xE0, 0xB8, 0xE1, 0xC0, 0xE2, 0xC8, 0xE3, 0xD8, 0xE4, 0xE0, 0xE5, 0xE8, 0xE6,
+    0x01, 0x65, 0x09, 0x66, 0x11, 0x60, 0x19, 0x61, 0x29, 0x62, 0x31, 0x63, 0x39, 0x64, 0x49, 0x65,
+    0x51, 0x66, 0x59, 0x60, 0x61, 0x61, 0x71, 0x62, 0x79, 0x63, 0x81, 0x64, 0x91, 0x65, 0x99, 0x66,
+    0xA1, 0x60, 0xA9, 0x61, 0xB9, 0x62, 0xC1, 0x63, 0xC9, 0x64, 0xD9, 0x65, 0xE1, 0x66, 0xE9, 0x60,
+    0x01, 0x66, 0x09, 0x60, 0x11, 0x61, 0x19, 0x62, 0x29, 0x63, 0x31, 0x64, 0x39, 0x65, 0x49, 0x66,
+    0x51, 0x60, 0x59, 0x61, 0x61, 0x62, 0x71, 0x63, 0x79, 0x64, 0x81, 0x65, 0x91, 0x66, 0x99, 0x60,
+    0xA1, 0x61, 0xA9, 0x62, 0xB9, 0x63, 0xC1, 0x64, 0xC9, 0x65, 0xD9, 0x66, 0xE1, 0x60, 0xE9, 0x61,
+    0x01, 0x60, 0x09, 0x61, 0x11, 0x62, 0x19, 0x63, 0x29, 0x64, 0x31, 0x65, 0x39, 0x66, 0x49, 0x60,
+    0x51, 0x61, 0x59, 0x62, 0x61, 0x63, 0x71, 0x64, 0x79, 0x65, 0x81, 0x66, 0x91, 0x60, 0x99, 0x61,
+    0xA1, 0x62, 0xA9, 0x63, 0xB9, 0x64, 0xC1, 0x65, 0xC9, 0x66, 0xD9, 0x60, 0xE1, 0x61, 0xE9, 0x62,
+    0x01, 0x61, 0x09, 0x62, 0x11, 0x63, 0x19, 0x64, 0x29, 0x65, 0x31, 0x66, 0x39, 0x60, 0x49, 0x61,
+    0x51, 0x62, 0x59, 0x63, 0x61, 0x64, 0x71, 0x65, 0x79, 0x66, 0x81, 0x60, 0x91, 0x61, 0x99, 0x62,
+    0xA1, 0x63, 0xA9, 0x64, 0xB9, 0x65, 0xC1, 0x66, 0xC9, 0x60, 0xD9, 0x61, 0xE1, 0x62, 0xE9, 0x63,
+};
+const std::vector<uint8_t> fixture_rgb565_24x16_rle = {
+    0x02, 0x00, 0xFF, 0x08, 0x01, 0x10, 0x02, 0x18, 0x03, 0x28, 0x04, 0x30, 0x05, 0x38, 0x06, 0x48,
+    0x00, 0x50, 0x01, 0x58, 0x02, 0x60, 0x03, 0x70, 0x04, 0x78, 0x05, 0x80, 0x06, 0x90, 0x00, 0x98,
+    0x01, 0xA0, 0x02, 0xA8, 0x03, 0xB8, 0x04, 0xC0, 0x05, 0xC8, 0x06, 0xD8, 0x00, 0xE0, 0x01, 0xE8,
+    0x02, 0x00, 0x01, 0x08, 0x02, 0x10, 0x03, 0x18, 0x04, 0x28, 0x05, 0x30, 0x06, 0x38, 0x00, 0x48,
+    0x01, 0x50, 0x02, 0x58, 0x03, 0x60, 0x04, 0x70, 0x05, 0x78, 0x06, 0x80, 0x00, 0x90, 0x01, 0x98,
+    0x02, 0xA0, 0x03, 0xA8, 0x04, 0xB8, 0x05, 0xC0, 0x06, 0xC8, 0x00, 0xD8, 0x01, 0xE0, 0x02, 0xE8,
+    0x03, 0x00, 0x02, 0x08, 0x03, 0x10, 0x04, 0x18, 0x05, 0x28, 0x06, 0x30, 0x00, 0x38, 0x01, 0x48,
+    0x02, 0x50, 0x03, 0x58, 0x04, 0x60, 0x05, 0x70, 0x06, 0x78, 0x00, 0x80, 0x01, 0x90, 0x02, 0x98,
+    0x03, 0xA0, 0x04, 0xD1, 0xA8, 0x05, 0xB8, 0x06, 0xC0, 0x00, 0xC8, 0x01, 0xD8, 0x02, 0xE0, 0x03,
+    0xE8, 0x04, 0x00, 0x03, 0x08, 0x04, 0x10, 0x05, 0x18, 0x06, 0x28, 0x00, 0x30, 0x01, 0x38, 0x02,
+    0x48, 0x03, 0x50, 0x04, 0x58, 0x05, 0x60, 0x06, 0x70, 0x00, 0x78, 0x01, 0x80, 0x02, 0x90, 0x03,
+    0x98, 0x04, 0xA0, 0x05, 0xA8, 0x06, 0xB8, 0x00, 0xC0, 0x01, 0xC8, 0x02, 0xD8, 0x03, 0xE0, 0x04,
+    0xE8, 0x05, 0x00, 0x64, 0x08, 0x65, 0x10, 0x66, 0x18, 0x60, 0x28, 0x61, 0x30, 0x62, 0x38, 0x63,
+    0x48, 0x64, 0x50, 0x65, 0x58, 0x66, 0x02, 0x60, 0xAC, 0x70, 0x61, 0x78, 0x62, 0x80, 0x63, 0x90,
+    0x64, 0x98, 0x65, 0xA0, 0x66, 0xA8, 0x60, 0xB8, 0x61, 0xC0, 0x62, 0xC8, 0x63, 0xD8, 0x64, 0xE0,
+    0x65, 0xE8, 0x66, 0x00, 0x65, 0x08, 0x66, 0x10, 0x60, 0x18, 0x61, 0x28, 0x62, 0x30, 0x63, 0x38,
+    0x64, 0x48, 0x65, 0x50, 0x66, 0x58, 0x02, 0x60, 0xFF, 0x61, 0x70, 0x62, 0x78, 0x63, 0x80, 0x64,
+    0x90, 0x65, 0x98, 0x66, 0xA0, 0x60, 0xA8, 0x61, 0xB8, 0x62, 0xC0, 0x63, 0xC8, 0x64, 0xD8, 0x65,
+    0xE0, 0x66, 0xE8, 0x60, 0x00, 0x66, 0x08, 0x60, 0x10, 0x61, 0x18, 0x62, 0x28, 0x63, 0x30, 0x64,
+    0x38, 0x65, 0x48, 0x66, 0x50, 0x60, 0x58, 0x61, 0x60, 0x62, 0x70, 0x63, 0x78, 0x64, 0x80, 0x65,
+    0x90, 0x66, 0x98, 0x60, 0xA0, 0x61, 0xA8, 0x62, 0xB8, 0x63, 0xC0, 0x64, 0xC8, 0x65, 0xD8, 0x66,
+    0xE0, 0x60, 0xE8, 0x61, 0x00, 0x60, 0x08, 0x61, 0x10, 0x62, 0x18, 0x63, 0x28, 0x64, 0x30, 0x65,
+    0x38, 0x66, 0x48, 0x60, 0x50, 0x61, 0x58, 0x62, 0x60, 0x63, 0x70, 0x64, 0x78, 0x65, 0x80, 0x66,
+    0x90, 0x60, 0x98, 0x61, 0xA0, 0x62, 0xA8, 0x63, 0xB8, 0x64, 0xC0, 0x65, 0xC8, 0x66, 0xD8, 0x60,
+    0xE0, 0x61, 0xE8, 0x62, 0x00, 0xE1, 0x08, 0xE2, 0x10, 0xFF, 0xE3, 0x18, 0xE4, 0x28, 0xE5, 0x30,
+    0xE6, 0x38, 0xE0, 0x48, 0xE1, 0x50, 0xE2, 0x58, 0xE3, 0x60, 0xE4, 0x70, 0xE5, 0x78, 0xE6, 0x80,
+    0xE0, 0x90, 0xE1, 0x98, 0xE2, 0xA0, 0xE3, 0xA8, 0xE4, 0xB8, 0xE5, 0xC0, 0xE6, 0xC8, 0xE0, 0xD8,
+    0xE1, 0xE0, 0xE2, 0xE8, 0xE3, 0x00, 0xE2, 0x08, 0xE3, 0x10, 0xE4, 0x18, 0xE5, 0x28, 0xE6, 0x30,
+    0xE0, 0x38, 0xE1, 0x48, 0xE2, 0x50, 0xE3, 0x58, 0xE4, 0x60, 0xE5, 0x70, 0xE6, 0x78, 0xE0, 0x80,
+    0xE1, 0x90, 0xE2, 0x98, 0xE3, 0xA0, 0xE4, 0xA8, 0xE5, 0xB8, 0xE6, 0xC0, 0xE0, 0xC8, 0xE1, 0xD8,
+    0xE2, 0xE0, 0xE3, 0xE8, 0xE4, 0x00, 0xE3, 0x08, 0xE4, 0x10, 0xE5, 0x18, 0xE6, 0x28, 0xE0, 0x30,
+    0xE1, 0x38, 0xE2, 0x48, 0xE3, 0x50, 0xE4, 0x58, 0xE5, 0x60, 0xE6, 0x70, 0xE0, 0x78, 0xE1, 0x80,
+    0xE2, 0x90, 0xE3, 0x98, 0xE4, 0xA0, 0xE5, 0xA8, 0xE6, 0xB8, 0xCE, 0xE0, 0xC0, 0xE1, 0xC8, 0xE2,
+    0xD8, 0xE3, 0xE0, 0xE4, 0xE8, 0xE5, 0x00, 0xE4, 0x08, 0xE5, 0x10, 0xE6, 0x18, 0xE0, 0x28, 0xE1,
+    0x30, 0xE2, 0x38, 0xE3, 0x48, 0xE4, 0x50, 0xE5, 0x58, 0xE6, 0x60, 0xE0, 0x70, 0xE1, 0x78, 0xE2,
+    0x80, 0xE3, 0x90, 0xE4, 0x98, 0xE5, 0xA0, 0xE6, 0xA8, 0xE0, 0xB8, 0xE1, 0xC0, 0xE2, 0xC8, 0xE3,
+    0xD8, 0xE4, 0xE0, 0xE5, 0xE8, 0xE6, 0x01, 0x65, 0x09, 0x66, 0x11, 0x60, 0x19, 0x61, 0x29, 0x62,
+    0x31, 0x63, 0x39, 0x64, 0x49, 0x65, 0x51, 0x66, 0x59, 0x60, 0x02, 0x61, 0xAC, 0x71, 0x62, 0x79,
+    0x63, 0x81, 0x64, 0x91, 0x65, 0x99, 0x66, 0xA1, 0x60, 0xA9, 0x61, 0xB9, 0x62, 0xC1, 0x63, 0xC9,
+    0x64, 0xD9, 0x65, 0xE1, 0x66, 0xE9, 0x60, 0x01, 0x66, 0x09, 0x60, 0x11, 0x61, 0x19, 0x62, 0x29,
+    0x63, 0x31, 0x64, 0x39, 0x65, 0x49, 0x66, 0x51, 0x60, 0x59, 0x02, 0x61, 0xFA, 0x62, 0x71, 0x63,
+    0x79, 0x64, 0x81, 0x65, 0x91, 0x66, 0x99, 0x60, 0xA1, 0x61, 0xA9, 0x62, 0xB9, 0x63, 0xC1, 0x64,
+    0xC9, 0x65, 0xD9, 0x66, 0xE1, 0x60, 0xE9, 0x61, 0x01, 0x60, 0x09, 0x61, 0x11, 0x62, 0x19, 0x63,
+    0x29, 0x64, 0x31, 0x65, 0x39, 0x66, 0x49, 0x60, 0x51, 0x61, 0x59, 0x62, 0x61, 0x63, 0x71, 0x64,
+    0x79, 0x65, 0x81, 0x66, 0x91, 0x60, 0x99, 0x61, 0xA1, 0x62, 0xA9, 0x63, 0xB9, 0x64, 0xC1, 0x65,
+    0xC9, 0x66, 0xD9, 0x60, 0xE1, 0x61, 0xE9, 0x62, 0x01, 0x61, 0x09, 0x62, 0x11, 0x63, 0x19, 0x64,
+    0x29, 0x65, 0x31, 0x66, 0x39, 0x60, 0x49, 0x61, 0x51, 0x62, 0x59, 0x63, 0x61, 0x64, 0x71, 0x65,
+    0x79, 0x66, 0x81, 0x60, 0x91, 0x61, 0x99, 0x62, 0xA1, 0x63, 0xA9, 0x64, 0xB9, 0x65, 0xC1, 0x66,
+    0xC9, 0x60, 0xD9, 0x61, 0xE1, 0x62, 0xE9, 0x63,
+};
+const std::vector<uint8_t> fixture_rgb565_24x16_lz = {
+    0x7F, 0x00, 0x00, 0x08, 0x01, 0x10, 0x02, 0x18, 0x03, 0x28, 0x04, 0x30, 0x05, 0x38, 0x06, 0x48,
+    0x00, 0x50, 0x01, 0x58, 0x02, 0x60, 0x03, 0x70, 0x04, 0x78, 0x05, 0x80, 0x06, 0x90, 0x00, 0x98,
+    0x01, 0xA0, 0x02, 0xA8, 0x03, 0xB8, 0x04, 0xC0, 0x05, 0xC8, 0x06, 0xD8, 0x00, 0xE0, 0x01, 0xE8,
+    0x02, 0x00, 0x01, 0x08, 0x02, 0x10, 0x03, 0x18, 0x04, 0x28, 0x05, 0x30, 0x06, 0x38, 0x00, 0x48,
+    0x01, 0x50, 0x02, 0x58, 0x03, 0x60, 0x04, 0x70, 0x05, 0x78, 0x06, 0x80, 0x00, 0x90, 0x01, 0x98,
+    0x02, 0xA0, 0x03, 0xA8, 0x04, 0xB8, 0x05, 0xC0, 0x06, 0xC8, 0x00, 0xD8, 0x01, 0xE0, 0x02, 0xE8,
+    0x03, 0x00, 0x02, 0x08, 0x03, 0x10, 0x04, 0x18, 0x05, 0x28, 0x06, 0x30, 0x00, 0x38, 0x01, 0x48,
+    0x02, 0x50, 0x03, 0x58, 0x04, 0x60, 0x05, 0x70, 0x06, 0x78, 0x00, 0x80, 0x01, 0x90, 0x02, 0x98,
+    0x03, 0x7F, 0xA0, 0x04, 0xA8, 0x05, 0xB8, 0x06, 0xC0, 0x00, 0xC8, 0x01, 0xD8, 0x02, 0xE0, 0x03,
+    0xE8, 0x04, 0x00, 0x03, 0x08, 0x04, 0x10, 0x05, 0x18, 0x06, 0x28, 0x00, 0x30, 0x01, 0x38, 0x02,
+    0x48, 0x03, 0x50, 0x04, 0x58, 0x05, 0x60, 0x06, 0x70, 0x00, 0x78, 0x01, 0x80, 0x02, 0x90, 0x03,
+    0x98, 0x04, 0xA0, 0x05, 0xA8, 0x06, 0xB8, 0x00, 0xC0, 0x01, 0xC8, 0x02, 0xD8, 0x03, 0xE0, 0x04,
+    0xE8, 0x05, 0x00, 0x64, 0x08, 0x65, 0x10, 0x66, 0x18, 0x60, 0x28, 0x61, 0x30, 0x62, 0x38, 0x63,
+    0x48, 0x64, 0x50, 0x65, 0x58, 0x66, 0x60, 0x60, 0x70, 0x61, 0x78, 0x62, 0x80, 0x63, 0x90, 0x64,
+    0x98, 0x65, 0xA0, 0x66, 0xA8, 0x60, 0xB8, 0x61, 0xC0, 0x62, 0xC8, 0x63, 0xD8, 0x64, 0xE0, 0x65,
+    0xE8, 0x66, 0x00, 0x65, 0x08, 0x66, 0x10, 0x60, 0x18, 0x61, 0x28, 0x62, 0x30, 0x63, 0x38, 0x64,
+    0x48, 0x65, 0x7F, 0x50, 0x66, 0x58, 0x60, 0x60, 0x61, 0x70, 0x62, 0x78, 0x63, 0x80, 0x64, 0x90,
+    0x65, 0x98, 0x66, 0xA0, 0x60, 0xA8, 0x61, 0xB8, 0x62, 0xC0, 0x63, 0xC8, 0x64, 0xD8, 0x65, 0xE0,
+    0x66, 0xE8, 0x60, 0x00, 0x66, 0x08, 0x60, 0x10, 0x61, 0x18, 0x62, 0x28, 0x63, 0x30, 0x64, 0x38,
+    0x65, 0x48, 0x66, 0x50, 0x60, 0x58, 0x61, 0x60, 0x62, 0x70, 0x63, 0x78, 0x64, 0x80, 0x65, 0x90,
+    0x66, 0x98, 0x60, 0xA0, 0x61, 0xA8, 0x62, 0xB8, 0x63, 0xC0, 0x64, 0xC8, 0x65, 0xD8, 0x66, 0xE0,
+    0x60, 0xE8, 0x61, 0x00, 0x60, 0x08, 0x61, 0x10, 0x62, 0x18, 0x63, 0x28, 0x64, 0x30, 0x65, 0x38,
+    0x66, 0x48, 0x60, 0x50, 0x61, 0x58, 0x62, 0x60, 0x63, 0x70, 0x64, 0x78, 0x65, 0x80, 0x66, 0x90,
+    0x60, 0x98, 0x61, 0xA0, 0x62, 0xA8, 0x63, 0xB8, 0x64, 0xC0, 0x65, 0xC8, 0x66, 0xD8, 0x60, 0xE0,
+    0x61, 0xE8, 0x62, 0x7F, 0x00, 0xE1, 0x08, 0xE2, 0x10, 0xE3, 0x18, 0xE4, 0x28, 0xE5, 0x30, 0xE6,
+    0x38, 0xE0, 0x48, 0xE1, 0x50, 0xE2, 0x58, 0xE3, 0x60, 0xE4, 0x70, 0xE5, 0x78, 0xE6, 0x80, 0xE0,
+    0x90, 0xE1, 0x98, 0xE2, 0xA0, 0xE3, 0xA8, 0xE4, 0xB8, 0xE5, 0xC0, 0xE6, 0xC8, 0xE0, 0xD8, 0xE1,
+    0xE0, 0xE2, 0xE8, 0xE3, 0x00, 0xE2, 0x08, 0xE3, 0x10, 0xE4, 0x18, 0xE5, 0x28, 0xE6, 0x30, 0xE0,
+    0x38, 0xE1, 0x48, 0xE2, 0x50, 0xE3, 0x58, 0xE4, 0x60, 0xE5, 0x70, 0xE6, 0x78, 0xE0, 0x80, 0xE1,
+    0x90, 0xE2, 0x98, 0xE3, 0xA0, 0xE4, 0xA8, 0xE5, 0xB8, 0xE6, 0xC0, 0xE0, 0xC8, 0xE1, 0xD8, 0xE2,
+    0xE0, 0xE3, 0xE8, 0xE4, 0x00, 0xE3, 0x08, 0xE4, 0x10, 0xE5, 0x18, 0xE6, 0x28, 0xE0, 0x30, 0xE1,
+    0x38, 0xE2, 0x48, 0xE3, 0x50, 0xE4, 0x58, 0xE5, 0x60, 0xE6, 0x70, 0xE0, 0x78, 0xE1, 0x80, 0xE2,
+    0x90, 0xE3, 0x98, 0xE4, 0x7F, 0xA0, 0xE5, 0xA8, 0xE6, 0xB8, 0xE0, 0xC0, 0xE1, 0xC8, 0xE2, 0xD8,
+    0xE3, 0xE0, 0xE4, 0xE8, 0xE5, 0x00, 0xE4, 0x08, 0xE5, 0x10, 0xE6, 0x18, 0xE0, 0x28, 0xE1, 0x30,
+    0xE2, 0x38, 0xE3, 0x48, 0xE4, 0x50, 0xE5, 0x58, 0xE6, 0x60, 0xE0, 0x70, 0xE1, 0x78, 0xE2, 0x80,
+    0xE3, 0x90, 0xE4, 0x98, 0xE5, 0xA0, 0xE6, 0xA8, 0xE0, 0xB8, 0xE1, 0xC0, 0xE2, 0xC8, 0xE3, 0xD8,
+    0xE4, 0xE0, 0xE5, 0xE8, 0xE6, 0x01, 0x65, 0x09, 0x66, 0x11, 0x60, 0x19, 0x61, 0x29, 0x62, 0x31,
+    0x63, 0x39, 0x64, 0x49, 0x65, 0x51, 0x66, 0x59, 0x60, 0x61, 0x61, 0x71, 0x62, 0x79, 0x63, 0x81,
+    0x64, 0x91, 0x65, 0x99, 0x66, 0xA1, 0x60, 0xA9, 0x61, 0xB9, 0x62, 0xC1, 0x63, 0xC9, 0x64, 0xD9,
+    0x65, 0xE1, 0x66, 0xE9, 0x60, 0x01, 0x66, 0x09, 0x60, 0x11, 0x61, 0x19, 0x62, 0x29, 0x63, 0x31,
+    0x64, 0x39, 0x65, 0x49, 0x66, 0x7F, 0x51, 0x60, 0x59, 0x61, 0x61, 0x62, 0x71, 0x63, 0x79, 0x64,
+    0x81, 0x65, 0x91, 0x66, 0x99, 0x60, 0xA1, 0x61, 0xA9, 0x62, 0xB9, 0x63, 0xC1, 0x64, 0xC9, 0x65,
+    0xD9, 0x66, 0xE1, 0x60, 0xE9, 0x61, 0x01, 0x60, 0x09, 0x61, 0x11, 0x62, 0x19, 0x63, 0x29, 0x64,
+    0x31, 0x65, 0x39, 0x66, 0x49, 0x60, 0x51, 0x61, 0x59, 0x62, 0x61, 0x63, 0x71, 0x64, 0x79, 0x65,
+    0x81, 0x66, 0x91, 0x60, 0x99, 0x61, 0xA1, 0x62, 0xA9, 0x63, 0xB9, 0x64, 0xC1, 0x65, 0xC9, 0x66,
+    0xD9, 0x60, 0xE1, 0x61, 0xE9, 0x62, 0x01, 0x61, 0x09, 0x62, 0x11, 0x63, 0x19, 0x64, 0x29, 0x65,
+    0x31, 0x66, 0x39, 0x60, 0x49, 0x61, 0x51, 0x62, 0x59, 0x63, 0x61, 0x64, 0x71, 0x65, 0x79, 0x66,
+    0x81, 0x60, 0x91, 0x61, 0x99, 0x62, 0xA1, 0x63, 0xA9, 0x64, 0xB9, 0x65, 0xC1, 0x66, 0xC9, 0x60,
+    0xD9, 0x61, 0xE1, 0x62, 0xE9, 0x63,
+};
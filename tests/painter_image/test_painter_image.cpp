@@ -0,0 +1,180 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "test_common.hpp"
+#include "painter_codec_fixtures.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+#include "qp_surface.h"
+#include "qgf.h"
+}
+
+namespace {
+
+constexpr uint16_t surface_width  = 128;
+constexpr uint16_t surface_height = 128;
+
+std::vector<uint8_t> surface_buffer(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(surface_width, surface_height, 16));
+painter_device_t     surface;
+
+struct fixture_t {
+    const char                 *name;
+    const std::vector<uint8_t> &raw, &rle, &lz;
+
+    const std::vector<uint8_t> &encoded(painter_compression_t compression) const {
+        return compression == IMAGE_COMPRESSED_LZ ? lz : rle;
+    }
+};
+
+const fixture_t fixtures[] = {
+    {"mixed", fixture_mixed_raw, fixture_mixed_rle, fixture_mixed_lz},
+    {"pal16_40x32", fixture_pal16_40x32_raw, fixture_pal16_40x32_rle, fixture_pal16_40x32_lz},
+    {"pal16_33x17", fixture_pal16_33x17_raw, fixture_pal16_33x17_rle, fixture_pal16_33x17_lz},
+    {"rgb565_24x16", fixture_rgb565_24x16_raw, fixture_rgb565_24x16_rle, fixture_rgb565_24x16_lz},
+};
+
+void append_header(std::vector<uint8_t> &out, uint8_t type_id, uint32_t length) {
+    out.insert(out.end(), {type_id, (uint8_t)~type_id, (uint8_t)length, (uint8_t)(length >> 8), (uint8_t)(length >> 16)});
+}
+
+// Builds a single-frame QGF image around already-encoded pixel data
+std::vector<uint8_t> make_qgf(uint16_t width, uint16_t height, qp_image_format_t format, painter_compression_t compression, const std::vector<uint8_t> &palette, const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    append_header(out, QGF_GRAPHICS_DESCRIPTOR_TYPEID, 18);
+    out.insert(out.end(), {0x51, 0x47, 0x46, 0x01});
+    out.insert(out.end(), 8, 0); // file size, filled in below
+    out.insert(out.end(), {(uint8_t)width, (uint8_t)(width >> 8), (uint8_t)height, (uint8_t)(height >> 8), 1, 0});
+
+    append_header(out, QGF_FRAME_OFFSET_DESCRIPTOR_TYPEID, sizeof(uint32_t));
+    uint32_t frame_offset = out.size() + sizeof(uint32_t);
+    out.insert(out.end(), {(uint8_t)frame_offset, (uint8_t)(frame_offset >> 8), 0, 0});
+
+    append_header(out, QGF_FRAME_DESCRIPTOR_TYPEID, 6);
+    out.insert(out.end(), {(uint8_t)format, 0, (uint8_t)compression, 0, 0xE8, 0x03});
+
+    if (!palette.empty()) {
+        append_header(out, QGF_FRAME_PALETTE_DESCRIPTOR_TYPEID, palette.size());
+        out.insert(out.end(), palette.begin(), palette.end());
+    }
+
+    append_header(out, QGF_FRAME_DATA_DESCRIPTOR_TYPEID, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+
+    uint32_t total = out.size(), neg_total = ~total;
+    memcpy(&out[sizeof(qgf_block_header_v1_t) + 4], &total, sizeof(total));
+    memcpy(&out[sizeof(qgf_block_header_v1_t) + 8], &neg_total, sizeof(neg_total));
+    return out;
+}
+
+std::vector<uint8_t> make_palette16() {
+    std::vector<uint8_t> palette;
+    for (int i = 0; i < 16; i++) {
+        palette.insert(palette.end(), {(uint8_t)(i * 16), (uint8_t)(i ? 255 : 0), (uint8_t)(255 - i * 8)});
+    }
+    return palette;
+}
+
+std::vector<uint16_t> draw(const std::vector<uint8_t> &qgf) {
+    std::fill(surface_buffer.begin(), surface_buffer.end(), 0x55);
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    EXPECT_NE(image, nullptr);
+    if (image) {
+        EXPECT_TRUE(qp_drawimage(surface, 3, 5, image));
+        qp_close_image(image);
+    }
+    const uint16_t *pixels = reinterpret_cast<const uint16_t *>(surface_buffer.data());
+    return std::vector<uint16_t>(pixels, pixels + surface_width * surface_height);
+}
+
+// Decodes a whole buffer through the given block decoder, using awkward block sizes to cross as many run boundaries as possible
+std::vector<uint8_t> block_decode(const std::vector<uint8_t> &encoded, painter_compression_t compression, size_t length) {
+    qp_memory_stream_t               stream = qp_make_memory_stream((void *)encoded.data(), encoded.size());
+    qp_internal_byte_input_state_t   state  = {.device = surface, .src_stream = &stream.base};
+    qp_internal_block_input_callback input  = qp_internal_prepare_block_input_state(&state, compression);
+    std::vector<uint8_t>             out(length);
+    for (size_t pos = 0, step = 1; pos < length; pos += step, step = step % 37 + 1) {
+        step = std::min(step, length - pos);
+        EXPECT_EQ(input(&state, &out[pos], step), step);
+    }
+    return out;
+}
+
+std::vector<uint8_t> byte_decode(const std::vector<uint8_t> &encoded, painter_compression_t compression, size_t length) {
+    qp_memory_stream_t              stream = qp_make_memory_stream((void *)encoded.data(), encoded.size());
+    qp_internal_byte_input_state_t  state  = {.device = surface, .src_stream = &stream.base};
+    qp_internal_byte_input_callback input  = qp_internal_prepare_input_state(&state, compression);
+    std::vector<uint8_t>            out;
+    for (size_t i = 0; i < length; i++) {
+        out.push_back(input(&state));
+    }
+    return out;
+}
+
+class PainterImage : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!surface) {
+            surface = qp_make_rgb565_surface(surface_width, surface_height, surface_buffer.data());
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+};
+
+} // namespace
+
+TEST_F(PainterImage, DecodersMatchRawData) {
+    for (auto &fixture : fixtures) {
+        SCOPED_TRACE(fixture.name);
+        for (auto compression : {IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ}) {
+            auto &encoded = fixture.encoded(compression);
+            EXPECT_EQ(byte_decode(encoded, compression, fixture.raw.size()), fixture.raw) << "byte decoder, compression " << compression;
+            EXPECT_EQ(block_decode(encoded, compression, fixture.raw.size()), fixture.raw) << "block decoder, compression " << compression;
+        }
+    }
+}
+
+TEST_F(PainterImage, TruncatedDataFails) {
+    auto &raw     = fixture_pal16_40x32_raw;
+    auto  encoded = fixture_pal16_40x32_lz;
+    encoded.resize(encoded.size() / 2);
+
+    qp_memory_stream_t               stream = qp_make_memory_stream(encoded.data(), encoded.size());
+    qp_internal_byte_input_state_t   state  = {.device = surface, .src_stream = &stream.base};
+    qp_internal_block_input_callback input  = qp_internal_prepare_block_input_state(&state, IMAGE_COMPRESSED_LZ);
+    std::vector<uint8_t>             out(raw.size());
+    EXPECT_LT(input(&state, out.data(), out.size()), out.size());
+
+    auto qgf   = make_qgf(40, 32, PALETTE_4BPP, IMAGE_COMPRESSED_LZ, make_palette16(), encoded);
+    auto image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_FALSE(qp_drawimage(surface, 0, 0, image));
+    qp_close_image(image);
+}
+
+TEST_F(PainterImage, CompressionsRenderIdentically) {
+    struct {
+        uint16_t             width, height;
+        qp_image_format_t    format;
+        std::vector<uint8_t> palette;
+        const fixture_t     &fixture;
+    } images[] = {
+        {40, 32, PALETTE_4BPP, make_palette16(), fixtures[1]},
+        {33, 17, PALETTE_4BPP, make_palette16(), fixtures[2]}, // odd pixel count leaves half a byte unused
+        {40, 32, GRAYSCALE_4BPP, {}, fixtures[1]},
+        {24, 16, RGB565_16BPP, {}, fixtures[3]},
+    };
+
+    for (auto &image : images) {
+        SCOPED_TRACE(image.fixture.name);
+        auto expected = draw(make_qgf(image.width, image.height, image.format, IMAGE_UNCOMPRESSED, image.palette, image.fixture.raw));
+        for (auto compression : {IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ}) {
+            auto actual = draw(make_qgf(image.width, image.height, image.format, compression, image.palette, image.fixture.encoded(compression)));
+            EXPECT_TRUE(actual == expected) << "format " << image.format << " compression " << compression;
+        }
+    }
+}
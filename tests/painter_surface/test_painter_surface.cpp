@@ -0,0 +1,256 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+#include "qp_surface.h"
+#include "qp_surface_internal.h"
+}
+
+namespace {
+
+constexpr uint16_t panel_width  = 240;
+constexpr uint16_t panel_height = 320;
+
+// What an ILI9341 sends to set up a window: CASET and RASET with their four data bytes each, then RAMWR
+constexpr uint32_t viewport_bytes = 11;
+
+struct transfer_stats {
+    uint32_t viewports = 0;
+    uint32_t bytes     = 0;
+    uint32_t single    = 0; // bytes a single bounding box around every change would have needed
+};
+
+transfer_stats stats;
+
+// Counts everything sent to the panel before handing it to the dummy comms driver
+uint32_t counting_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    stats.bytes += byte_count;
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+bool panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+bool panel_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+bool panel_clear(painter_device_t device) {
+    return true;
+}
+
+bool panel_flush(painter_device_t device) {
+    return true;
+}
+
+bool panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint8_t window[viewport_bytes] = {0x2A, (uint8_t)(left >> 8), (uint8_t)left, (uint8_t)(right >> 8), (uint8_t)right, 0x2B, (uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(bottom >> 8), (uint8_t)bottom, 0x2C};
+    stats.viewports++;
+    return qp_comms_send(device, window, sizeof(window)) == sizeof(window);
+}
+
+bool panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    return qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t)) == native_pixel_count * sizeof(uint16_t);
+}
+
+bool panel_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    return true;
+}
+
+bool panel_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    return true;
+}
+
+bool panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return true;
+}
+
+const painter_driver_vtable_t panel_driver_vtable = {
+    .init            = panel_init,
+    .power           = panel_power,
+    .clear           = panel_clear,
+    .flush           = panel_flush,
+    .viewport        = panel_viewport,
+    .pixdata         = panel_pixdata,
+    .palette_convert = panel_palette_convert,
+    .append_pixels   = panel_append_pixels,
+    .append_pixdata  = panel_append_pixdata,
+};
+
+painter_comms_vtable_t panel_comms_vtable;
+painter_driver_t       panel;
+
+std::vector<uint8_t> surface_buffer(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, 16));
+std::vector<uint8_t> shadow_buffer(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, 16));
+painter_device_t     surface;
+
+// Bytes the transfer would have taken with a single bounding box around every change
+uint32_t single_region_bytes(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return viewport_bytes + (uint32_t)(r - l + 1) * (b - t + 1) * sizeof(uint16_t);
+}
+
+// Stand-in for text: clears the widget background, then draws one bar per digit with a height depending on its value
+void draw_widget(uint16_t left, uint16_t top, uint32_t value, uint8_t digits) {
+    qp_rect(surface, left, top, left + digits * 12 - 1, top + 15, 0, 0, 0, true);
+    for (uint8_t i = 0; i < digits; i++) {
+        uint8_t  digit = value % 10;
+        uint16_t x     = left + (digits - 1 - i) * 12;
+        qp_rect(surface, x + 2, top + 15 - digit, x + 9, top + 15, 0, 0, 255, true);
+        value /= 10;
+    }
+}
+
+transfer_stats draw_to_panel(bool entire_surface = false) {
+    auto dirty = ((surface_painter_device_t *)surface)->dirty;
+    stats      = {};
+    if (dirty.is_dirty) {
+        stats.single = entire_surface ? single_region_bytes(0, 0, panel_width - 1, panel_height - 1) : single_region_bytes(dirty.l, dirty.t, dirty.r, dirty.b);
+    }
+    EXPECT_TRUE(qp_surface_draw(surface, &panel, 0, 0, entire_surface));
+    return stats;
+}
+
+class PainterSurface : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!surface) {
+            panel_comms_vtable            = dummy_comms_vtable;
+            panel_comms_vtable.comms_send = counting_comms_send;
+            panel.driver_vtable           = &panel_driver_vtable;
+            panel.comms_vtable            = &panel_comms_vtable;
+            panel.panel_width             = panel_width;
+            panel.panel_height            = panel_height;
+            panel.native_bits_per_pixel   = 16;
+            surface                       = qp_make_rgb565_surface(panel_width, panel_height, surface_buffer.data());
+        }
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_surface_set_shadow_buffer(surface, nullptr));
+    }
+
+    // Brings the panel up to date with a freshly initialised surface
+    void initial_draw() {
+        auto initial = draw_to_panel();
+        EXPECT_EQ(initial.viewports, 1);
+        EXPECT_EQ(initial.bytes, single_region_bytes(0, 0, panel_width - 1, panel_height - 1));
+    }
+};
+
+} // namespace
+
+TEST_F(PainterSurface, NothingToSend) {
+    initial_draw();
+    auto idle = draw_to_panel();
+    EXPECT_EQ(idle.viewports, 0);
+    EXPECT_EQ(idle.bytes, 0);
+}
+
+TEST_F(PainterSurface, OppositeCornersAreSentSeparately) {
+    initial_draw();
+
+    // Clock in the top left, WPM in the bottom right
+    draw_widget(4, 4, 1234, 4);
+    draw_widget(200, 300, 87, 3);
+    auto sent = draw_to_panel();
+
+    // Bars far enough apart within a widget may get their own regions too, but nothing spans the gap between widgets
+    EXPECT_GE(sent.viewports, 2);
+    EXPECT_LE(sent.viewports, SURFACE_DIRTY_REGIONS);
+    EXPECT_LT(sent.bytes * 50, sent.single);
+}
+
+TEST_F(PainterSurface, NearbyChangesAreMerged) {
+    initial_draw();
+
+    // Adjacent pixels grow the same region rather than starting new ones
+    for (uint16_t x = 10; x < 30; x++) {
+        qp_setpixel(surface, x, 10, 0, 0, 255);
+        qp_setpixel(surface, x, 12, 0, 0, 255);
+    }
+    auto sent = draw_to_panel();
+    EXPECT_EQ(sent.viewports, 1);
+    EXPECT_EQ(sent.bytes, single_region_bytes(10, 10, 29, 12));
+}
+
+TEST_F(PainterSurface, RegionsAreLimited) {
+    initial_draw();
+
+    // More scattered changes than regions available still get everything to the panel
+    for (uint16_t i = 0; i < SURFACE_DIRTY_REGIONS * 2; i++) {
+        qp_setpixel(surface, (i * 97) % panel_width, (i * 151) % panel_height, 0, 0, 255);
+    }
+    auto sent = draw_to_panel();
+    EXPECT_GE(sent.viewports, 1);
+    EXPECT_LE(sent.viewports, SURFACE_DIRTY_REGIONS);
+    EXPECT_LE(sent.bytes, single_region_bytes(0, 0, panel_width - 1, panel_height - 1) + (SURFACE_DIRTY_REGIONS - 1) * viewport_bytes);
+}
+
+TEST_F(PainterSurface, EntireSurfaceSendsEverything) {
+    initial_draw();
+    qp_setpixel(surface, 0, 0, 0, 0, 255);
+    auto sent = draw_to_panel(true);
+    EXPECT_EQ(sent.viewports, 1);
+    EXPECT_EQ(sent.bytes, single_region_bytes(0, 0, panel_width - 1, panel_height - 1));
+}
+
+TEST_F(PainterSurface, ShadowSkipsUnchangedRedraws) {
+    ASSERT_TRUE(qp_surface_set_shadow_buffer(surface, shadow_buffer.data()));
+    initial_draw();
+    draw_widget(4, 4, 1234, 4);
+    draw_to_panel();
+
+    // The widget is cleared and drawn again with the same value
+    draw_widget(4, 4, 1234, 4);
+    auto same = draw_to_panel();
+    EXPECT_EQ(same.viewports, 0);
+    EXPECT_EQ(same.bytes, 0);
+
+    // Only the last digit changes, so only it is sent
+    draw_widget(4, 4, 1235, 4);
+    auto changed = draw_to_panel();
+    EXPECT_EQ(changed.viewports, 1);
+    EXPECT_EQ(changed.bytes, single_region_bytes(4 + 36 + 2, 4 + 15 - 5, 4 + 36 + 9, 4 + 15 - 5));
+}
+
+TEST_F(PainterSurface, ShadowRequiresEntireTransfer) {
+    ASSERT_TRUE(qp_surface_set_shadow_buffer(surface, shadow_buffer.data()));
+    qp_flush(surface);
+
+    // Without the initial transfer, the shadow can't be trusted
+    draw_widget(4, 4, 1234, 4);
+    draw_widget(4, 4, 1234, 4);
+    auto sent = draw_to_panel();
+    EXPECT_EQ(sent.viewports, 1);
+    EXPECT_EQ(sent.bytes, sent.single);
+}
+
+TEST_F(PainterSurface, WidgetUpdatesSendLess) {
+    // A minute of a clock ticking every second with WPM updating alongside, the way a status display behaves
+    auto run = [this](bool shadow) {
+        SetUp();
+        EXPECT_TRUE(qp_surface_set_shadow_buffer(surface, shadow ? shadow_buffer.data() : nullptr));
+        initial_draw();
+        uint32_t bytes = 0, single = 0;
+        for (uint32_t second = 0; second < 60; second++) {
+            draw_widget(4, 4, 1200 + second, 4);
+            draw_widget(200, 300, 60 + (second * 7) % 40, 3);
+            auto sent = draw_to_panel();
+            bytes += sent.bytes;
+            single += sent.single;
+        }
+        return std::make_pair(bytes, single);
+    };
+
+    auto regions  = run(false);
+    auto shadowed = run(true);
+    EXPECT_LT(regions.first, regions.second);
+    EXPECT_LT(shadowed.first, regions.first);
+}
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 32
+#define QUANTUM_PAINTER_GLYPH_CACHE_ARENA_SIZE 256
+#define QUANTUM_PAINTER_TEXTWIDTH_CACHE_SIZE 4
@@ -0,0 +1,240 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qff.h"
+#include "thintel15.qff.h"
+}
+
+namespace {
+
+constexpr uint16_t surface_width  = 240;
+constexpr uint16_t surface_height = 16;
+
+std::vector<uint8_t> surface_buffer(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(surface_width, surface_height, 16));
+painter_device_t     surface;
+
+struct glyph_data {
+    uint8_t              width;
+    std::vector<uint8_t> pixels; // uncompressed 1bpp, least significant bit first
+};
+
+// Pulls the glyphs out of the ascii table of the test font, independently of Quantum Painter
+std::vector<glyph_data> extract_glyphs() {
+    const uint8_t *font        = font_thintel15;
+    const uint8_t  line_height = font[17];
+    const size_t   data_start  = sizeof(qff_font_descriptor_v1_t) + sizeof(qff_ascii_glyph_table_v1_t) + sizeof(qgf_block_header_v1_t);
+
+    std::vector<glyph_data> glyphs;
+    for (int i = 0; i < 95; i++) {
+        const uint8_t *entry  = &font[sizeof(qff_font_descriptor_v1_t) + sizeof(qgf_block_header_v1_t) + i * 3];
+        uint32_t       value  = entry[0] | (entry[1] << 8) | (entry[2] << 16);
+        uint8_t        width  = value & QFF_GLYPH_WIDTH_MASK;
+        uint32_t       offset = (value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS;
+        size_t         length = (width * line_height + 7) / 8;
+        glyphs.push_back({width, std::vector<uint8_t>(&font[data_start + offset], &font[data_start + offset + length])});
+    }
+    return glyphs;
+}
+
+void append24(std::vector<uint8_t> &out, uint32_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back((value >> 8) & 0xFF);
+    out.push_back((value >> 16) & 0xFF);
+}
+
+// Rebuilds the test font with every glyph in the unicode table and RLE-compressed pixel data, the slowest combination to look up and decode
+std::vector<uint8_t> make_unicode_rle_font() {
+    auto glyphs = extract_glyphs();
+
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> table;
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        append24(table, 0x20 + i);
+        append24(table, glyphs[i].width | (data.size() << QFF_GLYPH_WIDTH_BITS));
+
+        // Literal runs, interrupted by runs of repeated bytes
+        auto &pixels = glyphs[i].pixels;
+        for (size_t pos = 0; pos < pixels.size();) {
+            size_t repeat = 1;
+            while (pos + repeat < pixels.size() && repeat < 127 && pixels[pos + repeat] == pixels[pos]) {
+                repeat++;
+            }
+            if (repeat >= 2) {
+                data.push_back(repeat);
+                data.push_back(pixels[pos]);
+                pos += repeat;
+                continue;
+            }
+            size_t literal = 1;
+            while (pos + literal < pixels.size() && literal < 128 && !(pos + literal + 1 < pixels.size() && pixels[pos + literal] == pixels[pos + literal + 1])) {
+                literal++;
+            }
+            data.push_back(127 + literal);
+            data.insert(data.end(), &pixels[pos], &pixels[pos + literal]);
+            pos += literal;
+        }
+    }
+
+    std::vector<uint8_t> font(font_thintel15, font_thintel15 + sizeof(qff_font_descriptor_v1_t));
+    font[18] = 0;                    // has_ascii_table
+    font[19] = glyphs.size() & 0xFF; // num_unicode_glyphs
+    font[20] = glyphs.size() >> 8;
+    font[23] = IMAGE_COMPRESSED_RLE;
+
+    font.insert(font.end(), {QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, (uint8_t)~QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID});
+    append24(font, table.size());
+    font.insert(font.end(), table.begin(), table.end());
+
+    const uint8_t *data_header = &font_thintel15[sizeof(qff_font_descriptor_v1_t) + sizeof(qff_ascii_glyph_table_v1_t)];
+    font.insert(font.end(), {data_header[0], data_header[1]});
+    append24(font, data.size());
+    font.insert(font.end(), data.begin(), data.end());
+
+    uint32_t total = font.size();
+    memcpy(&font[9], &total, sizeof(total));
+    total = ~total;
+    memcpy(&font[13], &total, sizeof(total));
+    return font;
+}
+
+uint16_t *surface_pixels() {
+    return reinterpret_cast<uint16_t *>(surface_buffer.data());
+}
+
+void clear_surface() {
+    std::fill(surface_buffer.begin(), surface_buffer.end(), 0x55);
+}
+
+// What qp_drawtext() should produce, white on black, worked out from the glyph data directly
+std::vector<uint16_t> expected_render(uint16_t x, uint16_t y, const std::string &str) {
+    static auto           glyphs      = extract_glyphs();
+    const uint8_t         line_height = font_thintel15[17];
+    std::vector<uint16_t> pixels(surface_pixels(), surface_pixels() + surface_width * surface_height);
+    for (char c : str) {
+        auto &glyph = glyphs[c - 0x20];
+        for (uint32_t i = 0; i < (uint32_t)glyph.width * line_height; i++) {
+            bool set                                                            = glyph.pixels[i / 8] & (1 << (i % 8));
+            pixels[(y + i / glyph.width) * surface_width + x + i % glyph.width] = set ? 0xFFFF : 0x0000;
+        }
+        x += glyph.width;
+    }
+    return pixels;
+}
+
+::testing::AssertionResult renders_correctly(painter_font_handle_t font, uint16_t x, uint16_t y, const std::string &str) {
+    clear_surface();
+    auto    expected = expected_render(x, y, str);
+    int16_t width    = qp_drawtext(surface, x, y, font, str.c_str());
+    if (width != qp_textwidth(font, str.c_str())) {
+        return ::testing::AssertionFailure() << "drawn width " << width << " differs from qp_textwidth()";
+    }
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (surface_pixels()[i] != expected[i]) {
+            return ::testing::AssertionFailure() << "\"" << str << "\" differs at (" << i % surface_width << ", " << i / surface_width << ")";
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
+class PainterText : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!surface) {
+            surface = qp_make_rgb565_surface(surface_width, surface_height, surface_buffer.data());
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        unicode_font_data = make_unicode_rle_font();
+        ascii_font        = qp_load_font_mem(font_thintel15);
+        unicode_font      = qp_load_font_mem(unicode_font_data.data());
+        ASSERT_NE(ascii_font, nullptr);
+        ASSERT_NE(unicode_font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(ascii_font);
+        qp_close_font(unicode_font);
+    }
+
+    std::vector<uint8_t>  unicode_font_data;
+    painter_font_handle_t ascii_font;
+    painter_font_handle_t unicode_font;
+};
+
+const std::string every_glyph = [] {
+    std::string str;
+    for (char c = 0x20; c < 0x7F; c++) {
+        str += c;
+    }
+    return str;
+}();
+
+} // namespace
+
+TEST_F(PainterText, RepeatedDrawsMatch) {
+    for (auto font : {ascii_font, unicode_font}) {
+        for (int pass = 0; pass < 3; pass++) {
+            EXPECT_TRUE(renders_correctly(font, 3, 2, "WPM: 123"));
+            EXPECT_TRUE(renders_correctly(font, 0, 0, "12:34:56"));
+        }
+    }
+}
+
+TEST_F(PainterText, MoreGlyphsThanTheCacheHolds) {
+    // Cycles through every glyph in chunks, evicting cached glyphs and overflowing the pixel arena along the way
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t start = 0; start < every_glyph.size(); start += 30) {
+            auto chunk = every_glyph.substr(start, 30);
+            EXPECT_TRUE(renders_correctly(ascii_font, 1, 1, chunk));
+            EXPECT_TRUE(renders_correctly(unicode_font, 1, 1, chunk));
+        }
+    }
+}
+
+TEST_F(PainterText, CachedTextSkipsFontData) {
+    const char *hud = "Layer: 1";
+    EXPECT_TRUE(renders_correctly(unicode_font, 4, 4, hud));
+
+    // With everything cached, neither the glyph tables nor the pixel data are needed anymore
+    int16_t width = qp_textwidth(unicode_font, hud);
+    std::fill(unicode_font_data.begin() + sizeof(qff_font_descriptor_v1_t), unicode_font_data.end(), 0xAA);
+    EXPECT_TRUE(renders_correctly(unicode_font, 4, 4, hud));
+    EXPECT_EQ(qp_textwidth(unicode_font, hud), width);
+}
+
+TEST_F(PainterText, TextWidth) {
+    auto glyphs   = extract_glyphs();
+    auto expected = [&](const std::string &str) {
+        int16_t width = 0;
+        for (char c : str) {
+            width += glyphs[c - 0x20].width;
+        }
+        return width;
+    };
+
+    // More distinct strings than the width cache holds, some longer than it will store
+    for (int pass = 0; pass < 3; pass++) {
+        for (auto str : {"a", "WPM", "12:34", "Caps Lock", "A much longer string than is cached", "", "WPM: 100"}) {
+            EXPECT_EQ(qp_textwidth(ascii_font, str), expected(str)) << str;
+            EXPECT_EQ(qp_textwidth(unicode_font, str), expected(str)) << str;
+        }
+    }
+
+    // A font loaded into the same slot doesn't see the previous font's widths
+    qp_close_font(ascii_font);
+    ascii_font = qp_load_font_mem(font_thintel15);
+    EXPECT_EQ(qp_textwidth(ascii_font, "WPM"), expected("WPM"));
+}
+
+TEST_F(PainterText, MissingGlyph) {
+    EXPECT_EQ(qp_textwidth(unicode_font, "é"), 0);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, unicode_font, "é"), 0);
+    EXPECT_TRUE(renders_correctly(unicode_font, 0, 0, "still ok"));
+}
@@ -0,0 +1,14 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_MOTION_PIPELINE
+#define POINTING_DEVICE_MOTION_STATS
+#define POINTING_DEVICE_TASK_THROTTLE_MS 8
+// Does not divide 256, so truncating every sample would lose scrolling
+#define POINTING_DEVICE_SCROLL_DIVISOR 6
+#define POINTING_DEVICE_ACCEL_CURVE \
+    { 256, 256, 512, 768 }
@@ -0,0 +1,218 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <deque>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+namespace {
+
+// A sensor moving at a steady speed, given in 1/16ths of a count per millisecond. Like a real sensor it adds up
+// motion between reads and reports whole counts. Samples queued in `once` are returned first, one per read.
+struct SyntheticSensor {
+    int32_t                    vx = 0, vy = 0;
+    int32_t                    x = 0, y = 0;
+    uint32_t                   last_read = 0;
+    std::deque<report_mouse_t> once;
+    uint32_t                   reads   = 0;
+    int32_t                    moved_x = 0, moved_y = 0;
+
+    report_mouse_t read(report_mouse_t report) {
+        reads++;
+        uint32_t now = timer_read32();
+        if (!once.empty()) {
+            report = once.front();
+            once.pop_front();
+            moved_x += report.x;
+            moved_y += report.y;
+            last_read = now;
+            return report;
+        }
+        int32_t nx = x + vx * (int32_t)(now - last_read);
+        int32_t ny = y + vy * (int32_t)(now - last_read);
+        report.x   = nx / 16 - x / 16;
+        report.y   = ny / 16 - y / 16;
+        x          = nx;
+        y          = ny;
+        moved_x += report.x;
+        moved_y += report.y;
+        last_read = now;
+        return report;
+    }
+};
+
+SyntheticSensor sensor;
+uint16_t        gain_override = 0;
+
+} // namespace
+
+extern "C" {
+report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    return sensor.read(mouse_report);
+}
+
+uint16_t pointing_device_motion_gain_user(uint16_t speed, uint16_t gain) {
+    return gain_override ? gain_override : gain;
+}
+}
+
+class PointingDeviceMotion : public TestFixture {
+   protected:
+    std::vector<report_mouse_t> reports;
+
+    void SetUp() override {
+        sensor           = SyntheticSensor();
+        sensor.last_read = timer_read32();
+        gain_override    = 0;
+        pointing_device_set_scroll_mode(false);
+        pointing_device_motion_clear();
+        clear_pointing_device_motion_stats();
+    }
+
+    void TearDown() override {
+        // Stop moving before the fixture runs the keyboard without a mouse report expected
+        sensor = SyntheticSensor();
+        pointing_device_motion_clear();
+        TestFixture::TearDown();
+    }
+
+    void record_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly(Invoke([this](report_mouse_t &report) { reports.push_back(report); }));
+    }
+
+    /* Stops the sensor and runs the keyboard until everything it read has been reported. */
+    void stop(void) {
+        sensor.vx = sensor.vy = 0;
+        idle_for(2 * POINTING_DEVICE_TASK_THROTTLE_MS);
+    }
+
+    struct Total {
+        int32_t x, y, h, v;
+    };
+
+    Total total(void) {
+        Total total = {};
+        for (auto &report : reports) {
+            total.x += report.x;
+            total.y += report.y;
+            total.h += report.h;
+            total.v += report.v;
+        }
+        return total;
+    }
+};
+
+TEST_F(PointingDeviceMotion, AccelerationCurveInterpolates) {
+    EXPECT_EQ(pointing_device_motion_get_gain(0), 256);
+    EXPECT_EQ(pointing_device_motion_get_gain(3), 256);
+    EXPECT_EQ(pointing_device_motion_get_gain(6), 384);
+    EXPECT_EQ(pointing_device_motion_get_gain(8), 512);
+    EXPECT_EQ(pointing_device_motion_get_gain(10), 640);
+    EXPECT_EQ(pointing_device_motion_get_gain(12), 768);
+    EXPECT_EQ(pointing_device_motion_get_gain(1000), 768);
+}
+
+TEST_F(PointingDeviceMotion, SensorIsReadBetweenReports) {
+    TestDriver driver;
+    record_reports(driver);
+
+    // 2 counts per millisecond, read every millisecond and reported every 8
+    sensor.vx = 2 * 16;
+    idle_for(80);
+    EXPECT_EQ(sensor.reads, 80);
+    stop();
+
+    EXPECT_GE(reports.size(), 10);
+    EXPECT_LE(reports.size(), 11);
+    for (auto &report : reports) {
+        EXPECT_LE(report.x, 16);
+        EXPECT_EQ(report.y, 0);
+    }
+    EXPECT_EQ(total().x, sensor.moved_x);
+
+    pointing_device_motion_stats_t stats;
+    get_pointing_device_motion_stats(&stats);
+    EXPECT_EQ(stats.samples, sensor.reads);
+    EXPECT_EQ(stats.motion_samples, 79);
+    EXPECT_EQ(stats.reports, reports.size());
+    EXPECT_EQ(stats.sample_period_max, 1);
+    EXPECT_EQ(stats.report_period_max, 8);
+    EXPECT_LE(stats.latency_max, 8);
+}
+
+TEST_F(PointingDeviceMotion, FractionsAreCarriedOver) {
+    TestDriver driver;
+    record_reports(driver);
+
+    // A quarter count per count, which truncating every sample would turn into no motion at all
+    gain_override = 64;
+    sensor.vx     = 16;
+    sensor.vy     = -16;
+    idle_for(400);
+    stop();
+
+    EXPECT_EQ(sensor.moved_x, 399);
+    EXPECT_EQ(total().x, sensor.moved_x / 4);
+    EXPECT_EQ(total().y, sensor.moved_y / 4);
+}
+
+TEST_F(PointingDeviceMotion, FastMotionIsAccelerated) {
+    TestDriver driver;
+    record_reports(driver);
+
+    // 6 counts per millisecond is halfway up the second step of the curve
+    sensor.vx = 6 * 16;
+    idle_for(80);
+    EXPECT_EQ(pointing_device_motion_get_speed(), 6);
+    stop();
+
+    int32_t accelerated = sensor.moved_x * 3 / 2;
+    EXPECT_EQ(total().x, accelerated);
+
+    pointing_device_motion_stats_t stats;
+    get_pointing_device_motion_stats(&stats);
+    EXPECT_EQ(stats.stage_counts[POINTING_DEVICE_STAGE_READ], sensor.moved_x);
+    EXPECT_EQ(stats.stage_counts[POINTING_DEVICE_STAGE_ORIENT], sensor.moved_x);
+    EXPECT_EQ(stats.stage_counts[POINTING_DEVICE_STAGE_ACCEL], accelerated);
+    EXPECT_EQ(stats.stage_counts[POINTING_DEVICE_STAGE_REPORT], accelerated);
+}
+
+TEST_F(PointingDeviceMotion, MotionBeyondReportRangeGoesIntoNextReport) {
+    gain_override = 256;
+    pointing_device_motion_add({.x = 100});
+    pointing_device_motion_add({.x = 100});
+
+    EXPECT_EQ(pointing_device_motion_split({}).x, XY_REPORT_MAX);
+    EXPECT_EQ(pointing_device_motion_split({}).x, 200 - XY_REPORT_MAX);
+    EXPECT_EQ(pointing_device_motion_split({}).x, 0);
+
+    pointing_device_motion_stats_t stats;
+    get_pointing_device_motion_stats(&stats);
+    EXPECT_EQ(stats.clamped, 1);
+}
+
+TEST_F(PointingDeviceMotion, ScrollModeDividesMotion) {
+    TestDriver driver;
+    record_reports(driver);
+
+    pointing_device_set_scroll_mode(true);
+    sensor.vx = 16;
+    sensor.vy = -16;
+    idle_for(601);
+    stop();
+    pointing_device_set_scroll_mode(false);
+    EXPECT_EQ(sensor.moved_x, 600);
+
+    // One step per POINTING_DEVICE_SCROLL_DIVISOR counts, with the same signs as the drag scroll examples
+    EXPECT_EQ(total().x, 0);
+    EXPECT_EQ(total().y, 0);
+    EXPECT_EQ(total().h, sensor.moved_x / POINTING_DEVICE_SCROLL_DIVISOR);
+    EXPECT_EQ(total().v, sensor.moved_y / POINTING_DEVICE_SCROLL_DIVISOR);
+}
@@ -0,0 +1,106 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// process_last_key, process_repeat_key, process_record_kb, process_caps_word
+// and process_space_cadet look at every key
+static const uint32_t handlers_for_every_key = 5;
+
+static bool block_grave_escape = false;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    return !(block_grave_escape && keycode == QK_GRAVE_ESCAPE);
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   protected:
+    void SetUp() override {
+        block_grave_escape = false;
+        process_record_handler_invocations_reset();
+    }
+};
+
+TEST_F(ProcessRecordDispatch, AlphaKeyOnlyVisitsHandlersThatSeeEveryKey) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(process_record_handler_invocations(), 2 * handlers_for_every_key);
+    EXPECT_LT(handlers_for_every_key, process_record_handler_count());
+}
+
+TEST_F(ProcessRecordDispatch, PressOnlyHandlerIsSkippedOnRelease) {
+    TestDriver driver;
+    KeymapKey  key_up = KeymapKey(0, 0, 0, DT_UP);
+    set_keymap({key_up});
+
+    uint16_t term = g_tapping_term;
+    EXPECT_NO_REPORT(driver);
+
+    // Handled on press, so the handlers after it do not run
+    key_up.press();
+    run_one_scan_loop();
+    EXPECT_EQ(g_tapping_term, term + DYNAMIC_TAPPING_TERM_INCREMENT);
+    EXPECT_EQ(process_record_handler_invocations(), handlers_for_every_key);
+
+    // Not called at all on release
+    key_up.release();
+    run_one_scan_loop();
+    EXPECT_EQ(process_record_handler_invocations(), 2 * handlers_for_every_key);
+    VERIFY_AND_CLEAR(driver);
+
+    g_tapping_term = term;
+}
+
+TEST_F(ProcessRecordDispatch, RangedHandlerRunsAfterEarlierHandlers) {
+    TestDriver driver;
+    KeymapKey  key_grave_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    KeymapKey  key_lower     = KeymapKey(0, 1, 0, QK_TRI_LAYER_LOWER);
+    set_keymap({key_grave_esc, key_lower, KeymapKey(1, 1, 0, KC_TRNS)});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_grave_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    // process_record_kb runs first and can still swallow the key
+    block_grave_escape = true;
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_grave_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    key_lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, HandlerInvocationsPerEvent) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    const int taps = 100;
+    for (int i = 0; i < taps; i++) {
+        tap_key(i % 2 ? key_a : key_b);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(process_record_handler_invocations(), 2 * taps * handlers_for_every_key);
+}
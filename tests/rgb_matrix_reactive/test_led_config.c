@@ -0,0 +1,54 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+#define LED_X(col) ((col)*224 / (MATRIX_COLS - 1))
+#define LED_Y(row) ((row)*64 / (MATRIX_ROWS - 1))
+
+// clang-format off
+#define LED_ROW(row) \
+    {LED_X(0), LED_Y(row)}, {LED_X(1), LED_Y(row)}, {LED_X(2), LED_Y(row)}, {LED_X(3), LED_Y(row)}, {LED_X(4), LED_Y(row)}, \
+    {LED_X(5), LED_Y(row)}, {LED_X(6), LED_Y(row)}, {LED_X(7), LED_Y(row)}, {LED_X(8), LED_Y(row)}, {LED_X(9), LED_Y(row)}
+
+led_config_t g_led_config = {
+    {
+        { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9},
+        {10, 11, 12, 13, 14, 15, 16, 17, 18, 19},
+        {20, 21, 22, 23, 24, 25, 26, 27, 28, 29},
+        {30, 31, 32, 33, 34, 35, 36, 37, 38, 39}
+    }, {
+        LED_ROW(0), LED_ROW(1), LED_ROW(2), LED_ROW(3)
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+    }
+};
+// clang-format on
+
+RGB test_leds[RGB_MATRIX_LED_COUNT];
+
+static void test_init(void) {}
+
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    test_leds[index].r = r;
+    test_leds[index].g = g;
+    test_leds[index].b = b;
+}
+
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        test_set_color(i, r, g, b);
+    }
+}
+
+static void test_flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .flush         = test_flush,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+};
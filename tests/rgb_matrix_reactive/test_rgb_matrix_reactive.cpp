@@ -0,0 +1,142 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+void advance_time(uint32_t ms);
+
+extern RGB test_leds[RGB_MATRIX_LED_COUNT];
+}
+
+class RgbMatrixReactive : public testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+        render_frame();
+    }
+
+    /* Runs the sync, start, render and flush steps of a single frame. */
+    void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (uint8_t step = 0; step < 4; step++) {
+            rgb_matrix_task();
+        }
+    }
+
+    void hit(uint8_t led) {
+        rgb_matrix_handle_key_event(led / MATRIX_COLS, led % MATRIX_COLS, true);
+        rgb_matrix_handle_key_event(led / MATRIX_COLS, led % MATRIX_COLS, false);
+    }
+
+    /* The tick the reactive runners used before the per-led lookup. */
+    uint16_t reverse_search_tick(uint8_t led) {
+        for (int8_t j = g_last_hit_tracker.count - 1; j >= 0; j--) {
+            if (g_last_hit_tracker.index[j] == led) {
+                return g_last_hit_tracker.tick[j];
+            }
+        }
+        return UINT16_MAX;
+    }
+
+    uint16_t lookup_tick(uint8_t led) {
+        uint8_t j = g_last_hit_lookup.led_hit[led];
+        if (j < g_last_hit_tracker.count && g_last_hit_tracker.index[j] == led) {
+            return g_last_hit_tracker.tick[j];
+        }
+        return UINT16_MAX;
+    }
+};
+
+TEST_F(RgbMatrixReactive, LedHitMatchesReverseSearch) {
+    const uint8_t sequence[] = {0, 5, 13, 5, 39, 22, 0, 17, 31, 5, 8, 13, 26, 0, 39, 2};
+
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        EXPECT_EQ(lookup_tick(led), UINT16_MAX);
+    }
+
+    for (uint8_t hit_led : sequence) {
+        hit(hit_led);
+        /* The lookup only moves on with the tracker, when the next frame starts */
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            EXPECT_EQ(lookup_tick(led), reverse_search_tick(led)) << "led " << +led << " before rendering " << +hit_led;
+        }
+        render_frame();
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            EXPECT_EQ(lookup_tick(led), reverse_search_tick(led)) << "led " << +led << " after hitting " << +hit_led;
+        }
+    }
+}
+
+TEST_F(RgbMatrixReactive, DistanceRowsMatchLedPoints) {
+    const uint8_t sequence[] = {0, 9, 30, 39, 14, 25, 3, 36, 19, 20};
+
+    /* Rows already in the lookup are moved along when later hits push the oldest ones out */
+    for (uint8_t i = 0; i < sizeof(sequence); i++) {
+        hit(sequence[i]);
+        if (i == 4) {
+            render_frame();
+        }
+    }
+    render_frame();
+
+    ASSERT_EQ(g_last_hit_tracker.count, LED_HITS_TO_REMEMBER);
+    for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+        EXPECT_EQ(g_last_hit_tracker.index[j], sequence[sizeof(sequence) - LED_HITS_TO_REMEMBER + j]);
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            int16_t dx = g_led_config.point[led].x - g_last_hit_tracker.x[j];
+            int16_t dy = g_led_config.point[led].y - g_last_hit_tracker.y[j];
+            EXPECT_EQ(g_last_hit_lookup.dist[j][led], std::min(255, (int)std::sqrt(dx * dx + dy * dy))) << "hit " << +j << " led " << +led;
+        }
+    }
+}
+
+TEST_F(RgbMatrixReactive, HitLedLightsUp) {
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    render_frame();
+    EXPECT_EQ(test_leds[4].r, 0);
+
+    hit(4);
+    render_frame();
+    EXPECT_GT(test_leds[4].r, 0);
+    EXPECT_EQ(test_leds[5].r, 0);
+}
+
+TEST_F(RgbMatrixReactive, EveryEffectRendersAFullHitBuffer) {
+    const uint8_t effects[] = {
+        RGB_MATRIX_SOLID_REACTIVE_SIMPLE,
+        RGB_MATRIX_SOLID_REACTIVE,
+        RGB_MATRIX_SOLID_REACTIVE_WIDE,
+        RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE,
+        RGB_MATRIX_SOLID_REACTIVE_CROSS,
+        RGB_MATRIX_SOLID_REACTIVE_MULTICROSS,
+        RGB_MATRIX_SOLID_REACTIVE_NEXUS,
+        RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS,
+        RGB_MATRIX_SPLASH,
+        RGB_MATRIX_MULTISPLASH,
+        RGB_MATRIX_SOLID_SPLASH,
+        RGB_MATRIX_SOLID_MULTISPLASH,
+    };
+
+    rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    for (uint8_t effect : effects) {
+        rgb_matrix_mode_noeeprom(effect);
+        for (uint8_t led = 0; led < LED_HITS_TO_REMEMBER; led++) {
+            hit(led * 5);
+        }
+        render_frame();
+
+        bool lit = false;
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            lit |= test_leds[led].r || test_leds[led].g || test_leds[led].b;
+        }
+        EXPECT_TRUE(lit) << "mode " << +effect;
+    }
+}
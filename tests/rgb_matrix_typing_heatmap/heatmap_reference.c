@@ -0,0 +1,35 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include <lib/lib8tion/lib8tion.h>
+
+uint8_t reference_heatmap[MATRIX_ROWS][MATRIX_COLS];
+
+// The heatmap spread as it was done before the neighbor lists, scanning the whole matrix on each press.
+void reference_heatmap_press(uint8_t row, uint8_t col) {
+    if (g_led_config.matrix_co[row][col] == NO_LED) {
+        return;
+    }
+    for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+        for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+            if (g_led_config.matrix_co[i_row][i_col] == NO_LED) {
+                continue;
+            }
+            if (i_row == row && i_col == col) {
+                reference_heatmap[row][col] = qadd8(reference_heatmap[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+            } else {
+                led_point_t a        = g_led_config.point[g_led_config.matrix_co[row][col]];
+                led_point_t b        = g_led_config.point[g_led_config.matrix_co[i_row][i_col]];
+                uint8_t     distance = sqrt16(((int16_t)(a.x - b.x) * (int16_t)(a.x - b.x)) + ((int16_t)(a.y - b.y) * (int16_t)(a.y - b.y)));
+                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+                    }
+                    reference_heatmap[i_row][i_col] = qadd8(reference_heatmap[i_row][i_col], amount);
+                }
+            }
+        }
+    }
+}
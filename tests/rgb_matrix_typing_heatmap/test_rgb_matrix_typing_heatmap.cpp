@@ -0,0 +1,84 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+void advance_time(uint32_t ms);
+
+extern RGB     test_leds[RGB_MATRIX_LED_COUNT];
+extern uint8_t reference_heatmap[MATRIX_ROWS][MATRIX_COLS];
+void           reference_heatmap_press(uint8_t row, uint8_t col);
+}
+
+class RgbMatrixTypingHeatmap : public testing::Test {
+   protected:
+    void SetUp() override {
+        rgb_matrix_init();
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        // Switch effects so the heatmap starts cold
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
+        render_frame();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+        render_frame();
+        memset(reference_heatmap, 0, sizeof(reference_heatmap));
+    }
+
+    /* Runs the sync, start, render and flush steps of a single frame. */
+    void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (uint8_t step = 0; step < 4; step++) {
+            rgb_matrix_task();
+        }
+    }
+
+    void press(uint8_t row, uint8_t col) {
+        rgb_matrix_handle_key_event(row, col, true);
+        rgb_matrix_handle_key_event(row, col, false);
+    }
+};
+
+TEST_F(RgbMatrixTypingHeatmap, SpreadMatchesMatrixScan) {
+    // Corners and edges use the neighbor lists, interior keys overflow them
+    const uint8_t keys[][2] = {{0, 0}, {0, 5}, {1, 0}, {3, 9}, {2, 4}, {1, 1}, {0, 5}, {3, 0}, {2, 4}, {0, 9}, {1, 8}, {0, 0}};
+
+    for (auto key : keys) {
+        press(key[0], key[1]);
+        reference_heatmap_press(key[0], key[1]);
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                EXPECT_EQ(g_rgb_frame_buffer[row][col], reference_heatmap[row][col]) << "key " << +row << "," << +col << " after pressing " << +key[0] << "," << +key[1];
+            }
+        }
+    }
+}
+
+TEST_F(RgbMatrixTypingHeatmap, HeatDecaysToCold) {
+    render_frame();
+    const RGB cold = test_leds[0];
+
+    press(0, 0);
+    render_frame();
+    EXPECT_NE(memcmp(&test_leds[0], &cold, sizeof(RGB)), 0);
+    EXPECT_NE(memcmp(&test_leds[1], &cold, sizeof(RGB)), 0);
+    EXPECT_EQ(memcmp(&test_leds[2], &cold, sizeof(RGB)), 0);
+
+    // The hottest key cools down after INCREASE_STEP decrease steps
+    for (uint8_t step = 0; step <= RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP; step++) {
+        advance_time(RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS);
+        render_frame();
+    }
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        EXPECT_EQ(memcmp(&test_leds[led], &cold, sizeof(RGB)), 0) << "led " << +led;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            EXPECT_EQ(g_rgb_frame_buffer[row][col], 0);
+        }
+    }
+}
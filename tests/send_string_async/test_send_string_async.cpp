@@ -0,0 +1,149 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "send_string.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+std::vector<bool> completions;
+
+void record_completion(bool completed) {
+    completions.push_back(completed);
+}
+} // namespace
+
+class SendStringAsync : public TestFixture {
+   protected:
+    void SetUp() override {
+        completions.clear();
+    }
+};
+
+TEST_F(SendStringAsync, TypesFromTheMainLoop) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async_with_delay("aB", 0, record_completion));
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(completions.empty());
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    run_one_scan_loop();
+    EXPECT_FALSE(send_string_async_busy());
+    EXPECT_EQ(completions, std::vector<bool>{true});
+}
+
+TEST_F(SendStringAsync, IntervalIsWaitedOutWithoutBlocking) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_with_delay("a" SS_DELAY(20) "b", 10, NULL));
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(9);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(1);
+    VERIFY_AND_CLEAR(driver);
+
+    // The release is followed by the interval, then the delay and another interval.
+    EXPECT_NO_REPORT(driver);
+    idle_for(39);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    idle_for(1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, QueuedStringsAreTypedInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_with_delay("a", 0, record_completion));
+    EXPECT_TRUE(send_string_async_with_delay("b", 0, record_completion));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(completions, (std::vector<bool>{true, true}));
+}
+
+TEST_F(SendStringAsync, StringThatDoesNotFitIsRejected) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_FALSE(send_string_async("this string is longer than the buffer"));
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(send_string_async("0123456789"));
+    EXPECT_FALSE(send_string_async("0123456789abcdefghij"));
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(20);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, KeyPressCancelsAndReleasesHeldKeys) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_x = KeymapKey(0, 0, 0, KC_X);
+    set_keymap({key_x});
+
+    EXPECT_TRUE(send_string_async_with_delay(SS_DOWN(X_LCTL) "abcdefgh" SS_UP(X_LCTL), 0, record_completion));
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_FALSE(send_string_async_busy());
+    EXPECT_EQ(completions, std::vector<bool>{false});
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_x.release();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { esc_combo, tab_combo };
+
+uint16_t const esc_keys[] = {KC_Q, KC_W, COMBO_END};
+uint16_t const tab_keys[] = {KC_A, KC_S, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [esc_combo] = COMBO(esc_keys, KC_ESCAPE),
+    [tab_combo] = COMBO(tab_keys, KC_TAB),
+};
+// clang-format on
+
+tap_dance_action_t tap_dance_actions[] = {
+    [0] = ACTION_TAP_DANCE_DOUBLE(KC_X, KC_CAPS_LOCK),
+};
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE);
+
+// clang-format off
+const key_override_t **key_overrides = (const key_override_t *[]){
+    &delete_key_override,
+    NULL
+};
+// clang-format on
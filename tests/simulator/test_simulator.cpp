@@ -0,0 +1,97 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "simulator.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+namespace {
+
+std::string trace_path(const std::string& name) {
+    std::string file = __FILE__;
+    return file.substr(0, file.find_last_of('/') + 1) + "traces/" + name;
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream     file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+} // namespace
+
+class SimulatorTest : public TestFixture {
+   protected:
+    std::string replay(Simulator& simulator, const std::string& path) {
+        std::ifstream trace(path);
+        std::string   error;
+        EXPECT_TRUE(trace.is_open()) << "cannot open " << path;
+        EXPECT_TRUE(simulator.load(trace, error)) << path << ": " << error;
+
+        std::stringstream reports;
+        simulator.run(*this, reports);
+        return reports.str();
+    }
+};
+
+TEST_F(SimulatorTest, TraceMatchesRecordedReports) {
+    for (auto name : {"typing"}) {
+        Simulator   simulator;
+        std::string reports = replay(simulator, trace_path(std::string(name) + ".trace"));
+
+        EXPECT_EQ(reports, read_file(trace_path(std::string(name) + ".expected"))) << name << ".trace";
+    }
+}
+
+TEST_F(SimulatorTest, RejectsMalformedTraces) {
+    for (auto line : {"key 0 0 0 KC_NOT_A_KEYCODE", "key 0 99 0 KC_A", "10 down 0", "10 down 0 0\n5 up 0 0", "hold 0 0"}) {
+        Simulator          simulator;
+        std::istringstream trace(line);
+        std::string        error;
+
+        EXPECT_FALSE(simulator.load(trace, error)) << line;
+        EXPECT_FALSE(error.empty());
+    }
+}
+
+TEST_F(SimulatorTest, ParsesKeycodeExpressions) {
+    Simulator          simulator;
+    std::istringstream trace("key 0 0 0 LT(1,KC_F)\nkey 0 1 0 LCTL(LSFT(KC_A))\nkey 0 2 0 0x7C00\nkey 0 3 0 TD(0)\n");
+    std::string        error;
+
+    ASSERT_TRUE(simulator.load(trace, error)) << error;
+    std::stringstream reports;
+    simulator.run(*this, reports);
+
+    EXPECT_EQ(find_key(0, {.col = 0, .row = 0})->code, LT(1, KC_F));
+    EXPECT_EQ(find_key(0, {.col = 1, .row = 0})->code, LCTL(LSFT(KC_A)));
+    EXPECT_EQ(find_key(0, {.col = 2, .row = 0})->code, 0x7C00);
+    EXPECT_EQ(find_key(0, {.col = 3, .row = 0})->code, TD(0));
+    EXPECT_EQ(find_key(0, {.col = 4, .row = 0})->code, KC_NO);
+}
+
+// Replays the trace named by QMK_SIMULATOR_TRACE and prints its report
+// stream, turning this binary into a standalone simulator. Setting
+// QMK_SIMULATOR_MAX_EVENT_US fails the run if the mean processing time
+// per event exceeds that budget.
+TEST_F(SimulatorTest, ReplayTraceFromEnvironment) {
+    const char* path = std::getenv("QMK_SIMULATOR_TRACE");
+    if (path == nullptr) {
+        GTEST_SKIP() << "QMK_SIMULATOR_TRACE not set";
+    }
+
+    Simulator simulator;
+    std::cout << replay(simulator, path);
+    std::cout << "[ BENCH    ] ";
+    simulator.print_stats(std::cout);
+
+    if (const char* budget = std::getenv("QMK_SIMULATOR_MAX_EVENT_US")) {
+        EXPECT_LE(simulator.mean_event_time_ns(), std::strtoull(budget, nullptr, 10) * 1000);
+    }
+}
@@ -0,0 +1,9 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPLIT_KEYBOARD = yes
+SPLIT_TRANSPORT = custom
+WPM_ENABLE = yes
+
+SRC += $(QUANTUM_DIR)/split_common/transactions.c
+SRC += tests/test_common/split_loopback_transport.c
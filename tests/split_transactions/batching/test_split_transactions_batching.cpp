@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../split_typing_load.hpp"
+
+extern "C" {
+#include "split_util.h"
+}
+
+class SplitTransactionsBatching : public SplitTransactionsFixture {
+   protected:
+    void settle(TestDriver &driver) {
+        EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+        // Start just after a periodic resync
+        idle_and_sync(FORCED_SYNC_THROTTLE_MS + 10);
+        split_loopback_reset();
+    }
+};
+
+TEST_F(SplitTransactionsBatching, ChangesShareOneTransaction) {
+    TestDriver driver;
+    settle(driver);
+
+    key_shift.press();
+    key_layer.press();
+    scan_and_sync();
+
+    const split_loopback_stats_t *stats = split_loopback_stats();
+    EXPECT_EQ(stats->id_transactions[PUT_BATCH], 1);
+    EXPECT_EQ(split_shmem->batch.mods.real_mods, MOD_BIT(KC_LSFT));
+    EXPECT_EQ(split_shmem->batch.layers.layer_state, (layer_state_t)1 << 1);
+
+    key_shift.release();
+    key_layer.release();
+    scan_and_sync();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SplitTransactionsBatching, NothingIsSentWhileStateIsUnchanged) {
+    TestDriver driver;
+    settle(driver);
+
+    // Plain keys do not touch any synced state
+    key_a.press();
+    idle_and_sync(20);
+    key_a.release();
+    idle_and_sync(20);
+    EXPECT_EQ(split_loopback_stats()->id_transactions[PUT_BATCH], 0);
+
+    // Until the periodic resync
+    idle_and_sync(FORCED_SYNC_THROTTLE_MS);
+    EXPECT_EQ(split_loopback_stats()->id_transactions[PUT_BATCH], 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SplitTransactionsBatching, SlaveAppliesEachFrameOnce) {
+    TestDriver driver;
+    settle(driver);
+
+    layer_on(1);
+    sync();
+
+    // Stand in for the slave's own state
+    layer_clear();
+    set_mods(MOD_BIT(KC_LCTL));
+    transactions_slave(master_matrix, slave_matrix);
+    EXPECT_EQ(layer_state, (layer_state_t)1 << 1);
+    EXPECT_EQ(get_mods(), 0);
+
+    // A frame is applied once
+    layer_clear();
+    transactions_slave(master_matrix, slave_matrix);
+    EXPECT_EQ(layer_state, 0);
+
+    split_sync_take_dirty();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SplitTransactionsBatching, BackToBackFramesAreNotLost) {
+    TestDriver driver;
+    settle(driver);
+
+    // Two frames, each with a different change, before the slave gets to run
+    layer_on(1);
+    sync();
+    set_mods(MOD_BIT(KC_LSFT));
+    sync();
+    EXPECT_EQ(split_loopback_stats()->id_transactions[PUT_BATCH], 2);
+
+    layer_clear();
+    clear_mods();
+    transactions_slave(master_matrix, slave_matrix);
+    EXPECT_EQ(layer_state, (layer_state_t)1 << 1);
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LSFT));
+
+    layer_clear();
+    clear_mods();
+    split_sync_take_dirty();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SplitTransactionsBatching, CorruptFrameIsDropped) {
+    TestDriver driver;
+    settle(driver);
+
+    layer_on(1);
+    sync();
+    layer_clear();
+    split_shmem->batch.layers.layer_state ^= 1 << 2;
+    transactions_slave(master_matrix, slave_matrix);
+    EXPECT_EQ(layer_state, 0);
+
+    split_sync_take_dirty();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SplitTransactionsBatching, TypingLoadBytesPerSecond) {
+    EXPECT_GT(run_typing_load(), 0);
+
+    // Ten periodic resyncs plus one frame per shift or layer edge
+    EXPECT_LE(split_loopback_stats()->id_transactions[PUT_BATCH], 10 + 3 * 4);
+}
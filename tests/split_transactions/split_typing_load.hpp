@@ -0,0 +1,95 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "split_loopback_transport.h"
+#include "transactions.h"
+#include "transaction_id_define.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+class SplitTransactionsFixture : public TestFixture {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {};
+
+    KeymapKey key_a     = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey key_b     = KeymapKey(0, 1, 0, KC_B);
+    KeymapKey key_shift = KeymapKey(0, 2, 0, KC_LSFT);
+    KeymapKey key_layer = KeymapKey(0, 3, 0, MO(1));
+    KeymapKey key_one   = KeymapKey(1, 0, 0, KC_1);
+
+    void SetUp() override {
+        set_keymap({key_a, key_b, key_shift, key_layer, key_one});
+        split_loopback_reset();
+    }
+
+    bool sync(void) {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    // One scan loop followed by one master sync, as split_common/matrix.c does
+    void scan_and_sync(void) {
+        run_one_scan_loop();
+        sync();
+    }
+
+    void idle_and_sync(unsigned ms) {
+        for (unsigned i = 0; i < ms; i++) {
+            scan_and_sync();
+        }
+    }
+
+    void tap_and_sync(KeymapKey &key) {
+        key.press();
+        idle_and_sync(40);
+        key.release();
+        idle_and_sync(40);
+    }
+
+    /**
+     * One second of typing at roughly 120 WPM: a tap every 100ms, every
+     * fourth one shifted and one burst on a momentary layer. Returns the bytes
+     * sent excluding the slave matrix reads, which do not change with
+     * batching.
+     */
+    uint32_t run_typing_load(void) {
+        TestDriver driver;
+        EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+        // Let the boot sync go out first so the measurement is steady state
+        idle_and_sync(1000);
+        split_loopback_reset();
+
+        for (int i = 0; i < 10; i++) {
+            if (i % 4 == 3) {
+                key_shift.press();
+                idle_and_sync(10);
+                tap_and_sync(key_a);
+                key_shift.release();
+                idle_and_sync(10);
+            } else if (i == 6) {
+                key_layer.press();
+                idle_and_sync(10);
+                tap_and_sync(key_one);
+                key_layer.release();
+                idle_and_sync(10);
+            } else {
+                tap_and_sync(i % 2 ? key_a : key_b);
+                idle_and_sync(20);
+            }
+        }
+
+        const split_loopback_stats_t *stats  = split_loopback_stats();
+        uint32_t                      matrix = stats->id_bytes[GET_SLAVE_MATRIX_CHECKSUM] + stats->id_bytes[GET_SLAVE_MATRIX_DATA];
+        uint32_t                      state  = stats->bytes - matrix;
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return state;
+    }
+};
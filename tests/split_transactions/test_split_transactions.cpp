@@ -0,0 +1,33 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_typing_load.hpp"
+
+class SplitTransactions : public SplitTransactionsFixture {};
+
+TEST_F(SplitTransactions, ModsAndLayersAreSentAsSeparateTransactions) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    idle_and_sync(10);
+    split_loopback_reset();
+
+    key_shift.press();
+    key_layer.press();
+    scan_and_sync();
+
+    const split_loopback_stats_t *stats = split_loopback_stats();
+    EXPECT_EQ(stats->id_transactions[PUT_MODS], 1);
+    EXPECT_EQ(stats->id_transactions[PUT_LAYER_STATE], 1);
+    EXPECT_EQ(split_shmem->mods.real_mods, MOD_BIT(KC_LSFT));
+    EXPECT_EQ(split_shmem->layers.layer_state, (layer_state_t)1 << 1);
+
+    key_shift.release();
+    key_layer.release();
+    scan_and_sync();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SplitTransactions, TypingLoadBytesPerSecond) {
+    EXPECT_GT(run_typing_load(), 0);
+}
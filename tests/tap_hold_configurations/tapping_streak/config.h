@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_LATENCY_STATS
+#define TAPPING_STREAK_TERM 100
+#define TAPPING_STREAK_TERM_PER_KEY
@@ -0,0 +1,117 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class TappingLatency : public TestFixture {};
+
+TEST_F(TappingLatency, tap_and_hold_latencies_are_measured) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       regular_key      = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({mod_tap_hold_key, regular_key});
+    clear_tapping_latency_stats();
+
+    /* Tap mod-tap-hold key, released after 50ms */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Hold mod-tap-hold key past the tapping term, well after the last key press */
+    idle_for(TAPPING_TERM);
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tapping_latency_stats_t stats;
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.tap.count, 1);
+    EXPECT_NEAR(stats.tap.avg, 50, 1);
+    EXPECT_EQ(stats.tap.min, stats.tap.avg);
+    EXPECT_EQ(stats.tap.max, stats.tap.avg);
+    EXPECT_EQ(stats.tap.histogram[6], 1); // below 64ms
+    EXPECT_EQ(stats.hold.count, 1);
+    EXPECT_EQ(stats.hold.avg, TAPPING_TERM);
+    EXPECT_EQ(stats.hold.histogram[8], 1); // below 256ms
+    EXPECT_EQ(stats.early_taps, 0);
+
+    /* The same numbers are kept for the key itself, but not for regular keys */
+    tapping_latency_stats_t key_stats;
+    ASSERT_TRUE(get_tapping_key_latency_stats(mod_tap_hold_key.position, &key_stats));
+    EXPECT_EQ(key_stats.tap.count, 1);
+    EXPECT_EQ(key_stats.tap.avg, stats.tap.avg);
+    EXPECT_EQ(key_stats.hold.count, 1);
+    EXPECT_EQ(key_stats.hold.avg, stats.hold.avg);
+    EXPECT_FALSE(get_tapping_key_latency_stats(regular_key.position, &key_stats));
+
+    clear_tapping_latency_stats();
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.tap.count, 0);
+    EXPECT_EQ(stats.hold.count, 0);
+    EXPECT_EQ(stats.tap.histogram[6], 0);
+}
+
+TEST_F(TappingLatency, hold_on_other_key_press_resolved_by_timeout) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       regular_key      = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({mod_tap_hold_key, regular_key});
+    clear_tapping_latency_stats();
+
+    /* Press mod-tap-hold key, then a regular key that is held along with it */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(30);
+    regular_key.press();
+    idle_for(TAPPING_TERM - 30);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The regular key waited for the decision as well */
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tapping_latency_stats_t stats;
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.tap.count, 0);
+    EXPECT_EQ(stats.hold.count, 1);
+    EXPECT_EQ(stats.hold.avg, TAPPING_TERM);
+}
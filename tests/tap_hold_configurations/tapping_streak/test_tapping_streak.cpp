@@ -0,0 +1,281 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "simulator.hpp"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+namespace {
+bool streak_enabled = true;
+
+// Keys and modifiers in the order they were pressed, from a simulator report stream
+std::vector<std::string> typed_keys(const std::string &reports) {
+    std::vector<std::string> typed;
+    std::set<std::string>    previous;
+    std::istringstream       lines(reports);
+    for (std::string line; std::getline(lines, line);) {
+        std::set<std::string> current;
+        size_t                open = line.find('(');
+        if (open != std::string::npos) {
+            std::string       keys = line.substr(open + 1, line.find(')') - open - 1) + ", " + line.substr(line.find('[') + 1, line.find(']') - line.find('[') - 1);
+            std::stringstream list(keys);
+            for (std::string key; std::getline(list, key, ',');) {
+                key.erase(0, key.find_first_not_of(' '));
+                if (!key.empty()) current.insert(key);
+            }
+        }
+        for (auto &key : current) {
+            if (!previous.count(key)) typed.push_back(key);
+        }
+        previous = current;
+    }
+    return typed;
+}
+} // namespace
+
+extern "C" uint16_t get_tapping_streak_term(uint16_t keycode, keyrecord_t *record) {
+    return streak_enabled ? get_adaptive_tapping_streak_term(record) : 0;
+}
+
+class TappingStreak : public TestFixture {
+   public:
+    void SetUp() override {
+        streak_enabled = true;
+        clear_tapping_latency_stats();
+    }
+};
+
+TEST_F(TappingStreak, tap_key_pressed_within_streak_is_tapped_on_press) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       regular_key      = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({mod_tap_hold_key, regular_key});
+
+    /* Type regular key */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key, 30);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press mod-tap-hold key shortly after, it is tapped right away */
+    idle_for(20);
+    EXPECT_REPORT(driver, (KC_P));
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Keys typed while it is held are not delayed */
+    EXPECT_REPORT(driver, (KC_P, KC_A));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tapping_latency_stats_t stats;
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.tap.count, 1);
+    EXPECT_EQ(stats.tap.max, 0);
+    EXPECT_EQ(stats.early_taps, 1);
+    EXPECT_EQ(stats.hold.count, 0);
+}
+
+TEST_F(TappingStreak, tap_key_pressed_after_pause_can_be_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 1, SFT_T(KC_P));
+    auto       regular_key      = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({mod_tap_hold_key, regular_key});
+
+    /* Type regular key */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key, 30);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press mod-tap-hold key after a pause and hold it */
+    idle_for(TAPPING_STREAK_TERM);
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tapping_latency_stats_t stats;
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.early_taps, 0);
+    EXPECT_EQ(stats.hold.count, 1);
+}
+
+TEST_F(TappingStreak, disabled_per_key) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 2, SFT_T(KC_P));
+    auto       regular_key      = KeymapKey(0, 2, 2, KC_A);
+
+    set_keymap({mod_tap_hold_key, regular_key});
+    streak_enabled = false;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key, 30);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Without a streak term, the tap is only sent on release */
+    idle_for(20);
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    tapping_latency_stats_t stats;
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.early_taps, 0);
+    EXPECT_NEAR(stats.tap.avg, 40, 1);
+}
+
+TEST_F(TappingStreak, streak_term_adapts_to_holds) {
+    TestDriver driver;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 3, SFT_T(KC_P));
+    auto       regular_key      = KeymapKey(0, 2, 3, KC_A);
+    keyrecord_t record          = {.event = {.key = mod_tap_hold_key.position, .type = KEY_EVENT, .pressed = true}};
+
+    set_keymap({mod_tap_hold_key, regular_key});
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    EXPECT_EQ(get_adaptive_tapping_streak_term(&record), TAPPING_STREAK_TERM);
+
+    /* Shift a letter a few times, pressing the mod-tap-hold key 120ms after the previous key */
+    for (int i = 0; i < 8; i++) {
+        tap_key(regular_key, 20);
+        idle_for(120 - 21);
+        mod_tap_hold_key.press();
+        idle_for(TAPPING_TERM + 10);
+        tap_key(regular_key, 20);
+        mod_tap_hold_key.release();
+        idle_for(TAPPING_TERM * 2);
+    }
+
+    /* The term moved towards half of that, leaving room for holds that start sooner */
+    uint16_t term = get_adaptive_tapping_streak_term(&record);
+    EXPECT_LT(term, 70);
+    EXPECT_GE(term, 60);
+
+    tapping_latency_stats_t stats;
+    get_tapping_latency_stats(&stats);
+    EXPECT_EQ(stats.hold.count, 8);
+    EXPECT_EQ(stats.early_taps, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TappingStreak, home_row_mod_typing_taps_sooner) {
+    // Typing on a layout with home row mods: rolled words, with the
+    // occasional shifted letter after a pause.
+    std::stringstream trace;
+    trace << "key 0 0 0 LGUI_T(KC_A)\nkey 0 1 0 LALT_T(KC_S)\nkey 0 2 0 LCTL_T(KC_D)\nkey 0 3 0 LSFT_T(KC_F)\n"
+          << "key 0 4 0 RSFT_T(KC_J)\nkey 0 5 0 RCTL_T(KC_K)\nkey 0 6 0 LALT_T(KC_L)\nkey 0 7 0 RGUI_T(KC_H)\n"
+          << "key 0 0 1 KC_E\nkey 0 1 1 KC_R\nkey 0 2 1 KC_T\nkey 0 3 1 KC_I\nkey 0 4 1 KC_O\nkey 0 5 1 KC_N\nkey 0 6 1 KC_U\nkey 0 7 1 KC_SPACE\n";
+
+    uint32_t seed = 12345;
+    auto     rand = [&](uint32_t range) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % range;
+    };
+
+    std::vector<Simulator::Event> events;
+    uint32_t                      released[8][2] = {};
+    auto                          tap            = [&](uint8_t col, uint8_t row, uint32_t down, uint32_t up) {
+        events.push_back({down, col, row, true});
+        events.push_back({up, col, row, false});
+        released[col][row] = up;
+    };
+
+    uint32_t time = 0;
+    for (int word = 0; word < 400; word++) {
+        if (word % 5 == 0) {
+            // Hold shift on the other hand for a capital letter, after a pause
+            time += 300;
+            tap(4, 0, time, time + 260);
+            tap(1, 1, time + 150, time + 210);
+            time += 350;
+        }
+        int letters = 3 + rand(5);
+        for (int letter = 0; letter < letters; letter++) {
+            uint8_t col, row;
+            do {
+                col = rand(8);
+                row = rand(2);
+            } while (released[col][row] >= time);
+            tap(col, row, time, time + 50 + rand(60));
+            time += 60 + rand(80);
+        }
+        tap(7, 1, time, time + 40);
+        time += 250;
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const Simulator::Event &a, const Simulator::Event &b) { return a.time < b.time; });
+    for (auto &event : events) {
+        trace << event.time << (event.pressed ? " down " : " up ") << +event.col << " " << +event.row << "\n";
+    }
+
+    tapping_latency_stats_t  stats[2];
+    std::vector<std::string> typed[2];
+    for (bool enabled : {false, true}) {
+        streak_enabled = enabled;
+        clear_tapping_latency_stats();
+
+        Simulator   simulator;
+        std::string error;
+        trace.clear();
+        trace.seekg(0);
+        ASSERT_TRUE(simulator.load(trace, error)) << error;
+        std::stringstream reports;
+        set_keymap({});
+        simulator.run(*this, reports);
+        typed[enabled] = typed_keys(reports.str());
+
+        get_tapping_latency_stats(&stats[enabled]);
+    }
+
+    // The same text, sooner
+    EXPECT_FALSE(typed[false].empty());
+    EXPECT_EQ(typed[true], typed[false]);
+    EXPECT_EQ(stats[true].hold.count, stats[false].hold.count);
+    EXPECT_GT(stats[true].early_taps, stats[true].tap.count / 4);
+    EXPECT_LT(stats[true].tap.avg, stats[false].tap.avg);
+}
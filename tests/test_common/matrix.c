@@ -20,6 +20,28 @@
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+static uint8_t pending_rows[MATRIX_CHANGED_ROWS_SIZE] = {};
+static uint8_t changed_rows[MATRIX_CHANGED_ROWS_SIZE] = {};
+
+static void mark_row_changed(uint8_t row) {
+    pending_rows[row / 8] |= 1 << (row % 8);
+}
+
+const uint8_t *matrix_get_changed_rows(void) {
+    return changed_rows;
+}
+#endif
+
+static void raw_change(uint8_t row) {
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+    mark_row_changed(row);
+#endif
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    matrix_scan_perf_raw_change();
+#endif
+}
+
 void matrix_init(void) {
     clear_all_keys();
     matrix_init_kb();
@@ -27,7 +49,21 @@ void matrix_init(void) {
 
 uint8_t matrix_scan(void) {
     matrix_scan_kb();
+#ifdef MATRIX_TRACK_CHANGED_ROWS
+    bool changed = false;
+    for (uint8_t i = 0; i < MATRIX_CHANGED_ROWS_SIZE; i++) {
+        changed |= pending_rows[i] != 0;
+        changed_rows[i] = pending_rows[i];
+        pending_rows[i] = 0;
+    }
+#    ifdef DEBUG_MATRIX_SCAN_RATE
+    // The test matrix has no debouncing, it is settled whenever it did not change
+    if (!changed) matrix_scan_perf_raw_settled(matrix, matrix, MATRIX_ROWS);
+#    endif
+    return changed;
+#else
     return 1;
+#endif
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
@@ -42,10 +78,12 @@ void matrix_scan_kb(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+    raw_change(row);
 }
 
 void release_key(uint8_t col, uint8_t row) {
     matrix[row] &= ~((matrix_row_t)1 << col);
+    raw_change(row);
 }
 
 bool matrix_is_on(uint8_t row, uint8_t col) {
@@ -53,6 +91,11 @@ bool matrix_is_on(uint8_t row, uint8_t col) {
 }
 
 void clear_all_keys(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix[row]) {
+            raw_change(row);
+        }
+    }
     memset(matrix, 0, sizeof(matrix));
 }
 
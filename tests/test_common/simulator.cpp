@@ -0,0 +1,274 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "simulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <sstream>
+#include "keyboard_report_util.hpp"
+
+extern "C" {
+#include "host.h"
+#include "quantum_keycodes.h"
+#include "test_matrix.h"
+#include "timer.h"
+}
+
+extern std::map<uint16_t, std::string> KEYCODE_ID_TABLE;
+
+namespace {
+
+constexpr uint32_t default_tail_ms = 1000;
+
+std::ostream* report_stream = nullptr;
+uint32_t      report_start  = 0;
+
+uint8_t simulator_keyboard_leds(void) {
+    return 0;
+}
+
+void simulator_send_keyboard(report_keyboard_t* report) {
+    *report_stream << timer_elapsed32(report_start) << " " << *report;
+}
+
+void simulator_send_nkro(report_nkro_t* report) {}
+
+void simulator_send_mouse(report_mouse_t* report) {
+    *report_stream << timer_elapsed32(report_start) << " mouse: " << +report->buttons << " " << +report->x << " " << +report->y << " " << +report->v << " " << +report->h << std::endl;
+}
+
+void simulator_send_extra(report_extra_t* report) {
+    *report_stream << timer_elapsed32(report_start) << " extra: " << +report->report_id << " " << report->usage << std::endl;
+}
+
+host_driver_t simulator_driver = {simulator_keyboard_leds, simulator_send_keyboard, simulator_send_nkro, simulator_send_mouse, simulator_send_extra};
+
+bool parse_number(const std::string& token, uint32_t& value) {
+    if (token.empty() || !isdigit(token[0])) {
+        return false;
+    }
+    char*         end;
+    unsigned long parsed = std::strtoul(token.c_str(), &end, 0);
+    if (*end != '\0' || parsed > UINT32_MAX) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+bool parse_keycode(const std::string& token, uint16_t& keycode) {
+    uint32_t number;
+    if (parse_number(token, number)) {
+        keycode = number;
+        return number <= UINT16_MAX;
+    }
+
+    size_t open = token.find('(');
+    if (open == std::string::npos) {
+        for (auto& entry : KEYCODE_ID_TABLE) {
+            if (entry.second == token) {
+                keycode = entry.first;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (token.back() != ')') {
+        return false;
+    }
+    std::string name  = token.substr(0, open);
+    std::string args  = token.substr(open + 1, token.size() - open - 2);
+    size_t      comma = args.find(',');
+
+    // clang-format off
+    static const std::map<std::string, std::function<uint16_t(uint8_t)>> layer_functions = {
+        {"MO", [](uint8_t layer) { return MO(layer); }},
+        {"TG", [](uint8_t layer) { return TG(layer); }},
+        {"TO", [](uint8_t layer) { return TO(layer); }},
+        {"OSL", [](uint8_t layer) { return OSL(layer); }},
+        {"TD", [](uint8_t index) { return TD(index); }},
+    };
+    static const std::map<std::string, std::function<uint16_t(uint16_t)>> key_functions = {
+        {"LCTL", [](uint16_t kc) { return LCTL(kc); }},
+        {"LSFT", [](uint16_t kc) { return LSFT(kc); }},
+        {"LALT", [](uint16_t kc) { return LALT(kc); }},
+        {"LGUI", [](uint16_t kc) { return LGUI(kc); }},
+        {"RCTL", [](uint16_t kc) { return RCTL(kc); }},
+        {"RSFT", [](uint16_t kc) { return RSFT(kc); }},
+        {"RALT", [](uint16_t kc) { return RALT(kc); }},
+        {"RGUI", [](uint16_t kc) { return RGUI(kc); }},
+        {"LCTL_T", [](uint16_t kc) { return LCTL_T(kc); }},
+        {"LSFT_T", [](uint16_t kc) { return LSFT_T(kc); }},
+        {"LALT_T", [](uint16_t kc) { return LALT_T(kc); }},
+        {"LGUI_T", [](uint16_t kc) { return LGUI_T(kc); }},
+        {"RCTL_T", [](uint16_t kc) { return RCTL_T(kc); }},
+        {"RSFT_T", [](uint16_t kc) { return RSFT_T(kc); }},
+        {"RALT_T", [](uint16_t kc) { return RALT_T(kc); }},
+        {"RGUI_T", [](uint16_t kc) { return RGUI_T(kc); }},
+    };
+    // clang-format on
+
+    uint32_t layer;
+    uint16_t inner;
+    if (name == "LT" && comma != std::string::npos) {
+        if (!parse_number(args.substr(0, comma), layer) || !parse_keycode(args.substr(comma + 1), inner)) {
+            return false;
+        }
+        keycode = LT(layer, inner);
+        return true;
+    }
+    if (layer_functions.count(name) && parse_number(args, layer)) {
+        keycode = layer_functions.at(name)(layer);
+        return true;
+    }
+    if (key_functions.count(name) && parse_keycode(args, inner)) {
+        keycode = key_functions.at(name)(inner);
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+bool Simulator::load(std::istream& trace, std::string& error) {
+    std::string line;
+    unsigned    line_number = 0;
+    uint32_t    last_time   = 0;
+    bool        has_end     = false;
+
+    m_keys.clear();
+    m_events.clear();
+
+    while (std::getline(trace, line)) {
+        line_number++;
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream       tokens(line);
+        std::vector<std::string> words;
+        for (std::string word; tokens >> word;) {
+            words.push_back(word);
+        }
+        if (words.empty()) {
+            continue;
+        }
+
+        auto fail = [&](const std::string& reason) {
+            error = "line " + std::to_string(line_number) + ": " + reason;
+            return false;
+        };
+
+        uint32_t time, layer, col, row;
+        if (words[0] == "key") {
+            uint16_t keycode;
+            if (words.size() != 5 || !parse_number(words[1], layer) || !parse_number(words[2], col) || !parse_number(words[3], row)) {
+                return fail("expected `key <layer> <col> <row> <keycode>`");
+            }
+            if (layer > 31 || col >= MATRIX_COLS || row >= MATRIX_ROWS) {
+                return fail("key out of range");
+            }
+            if (!parse_keycode(words[4], keycode)) {
+                return fail("unknown keycode " + words[4]);
+            }
+            m_keys.emplace_back(layer, col, row, keycode);
+        } else if (parse_number(words[0], time)) {
+            if (time < last_time) {
+                return fail("time goes backwards");
+            }
+            last_time = time;
+            if (words.size() == 2 && words[1] == "end") {
+                m_end_time = time;
+                has_end    = true;
+            } else if (words.size() == 4 && (words[1] == "down" || words[1] == "up") && parse_number(words[2], col) && parse_number(words[3], row)) {
+                if (col >= MATRIX_COLS || row >= MATRIX_ROWS) {
+                    return fail("key out of range");
+                }
+                m_events.push_back({time, (uint8_t)col, (uint8_t)row, words[1] == "down"});
+            } else {
+                return fail("expected `<ms> down|up <col> <row>` or `<ms> end`");
+            }
+        } else {
+            return fail("unknown entry " + words[0]);
+        }
+    }
+
+    if (!has_end) {
+        m_end_time = last_time + default_tail_ms;
+    }
+    return true;
+}
+
+void Simulator::run(TestFixture& fixture, std::ostream& reports) {
+    layer_t layers = 0;
+    for (auto& key : m_keys) {
+        layers = std::max<layer_t>(layers, key.layer + 1);
+        fixture.add_key(key);
+    }
+    for (layer_t layer = 0; layer < std::max<layer_t>(layers, 1); layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (!fixture.find_key(layer, {.col = col, .row = row})) {
+                    fixture.add_key(KeymapKey(layer, col, row, layer ? KC_TRANSPARENT : KC_NO));
+                }
+            }
+        }
+    }
+
+    report_stream = &reports;
+    host_driver_t* previous_driver = host_get_driver();
+    host_set_driver(&simulator_driver);
+    m_event_times_ns.clear();
+
+    uint32_t start = timer_read32();
+    report_start   = start;
+    for (auto& event : m_events) {
+        uint32_t now = timer_elapsed32(start);
+        if (event.time > now) {
+            fixture.idle_for(event.time - now);
+        }
+        if (event.pressed) {
+            press_key(event.col, event.row);
+        } else {
+            release_key(event.col, event.row);
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        fixture.run_one_scan_loop();
+        m_event_times_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+    }
+
+    uint32_t now = timer_elapsed32(start);
+    if (m_end_time > now) {
+        fixture.idle_for(m_end_time - now);
+    }
+
+    host_set_driver(previous_driver);
+    report_stream = nullptr;
+}
+
+uint64_t Simulator::mean_event_time_ns() const {
+    if (m_event_times_ns.empty()) {
+        return 0;
+    }
+
+    uint64_t total = 0;
+    for (auto ns : m_event_times_ns) {
+        total += ns;
+    }
+    return total / m_event_times_ns.size();
+}
+
+void Simulator::print_stats(std::ostream& out) const {
+    if (m_event_times_ns.empty()) {
+        out << "0 events" << std::endl;
+        return;
+    }
+
+    std::vector<uint64_t> sorted = m_event_times_ns;
+    std::sort(sorted.begin(), sorted.end());
+
+    out << sorted.size() << " events, " << mean_event_time_ns() << "ns mean, " << sorted[(sorted.size() - 1) * 99 / 100] << "ns p99, " << sorted.back() << "ns max" << std::endl;
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+/**
+ * @brief Replays a recorded keystroke trace through the keyboard with a
+ * virtual clock, recording the HID reports it produces and how long each
+ * event took to process.
+ *
+ * A trace is plain text, one entry per line, `#` starts a comment:
+ *
+ *   key <layer> <col> <row> <keycode>   map a key, e.g. `key 0 2 0 LSFT_T(KC_C)`
+ *   <ms> down <col> <row>               press a key at time <ms>
+ *   <ms> up <col> <row>                 release a key at time <ms>
+ *   <ms> end                            keep running until <ms>, defaults to 1s after the last event
+ *
+ * Keycodes are either names known to the test keycode table, numbers, or
+ * one of MO/TG/TO/OSL/TD/LT and the mod-tap and modifier wrappers. Unmapped
+ * keys are KC_NO on layer 0 and KC_TRNS on higher layers. Each event takes
+ * one scan (1ms) to process, so events closer together than that are
+ * delayed accordingly.
+ */
+class Simulator {
+   public:
+    struct Event {
+        uint32_t time;
+        uint8_t  col;
+        uint8_t  row;
+        bool     pressed;
+    };
+
+    /**
+     * @brief Parses `trace`, returns false and sets `error` on malformed input.
+     */
+    bool load(std::istream& trace, std::string& error);
+
+    /**
+     * @brief Maps the trace's keys into `fixture` and replays its events,
+     * writing each report to `reports` as `<ms> <report>`.
+     */
+    void run(TestFixture& fixture, std::ostream& reports);
+
+    const std::vector<Event>& events() const {
+        return m_events;
+    }
+
+    /** @brief Wall clock time spent processing each event, in nanoseconds. */
+    const std::vector<uint64_t>& event_times_ns() const {
+        return m_event_times_ns;
+    }
+
+    /** @brief Mean processing time per event, in nanoseconds. */
+    uint64_t mean_event_time_ns() const;
+
+    /** @brief Prints event count, mean, 99th percentile and maximum processing time. */
+    void print_stats(std::ostream& out) const;
+
+   private:
+    std::vector<KeymapKey> m_keys;
+    std::vector<Event>     m_events;
+    std::vector<uint64_t>  m_event_times_ns;
+    uint32_t               m_end_time = 0;
+};
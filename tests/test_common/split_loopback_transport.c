@@ -0,0 +1,62 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "crc.h"
+#include "split_loopback_transport.h"
+#include "transactions.h"
+#include "transport.h"
+#include "transaction_id_define.h"
+
+static split_shared_memory_t  shared_memory;
+split_shared_memory_t *const  split_shmem = &shared_memory;
+static split_loopback_stats_t stats;
+
+void split_loopback_reset(void) {
+    memset(&shared_memory, 0, sizeof(shared_memory));
+    memset(&stats, 0, sizeof(stats));
+    // An idle slave half with a valid matrix checksum
+    split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+}
+
+const split_loopback_stats_t *split_loopback_stats(void) {
+    return &stats;
+}
+
+void transport_master_init(void) {}
+void transport_slave_init(void) {}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+    }
+
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    }
+
+    uint32_t bytes = 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    stats.transactions++;
+    stats.bytes += bytes;
+    if (id >= 0 && id < 32) {
+        stats.id_transactions[id]++;
+        stats.id_bytes[id] += bytes;
+    }
+    return true;
+}
+
+bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transactions_master(master_matrix, slave_matrix);
+}
+
+void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    transactions_slave(master_matrix, slave_matrix);
+}
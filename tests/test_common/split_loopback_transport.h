@@ -0,0 +1,33 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t id_transactions[32];
+    uint32_t id_bytes[32];
+} split_loopback_stats_t;
+
+/**
+ * \brief In-process split transport for tests.
+ *
+ * Transactions land directly in the shared memory, as the serial transport
+ * would leave them on the slave, and any slave callback is run inline. Bytes
+ * are counted the way the serial transport clocks them: the transaction ID and
+ * its handshake reply plus both registered buffer sizes.
+ */
+void split_loopback_reset(void);
+
+const split_loopback_stats_t *split_loopback_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -22,6 +22,7 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "keymap_introspection.h"
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -165,6 +166,14 @@ void TestFixture::get_keycode(const layer_t layer, const keypos_t position, uint
         return;
     }
 
+#ifdef ENCODER_MAP_ENABLE
+    /* Encoders are not keys, their keycodes come from the test's encoder_map. */
+    if (position.row == KEYLOC_ENCODER_CW || position.row == KEYLOC_ENCODER_CCW) {
+        *result = keycode_at_encodermap_location(layer, position.col, position.row == KEYLOC_ENCODER_CW);
+        return;
+    }
+#endif // ENCODER_MAP_ENABLE
+
     FAIL() << "no key is mapped for layer " << +layer << " and (column,row) " << +position.col << "," << +position.row << ")";
 }
 
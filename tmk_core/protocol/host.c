@@ -16,11 +16,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
 #include "util.h"
 #include "debug.h"
+#include "timer.h"
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -44,8 +46,16 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+#ifdef HOST_REPORT_QUEUE_SIZE
+static void host_report_queue_clear(void);
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
+#ifdef HOST_REPORT_QUEUE_SIZE
+    // Reports queued for the previous driver are dropped rather than sent to the new one.
+    host_report_queue_clear();
+#endif
 }
 
 host_driver_t *host_get_driver(void) {
@@ -71,6 +81,187 @@ led_t host_keyboard_led_state(void) {
     return (led_t)host_keyboard_leds();
 }
 
+#ifdef HOST_REPORT_QUEUE_SIZE
+_Static_assert(HOST_REPORT_QUEUE_SIZE > 0 && HOST_REPORT_QUEUE_SIZE <= 255, "HOST_REPORT_QUEUE_SIZE must be between 1 and 255");
+
+#    ifdef MOUSE_EXTENDED_REPORT
+#        define HOST_MOUSE_XY_MAX INT16_MAX
+#    else
+#        define HOST_MOUSE_XY_MAX 127
+#    endif
+#    define HOST_MOUSE_HV_MAX 127
+
+typedef struct {
+    bool     sent_in_frame;
+    uint16_t frame; // timer_read() millisecond of the last report sent, not a USB start of frame
+    uint8_t  count; // reports waiting in the queue
+} host_report_endpoint_state_t;
+
+/* Reports from every endpoint share one queue, so they reach the host in the order they were sent */
+typedef struct {
+    uint8_t endpoint; // host_report_endpoint_t
+    union {
+        report_keyboard_t keyboard;
+#    ifdef NKRO_ENABLE
+        report_nkro_t nkro;
+#    endif
+        report_mouse_t mouse;
+        report_extra_t extra;
+    };
+} host_report_queue_entry_t;
+
+static host_report_queue_entry_t    queue[HOST_REPORT_QUEUE_SIZE];
+static uint8_t                      queue_head;
+static uint8_t                      queue_count;
+static host_report_endpoint_state_t endpoints[HOST_REPORT_ENDPOINT_COUNT];
+static host_report_queue_stats_t    queue_stats[HOST_REPORT_ENDPOINT_COUNT];
+
+static void host_report_queue_clear(void) {
+    queue_head  = 0;
+    queue_count = 0;
+    memset(endpoints, 0, sizeof(endpoints));
+}
+
+static host_report_queue_entry_t *host_report_queue_slot(uint8_t offset) {
+    return &queue[(queue_head + offset) % HOST_REPORT_QUEUE_SIZE];
+}
+
+/* Returns the newest report for `endpoint` that has not been sent yet, or NULL */
+static host_report_queue_entry_t *host_report_queue_last(host_report_endpoint_t endpoint) {
+    for (uint8_t i = queue_count; i > 0; i--) {
+        host_report_queue_entry_t *entry = host_report_queue_slot(i - 1);
+        if (entry->endpoint == endpoint) return entry;
+    }
+    return NULL;
+}
+
+static void host_report_queue_send(host_report_endpoint_t endpoint, void *report) {
+    endpoints[endpoint].frame         = timer_read();
+    endpoints[endpoint].sent_in_frame = true;
+    queue_stats[endpoint].sent++;
+
+    switch (endpoint) {
+        case HOST_REPORT_KEYBOARD:
+            (*driver->send_keyboard)(report);
+            break;
+        case HOST_REPORT_NKRO:
+            (*driver->send_nkro)(report);
+            break;
+        case HOST_REPORT_MOUSE:
+            (*driver->send_mouse)(report);
+            break;
+        case HOST_REPORT_EXTRA:
+            (*driver->send_extra)(report);
+            break;
+        default:
+            break;
+    }
+}
+
+static void host_report_queue_send_head(void) {
+    host_report_queue_entry_t *entry = host_report_queue_slot(0);
+
+    queue_head = (queue_head + 1) % HOST_REPORT_QUEUE_SIZE;
+    queue_count--;
+    endpoints[entry->endpoint].count--;
+    host_report_queue_send(entry->endpoint, &entry->keyboard);
+}
+
+static bool host_report_queue_frame_free(host_report_endpoint_t endpoint) {
+    return !endpoints[endpoint].sent_in_frame || endpoints[endpoint].frame != timer_read();
+}
+
+/* Queues `report`, sending it straight away if nothing else is waiting and the endpoint has not sent anything this frame */
+static void host_report_queue_push(host_report_endpoint_t endpoint, void *report, uint8_t size) {
+    if (queue_count == 0 && host_report_queue_frame_free(endpoint)) {
+        host_report_queue_send(endpoint, report);
+        return;
+    }
+
+    if (queue_count == HOST_REPORT_QUEUE_SIZE) {
+        // Full, so fall back to blocking on the driver for the oldest report
+        queue_stats[endpoint].overflows++;
+        host_report_queue_send_head();
+    }
+
+    host_report_queue_entry_t *entry = host_report_queue_slot(queue_count);
+    entry->endpoint                  = endpoint;
+    memcpy(&entry->keyboard, report, size);
+    queue_count++;
+    endpoints[endpoint].count++;
+    if (endpoints[endpoint].count > queue_stats[endpoint].max_depth) {
+        queue_stats[endpoint].max_depth = endpoints[endpoint].count;
+    }
+}
+
+/* Drops `report` if it repeats the last one still queued for its endpoint, which leaves the host in the same state */
+static bool host_report_queue_coalesce_duplicate(host_report_endpoint_t endpoint, const void *report, uint8_t size) {
+    host_report_queue_entry_t *last = host_report_queue_last(endpoint);
+    if (last == NULL || memcmp(&last->keyboard, report, size) != 0) return false;
+
+    queue_stats[endpoint].coalesced++;
+    return true;
+}
+
+static bool host_mouse_add(int32_t a, int32_t b, int32_t max, int32_t *sum) {
+    *sum = a + b;
+    return *sum >= -max && *sum <= max;
+}
+
+/* Merges the motion of `report` into the newest queued report, as long as that is a mouse report with the same buttons and nothing saturates */
+static bool host_report_queue_coalesce_mouse(report_mouse_t *report) {
+    if (queue_count == 0) return false;
+    host_report_queue_entry_t *last = host_report_queue_slot(queue_count - 1);
+    if (last->endpoint != HOST_REPORT_MOUSE || last->mouse.buttons != report->buttons) return false;
+
+    report_mouse_t *tail = &last->mouse;
+    int32_t         x, y, v, h;
+    if (!host_mouse_add(tail->x, report->x, HOST_MOUSE_XY_MAX, &x) || !host_mouse_add(tail->y, report->y, HOST_MOUSE_XY_MAX, &y) || !host_mouse_add(tail->v, report->v, HOST_MOUSE_HV_MAX, &v) || !host_mouse_add(tail->h, report->h, HOST_MOUSE_HV_MAX, &h)) {
+        return false;
+    }
+
+    tail->x = x;
+    tail->y = y;
+    tail->v = v;
+    tail->h = h;
+#    ifdef MOUSE_EXTENDED_REPORT
+    tail->boot_x = (x > 127) ? 127 : ((x < -127) ? -127 : x);
+    tail->boot_y = (y > 127) ? 127 : ((y < -127) ? -127 : y);
+#    endif
+    queue_stats[HOST_REPORT_MOUSE].coalesced++;
+    return true;
+}
+
+void host_report_queue_task(void) {
+    if (!driver) return;
+
+    // Reports go out in order, so a report waiting for its endpoint holds back everything queued after it
+    while (queue_count > 0 && host_report_queue_frame_free(host_report_queue_slot(0)->endpoint)) {
+        host_report_queue_send_head();
+    }
+}
+
+void host_report_queue_flush(void) {
+    if (!driver) return;
+
+    while (queue_count > 0) {
+        host_report_queue_send_head();
+    }
+}
+
+uint8_t host_report_queue_depth(host_report_endpoint_t endpoint) {
+    return endpoints[endpoint].count;
+}
+
+host_report_queue_stats_t host_report_queue_stats(host_report_endpoint_t endpoint) {
+    return queue_stats[endpoint];
+}
+
+void host_report_queue_stats_reset(void) {
+    memset(queue_stats, 0, sizeof(queue_stats));
+}
+#endif
+
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
 #ifdef BLUETOOTH_ENABLE
@@ -84,7 +275,13 @@ void host_keyboard_send(report_keyboard_t *report) {
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
+#ifdef HOST_REPORT_QUEUE_SIZE
+    if (!host_report_queue_coalesce_duplicate(HOST_REPORT_KEYBOARD, report, sizeof(report_keyboard_t))) {
+        host_report_queue_push(HOST_REPORT_KEYBOARD, report, sizeof(report_keyboard_t));
+    }
+#else
     (*driver->send_keyboard)(report);
+#endif
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -98,7 +295,13 @@ void host_keyboard_send(report_keyboard_t *report) {
 void host_nkro_send(report_nkro_t *report) {
     if (!driver) return;
     report->report_id = REPORT_ID_NKRO;
+#if defined(HOST_REPORT_QUEUE_SIZE) && defined(NKRO_ENABLE)
+    if (!host_report_queue_coalesce_duplicate(HOST_REPORT_NKRO, report, sizeof(report_nkro_t))) {
+        host_report_queue_push(HOST_REPORT_NKRO, report, sizeof(report_nkro_t));
+    }
+#else
     (*driver->send_nkro)(report);
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -126,7 +329,23 @@ void host_mouse_send(report_mouse_t *report) {
     report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
     report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
 #endif
+#ifdef HOST_REPORT_QUEUE_SIZE
+    if (!host_report_queue_coalesce_mouse(report)) {
+        host_report_queue_push(HOST_REPORT_MOUSE, report, sizeof(report_mouse_t));
+    }
+#else
     (*driver->send_mouse)(report);
+#endif
+}
+
+static void host_extra_send(report_extra_t *report) {
+#ifdef HOST_REPORT_QUEUE_SIZE
+    if (!host_report_queue_coalesce_duplicate(HOST_REPORT_EXTRA, report, sizeof(report_extra_t))) {
+        host_report_queue_push(HOST_REPORT_EXTRA, report, sizeof(report_extra_t));
+    }
+#else
+    (*driver->send_extra)(report);
+#endif
 }
 
 void host_system_send(uint16_t usage) {
@@ -139,7 +358,7 @@ void host_system_send(uint16_t usage) {
         .report_id = REPORT_ID_SYSTEM,
         .usage     = usage,
     };
-    (*driver->send_extra)(&report);
+    host_extra_send(&report);
 }
 
 void host_consumer_send(uint16_t usage) {
@@ -159,7 +378,7 @@ void host_consumer_send(uint16_t usage) {
         .report_id = REPORT_ID_CONSUMER,
         .usage     = usage,
     };
-    (*driver->send_extra)(&report);
+    host_extra_send(&report);
 }
 
 #ifdef JOYSTICK_ENABLE
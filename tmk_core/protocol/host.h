@@ -47,6 +47,31 @@ void    host_programmable_button_send(uint32_t data);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+#ifdef HOST_REPORT_QUEUE_SIZE
+typedef enum {
+    HOST_REPORT_KEYBOARD,
+    HOST_REPORT_NKRO,
+    HOST_REPORT_MOUSE,
+    HOST_REPORT_EXTRA,
+    HOST_REPORT_ENDPOINT_COUNT,
+} host_report_endpoint_t;
+
+typedef struct {
+    uint16_t sent;      // reports handed to the driver
+    uint16_t coalesced; // reports merged into one that was still queued
+    uint16_t overflows; // times the queue was full and the caller had to wait on the driver
+    uint8_t  max_depth; // most reports the endpoint has had queued at once
+} host_report_queue_stats_t;
+
+/* sends queued reports in order, at most one per endpoint each timer_read() millisecond, called from keyboard_task() */
+void host_report_queue_task(void);
+/* sends all queued reports immediately, before suspending or resetting */
+void                      host_report_queue_flush(void);
+uint8_t                   host_report_queue_depth(host_report_endpoint_t endpoint);
+host_report_queue_stats_t host_report_queue_stats(host_report_endpoint_t endpoint);
+void                      host_report_queue_stats_reset(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,24 +32,40 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
+// The keys in each report, so checking whether a key is in the report takes a
+// single bit test rather than a scan. The NKRO report is a bitmap already.
+static uint8_t keyboard_report_bits[32];
+static uint8_t keyboard_report_count = 0;
+#ifdef NKRO_ENABLE
+static uint8_t nkro_report_count = 0;
+#endif
+
+// Incremented whenever a key is added to or removed from a report
+static uint16_t keys_generation = 0;
+
+#define KEY_BIT_TEST(bits, key) ((bits)[(key) >> 3] & (1 << ((key)&7)))
+#define KEY_BIT_SET(bits, key) ((bits)[(key) >> 3] |= (1 << ((key)&7)))
+#define KEY_BIT_CLEAR(bits, key) ((bits)[(key) >> 3] &= ~(1 << ((key)&7)))
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys in the report, not counting modifiers
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        return nkro_report_count;
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
-    }
-    return cnt;
+    return keyboard_report_count;
+}
+
+/** \brief Returns a counter that changes whenever a key is added to or removed from a report
+ *
+ * When it is the same as when a report was last sent, its keys have not changed since.
+ */
+uint16_t get_keys_generation(void) {
+    return keys_generation;
 }
 
 /** \brief get_first_key
@@ -91,18 +107,13 @@ bool is_key_pressed(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         if ((key >> 3) < NKRO_REPORT_BITS) {
-            return nkro_report->bits[key >> 3] & 1 << (key & 7);
+            return KEY_BIT_TEST(nkro_report->bits, key);
         } else {
             return false;
         }
     }
 #endif
-    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-        if (keyboard_report->keys[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return KEY_BIT_TEST(keyboard_report_bits, key);
 }
 
 /** \brief add key byte
@@ -239,45 +250,98 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 
 /** \brief add key to report
  *
- * FIXME: Needs doc
+ * Adds a key to the report in use, unless it is already there.
  */
 void add_key_to_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
+        if ((key >> 3) < NKRO_REPORT_BITS && !KEY_BIT_TEST(nkro_report->bits, key)) {
+            nkro_report_count++;
+            keys_generation++;
+        }
         add_key_bit(nkro_report, key);
         return;
     }
 #endif
+    if (key == KC_NO || KEY_BIT_TEST(keyboard_report_bits, key)) {
+        return;
+    }
+    if (keyboard_report_count == KEYBOARD_REPORT_KEYS) {
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+        // The oldest key makes way for the new one
+        KEY_BIT_CLEAR(keyboard_report_bits, keyboard_report->keys[cb_head]);
+        keyboard_report_count--;
+#else
+        // No room, the key is left out
+        return;
+#endif
+    }
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
     add_key_byte(keyboard_report, key);
+#else
+    // Not in the report yet, and there is room: it takes the first free slot
+    uint8_t i = 0;
+    while (keyboard_report->keys[i]) {
+        i++;
+    }
+    keyboard_report->keys[i] = key;
+#endif
+    KEY_BIT_SET(keyboard_report_bits, key);
+    keyboard_report_count++;
+    keys_generation++;
 }
 
 /** \brief del key from report
  *
- * FIXME: Needs doc
+ * Removes a key from the report in use, if it is there.
  */
 void del_key_from_report(uint8_t key) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
+        if ((key >> 3) < NKRO_REPORT_BITS && KEY_BIT_TEST(nkro_report->bits, key)) {
+            nkro_report_count--;
+            keys_generation++;
+        }
         del_key_bit(nkro_report, key);
         return;
     }
 #endif
+    if (!KEY_BIT_TEST(keyboard_report_bits, key)) {
+        return;
+    }
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
     del_key_byte(keyboard_report, key);
+#else
+    // In the report, and only once
+    uint8_t i = 0;
+    while (keyboard_report->keys[i] != key) {
+        i++;
+    }
+    keyboard_report->keys[i] = 0;
+#endif
+    KEY_BIT_CLEAR(keyboard_report_bits, key);
+    keyboard_report_count--;
+    keys_generation++;
 }
 
 /** \brief clear key from report
  *
- * FIXME: Needs doc
+ * Removes all keys from the report in use, leaving the modifiers.
  */
 void clear_keys_from_report(void) {
     // not clear mods
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
         memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        nkro_report_count = 0;
+        keys_generation++;
         return;
     }
 #endif
     memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+    memset(keyboard_report_bits, 0, sizeof(keyboard_report_bits));
+    keyboard_report_count = 0;
+    keys_generation++;
 }
 
 #ifdef MOUSE_ENABLE